@@ -16,6 +16,8 @@
 #include <stdio.h>
 #include <string.h>
 #include "fsl_sd_disk.h"
+#include "usb_disk_adapter.h"
+#include "trace.h"
 
 /*******************************************************************************
  * Definitons
@@ -42,10 +44,18 @@ DRESULT sd_disk_write(BYTE pdrv, const BYTE* buff, LBA_t sector, UINT count)
         return RES_PARERR;
     }
 
+    /* The Card Is Shared With The USB MSC Path */
+    USB_Disk_Lock();
+    TRACE_BEGIN_ARG(TRACE_ID_SD_WRITE, count);
     if (kStatus_Success != SD_WriteBlocks(&g_sd, buff, sector, count))
     {
+        TRACE_END(TRACE_ID_SD_WRITE);
+        USB_Disk_Unlock();
         return RES_ERROR;
     }
+    TRACE_END(TRACE_ID_SD_WRITE);
+    USB_Disk_Unlock();
+    USB_Disk_NotifyWrite();
 
     return RES_OK;
 }
@@ -57,10 +67,13 @@ DRESULT sd_disk_read(BYTE pdrv, BYTE* buff, LBA_t sector, UINT count)
         return RES_PARERR;
     }
 
+    USB_Disk_Lock();
     if (kStatus_Success != SD_ReadBlocks(&g_sd, buff, sector, count))
     {
+        USB_Disk_Unlock();
         return RES_ERROR;
     }
+    USB_Disk_Unlock();
 
     return RES_OK;
 }
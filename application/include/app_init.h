@@ -36,6 +36,7 @@
 #include "error.h"				// Error Handling
 #include "temperature.h"		// Temperature Measurement Module
 #include "pwrloss_det.h"		// Power Loss Detection Module
+#include "trace.h"				// Hot Path Tracer
 
 /*******************************************************************************
  * Global Definitions
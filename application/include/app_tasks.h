@@ -34,7 +34,9 @@
 /*******************************************************************************
  * Definitions
  ******************************************************************************/
-#define TASK_PRIO		(configMAX_PRIORITIES - 1) //<! Task Priorities.
+#define TASK_PRIO		(configMAX_PRIORITIES - 2) //<! Task Priorities.
+
+#define EMERGENCY_TASK_PRIO	(configMAX_PRIORITIES - 1) //<! Priority of Emergency Task, Above Every Other Task.
 
 /*******************************************************************************
  * Global Variables
@@ -43,8 +45,12 @@
 /* Task Handles 	*/
 extern TaskHandle_t g_xMscTaskHandle;
 
+extern TaskHandle_t g_xMscWriteTaskHandle;
+
 extern TaskHandle_t g_xRecordTaskHandle;
 
+extern TaskHandle_t g_xEmergencyTaskHandle;
+
 /* Semaphores	 	*/
 extern SemaphoreHandle_t g_xSemRecord;
 
@@ -60,12 +66,26 @@ extern SemaphoreHandle_t g_xSemMassStorage;
  *
  * @details	This Task Implements USB Mass Storage Class (MSC) Operations, Allowing
  * 			The System to Act As a Mass Storage Device. It Handles Communication
- * 			With The Host and Manages Read/Write Operations.
+ * 			With The Host and Manages Read/Write Operations. While USB Is Attached The Task
+ * 			Sleeps On Task Notification And Is Woken Up By USB1_HS ISR Only On Attach,
+ * 			Detach or Class Event (See MSC_EVENT_x in mass_storage.h).
  *
  * @param 	handle Pointer to The Device Handle Used For The USB Operations.
  */
 void msc_task(void *handle);
 
+/**
+ * @brief 	Task Committing Host Writes of Mass Storage To The SD Card.
+ *
+ * @details	The USB ISR Only Queues Received Buffers And Notifies This Task, Which Writes Them To The
+ * 			Card While The Next Buffer Is Being Received. It Also Serves Reads And SYNCHRONIZE CACHE
+ * 			In Order With The Queued Writes And Fetches The Next Chunk of a Sequential Read Ahead.
+ * 			After USB Detach It Notifies msc_task Once The Queue Is Drained (MSC_EVENT_WRITTEN).
+ *
+ * @param 	handle Not Used.
+ */
+void msc_write_task(void *handle);
+
 /**
  * @brief 	Task Recording Serial Data.
  *
@@ -77,6 +97,18 @@ void msc_task(void *handle);
  */
 void record_task(void *handle);
 
+/**
+ * @brief 	Task Committing Buffered Data To The SD Card After Power Loss.
+ *
+ * @details	HSCMP1 ISR Only Disables Reception And Notifies This Task, Which Has The Highest Priority.
+ * 			The Flush Waits Till The Task Using The Card Finishes Its In-Flight Transfer (Priority Inheritance
+ * 			of The Record And Card Mutexes), Then Writes The Buffers And Closes The File. The Time From
+ * 			The Comparator Trip Till The Data Are Safe Is Compared Against The Hold-Up Budget.
+ *
+ * @param 	handle Not Used.
+ */
+void emergency_task(void *handle);
+
 /**
  * @brief 	Hook Function to Provide Memory For The Idle Task in FreeRTOS.
  *
@@ -109,4 +141,15 @@ void vApplicationGetTimerTaskMemory(StaticTask_t **ppxTimerTaskTCBBuffer,
                                     StackType_t **ppxTimerTaskStackBuffer,
                                     uint32_t *pulTimerTaskStackSize);
 
+/**
+ * @brief 	Hook Function Called By FreeRTOS When a Task Overflowed Its Stack.
+ *
+ * @details Checked On Every Context Switch (configCHECK_FOR_STACK_OVERFLOW 2). The Task Name Is Printed Into
+ * 			Debug Console And The Device Stops In Error State. Stack High-Water Marks Are Reported By DIAG_Report.
+ *
+ * @param 	xTask Handle of The Task.
+ * @param 	pcTaskName Name of The Task.
+ */
+void vApplicationStackOverflowHook(TaskHandle_t xTask, char *pcTaskName);
+
 #endif /* APP_TASKS_H_ */
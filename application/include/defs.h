@@ -36,14 +36,80 @@
 
 /**
  * @brief 	Defines The Stack Size For Recording Task.
+ * @details The Work Buffer of f_mkfs (FF_MAX_SS) Is Drawn From The SRAM Region (mem.c), The LFN Work Buffer of
+ * 			FatFs ((FF_MAX_LFN + 1) * 2 B, FF_USE_LFN 2) Is On The Stack of The Calling Task.
  */
 #define RECORD_STACK_SIZE     ((uint32_t)(5000UL / (uint32_t)sizeof(portSTACK_TYPE)))
 
+/**
+ * @brief 	Defines The Stack Size For Mass Storage Write Task.
+ * @details The Task Only Moves Queued USB Buffers To The SD Card.
+ */
+#define MSC_WRITE_STACK_SIZE  ((uint32_t)(1024UL / (uint32_t)sizeof(portSTACK_TYPE)))
+
+/**
+ * @brief 	Defines The Stack Size For Emergency Task.
+ * @details The Task Runs The Power Loss Flush (f_open With The LFN Work Buffer, f_write, f_close And Console Output).
+ */
+#define EMERGENCY_STACK_SIZE  ((uint32_t)(2560UL / (uint32_t)sizeof(portSTACK_TYPE)))
+
 /**
  * @brief Enables/Disables Mass Storage Functionality.
  * */
 #define MSC_ENABLED					(true)
 
+/**
+ * @brief 	Enables/Disables Recording While USB Is Attached.
+ * @details Mass Storage Presents The Card As Write-Protected And Recording Continues. Host Reads And Recorder
+ * 			Writes Share The Card Block By Block, The Host Sees Newly Recorded Data After Re-Mount.
+ * 			Requires USB_DEVICE_MSC_USE_WRITE_TASK. Opt-In, The Host Cannot Edit The Configuration File Meanwhile.
+ */
+#define MSC_CONCURRENT_RECORD_ENABLED	(false)
+
+/**
+ * @brief 	Enables/Disables Applying a Changed Configuration File When USB Detaches, Without Reboot.
+ * @details Takes Effect Only Without MSC_CONCURRENT_RECORD_ENABLED, Otherwise The Host Cannot Write The Card.
+ */
+#define CONFIG_RELOAD_ENABLED		(true)
+
+/**
+ * @brief 	Enables/Disables Measurement of Mode-Switch Latency.
+ * @details Time From USB Detach (Seen In USB1_HS ISR) To The First Byte Recorded By LPUART ISR Is Measured
+ * 			By DWT Cycle Counter And Printed Into Debug Console (Needs INFO_ENABLED).
+ */
+#define SWITCH_LATENCY_ENABLED		(false)
+
+/**
+ * @brief 	Enables/Disables Measurement of record_task CPU Load.
+ * @details Cycles Spent By record_task Between Wake-Ups Are Counted By DWT Cycle Counter And The Load Is Printed
+ * 			Into Debug Console Every CPU_LOAD_REPORT_TICKS (Or On The First Wake-Up After That), Needs INFO_ENABLED.
+ */
+#define CPU_LOAD_MEASUREMENT_ENABLED	(false)
+
+/**
+ * @brief 	Interval of record_task CPU Load Report.
+ */
+#define CPU_LOAD_REPORT_TICKS		pdMS_TO_TICKS(10000)
+
+/**
+ * @brief 	Enables/Disables DWT Cycle Counter Tracer of The Hot Paths (See trace.h).
+ * @details A Path Longer Than Its Threshold Freezes The Event Ring, Which Is Dumped Into TRACE_FILE
+ * 			At The Next Idle Flush. tools/trace_convert.py Converts The Dump Into Perfetto JSON.
+ */
+#define TRACE_ENABLED				(false)
+
+/**
+ * @brief 	Enables/Disables Periodic Diagnostics Report (Per-Task CPU Usage, ISR Time, Stack And Heap Watermarks).
+ * @details The Report Is Appended Into DIAG_FILE On The Card Every DIAG_REPORT_TICKS, With INFO_ENABLED Also
+ * 			Printed Into Debug Console.
+ */
+#define DIAG_ENABLED				(false)
+
+/**
+ * @brief 	Interval of The Diagnostics Report.
+ */
+#define DIAG_REPORT_TICKS			pdMS_TO_TICKS(60000)
+
 /**
  * @brief 	Enables/Disables Debug Mode
  * @details If Info Mode Is Enabled Then Informational Logs Are Printed Into Debug Console.
@@ -62,7 +128,7 @@
 #define UART_FIFO_ENABLED			(true)
 
 /**
- * @brief Defines The Size of HW FIFO Queue.
+ * @brief Defines The Default Watermark of HW FIFO Queue (Key 'rx_watermark' of Configuration File).
  */
 #define UART_FIFO_LENGHT			(4u)
 
@@ -71,6 +137,13 @@
  */
 #define UART_PRINT_ENABLED			(false)
 
+/**
+ * @brief 	Enables/Disables Low-Power Idle of The Recorder.
+ * @details After The Idle Flush The SD Card Is Deselected (CMD7) Into Stand-By State, Next Card Access Selects It
+ * 			Again. CPU Sleeps In Tickless Idle (configUSE_TICKLESS_IDLE) And Is Woken Up By LPUART RX Interrupt.
+ */
+#define LOW_POWER_ENABLED			(true)
+
 /**
  * @brief Enables/Disables Power Loss Detection.
  */
@@ -93,6 +166,60 @@
  */
 #define PWRLOSS_DET_ACTIVE_IN_TIME	TAU5
 
+/**
+ * @brief 	Back-Up Capacitance In Farads.
+ * @details C1 And C2 (0.33 F Each) of The Expansion Shield In Parallel, Each Charged Through 10R (Tau 3.3 s).
+ */
+#define PWRLOSS_HOLDUP_CAPACITANCE_F	(0.66)
+
+/**
+ * @brief 	VIN At The Comparator Trip In Volts.
+ * @details DAC Threshold 2.91 V Behind The 18k / 33k Divider of VIN.
+ */
+#define PWRLOSS_TRIP_VOLTAGE_V		(4.5)
+
+/**
+ * @brief 	VIN Where The LDO Drops Out And The Core Browns Out In Volts.
+ */
+#define PWRLOSS_BROWNOUT_VOLTAGE_V	(3.5)
+
+/**
+ * @brief 	Worst-Case Load of The Back-Up Capacitors During The Emergency Flush In Amperes.
+ * @details Board With The SD Card Writing, Replace By The Value Measured With The PPK2 When It Is Known.
+ */
+#define PWRLOSS_LOAD_CURRENT_A		(0.2)
+
+/**
+ * @brief 	Hold-Up Budget of The Emergency Flush (Comparator Trip -> Data Safe On The Card).
+ * @details In Microseconds, C * (V_trip - V_brownout) / I_load, The Measured Worst Case Is Compared Against It
+ * 			After Every Power Loss Flush.
+ */
+#define PWRLOSS_HOLDUP_BUDGET_US	((uint32_t)(((PWRLOSS_HOLDUP_CAPACITANCE_F * \
+												  (PWRLOSS_TRIP_VOLTAGE_V - PWRLOSS_BROWNOUT_VOLTAGE_V)) / \
+												 PWRLOSS_LOAD_CURRENT_A) * 1000000.0))
+
+/**
+ * @brief 	Enables/Disables Emergency Dump Region (See dump.h).
+ * @details On Power Loss The Buffers Are Written Raw Into DUMP_FILE Preallocated At Session Start,
+ * 			Without Any FAT or Directory Update. The Next Boot Appends The Dump To Its Log File.
+ */
+#define DUMP_ENABLED				(true)
+
+/**
+ * @brief 	Enables/Disables Retention of The Recorder State Over Reset (See record.c).
+ * @details The FIFO, Recording Blocks And Their Indexes Are Placed Into .noinit, Which Is Not Cleared By ResetISR.
+ * 			When a Brownout Resets The Core Before The Flush Completes, The Next Boot Appends The Data To Their
+ * 			Log File. Power-On Leaves Random Content, Rejected By The Magic And CRC of The Retention Header.
+ */
+#define RETENTION_ENABLED			(true)
+
+/**
+ * @brief 	Enables/Disables The Binary Capture Mode (Key 'mode', See record.h).
+ * @details The Received Bytes Are Stored Verbatim In Blocks With a Header (Arrival Time of The First Byte, Stream
+ * 			Offset, UART Error Flags) Instead of Text Lines With Time Marks. tools/binlog_convert.py Decodes The Logs.
+ */
+#define BINARY_MODE_ENABLED			(true)
+
 /**
  * @brief Priority of LP_FLEXCOMM Interrupt (UART) For Rx Of Recorded Data.
  */
@@ -131,6 +258,26 @@
  */
 #define CONFIG_FILE 				"config"
 
+/**
+ * @brief Diagnostics Report File.
+ */
+#define DIAG_FILE 					"diag.txt"
+
+/**
+ * @brief Dump File of The Tracer.
+ */
+#define TRACE_FILE 					"trace.bin"
+
+/**
+ * @brief Hidden File Reserving The Emergency Dump Region.
+ */
+#define DUMP_FILE 					"pwrdump.bin"
+
+/**
+ * @brief Log File For Dumped Data of a Session Without Open Log File.
+ */
+#define DUMP_RECOVERED_FILE 		"recovered.txt"
+
 /**
  * @brief 	Default Baud Rate If The Configuration File Could Not Be
  * 			Read Properly.
@@ -155,6 +302,11 @@
  */
 #define DEFAULT_PARITY				kLPUART_ParityDisabled
 
+/**
+ * @brief	Default Record Mode If The Configuration File Does Not Define It.
+ */
+#define DEFAULT_RECORD_MODE			RECORD_MODE_TEXT
+
 /**
  * @brief	Defines The Threshold Level of Free Memory on The SD card,
  * 			Below Which The Lack of Memory is Indicated.
@@ -162,4 +314,47 @@
  */
 #define DEFAULT_FREE_SPACE			50UL
 
+/**
+ * @brief	Default Durability Target If The Configuration File Does Not Define It.
+ * @details In Milliseconds, Maximal Time From Arrival of a Byte Till It Is Written On The Card.
+ * 			Must Be Above The Flush Timeout (DEFAULT_FLUSH_TIMEOUT_MS), Because Data of an Idle Line Wait For The Flush.
+ */
+#define DEFAULT_DURABILITY_MS		5000UL
+
+/**
+ * @brief	Static Arena From Which The Recorder Buffers (Blocks, FIFO, Arrival Ticks) Are Carved At Boot.
+ * @details In Bytes, Bounds The Keys 'fifo_size' And 'block_size' of The Configuration File. The Dump Region
+ * 			On The Card Is Sized To Hold The Whole Arena.
+ */
+#define RECORD_ARENA_SIZE			(32UL * 1024UL)
+
+/**
+ * @brief	Default Size of The Software FIFO Filled By The LPUART ISR.
+ * @details In Bytes, Multiple of 512.
+ */
+#define DEFAULT_FIFO_SIZE			1024UL
+
+/**
+ * @brief	Default Size of One Block Written To The Card.
+ * @details In Bytes, Multiple of 512.
+ */
+#define DEFAULT_BLOCK_SIZE			512UL
+
+/**
+ * @brief	Default Idle Time After Which The Collected Data Are Flushed To The Card.
+ * @details In Milliseconds.
+ */
+#define DEFAULT_FLUSH_TIMEOUT_MS	3000UL
+
+/**
+ * @brief	Default Time Interval Between LED Blinking.
+ * @details In Milliseconds.
+ */
+#define DEFAULT_LED_INTERVAL_MS		10UL
+
+/**
+ * @brief	Default Watermark of The LPUART Rx FIFO.
+ */
+#define DEFAULT_RX_WATERMARK		UART_FIFO_LENGHT
+
 #endif /* DEFS_H_ */
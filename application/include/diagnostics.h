@@ -0,0 +1,107 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      diagnostics.h
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Run-Time Statistics, Stack And Heap Watermarks of The Data Logger.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           diagnostics.h
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Run-Time Statistics, Stack And Heap Watermarks of The Data Logger.
+ * ****************************/
+
+#ifndef DIAGNOSTICS_H_
+#define DIAGNOSTICS_H_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include "fsl_common.h"
+#include "defs.h"
+
+/*******************************************************************************
+ * Global Definitions
+ ******************************************************************************/
+/**
+ * @brief 	Frequency of The Run-Time Stats Counter (CTIMER1) In Hz.
+ * @details 100 kHz Is 500 Times The Tick Rate, The 32-bit Counter Overflows After ~11.9 Hours,
+ * 			Reports Use Differences Between Two Reports So The Overflow Does Not Matter.
+ */
+#define DIAG_COUNTER_FREQ_HZ		100000UL
+
+/**
+ * @brief 	Maximal Number of Tasks In The Report.
+ */
+#define DIAG_MAX_TASKS				8U
+
+/*******************************************************************************
+ * Inline Functions
+ ******************************************************************************/
+#if (true == DIAG_ENABLED)
+/**
+ * @brief 	DWT Cycles Spent In Measured Interrupts (LPUART, USB1_HS), Read By DIAG_Report.
+ */
+extern volatile uint32_t g_u32DiagIsrCycles;
+
+/**
+ * @brief 	Marks The Entry Into a Measured Interrupt.
+ *
+ * @return 	DWT Cycle Counter At The Entry.
+ */
+static inline uint32_t DIAG_IsrEnter(void)
+{
+	return DWT->CYCCNT;
+}
+
+/**
+ * @brief 	Marks The Exit From a Measured Interrupt.
+ * @details A Nested Measured Interrupt Is Counted Twice, The Error Is Bounded By The Shorter ISR.
+ *
+ * @param 	u32Start Value Returned By DIAG_IsrEnter.
+ */
+static inline void DIAG_IsrExit(uint32_t u32Start)
+{
+	g_u32DiagIsrCycles += (DWT->CYCCNT - u32Start);
+}
+#endif /* (true == DIAG_ENABLED) */
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+/**
+ * @brief 	Starts CTIMER1 As Free Running Run-Time Stats Counter.
+ * @details Called By The Kernel Through portCONFIGURE_TIMER_FOR_RUN_TIME_STATS When The Scheduler Starts.
+ */
+void DIAG_InitRunTimeCounter(void);
+
+/**
+ * @brief 	Gets Value of The Run-Time Stats Counter.
+ * @details Called By The Kernel Through portGET_RUN_TIME_COUNTER_VALUE On Every Context Switch.
+ *
+ * @return 	Counter Value In 1 / DIAG_COUNTER_FREQ_HZ Units.
+ */
+uint32_t DIAG_GetRunTimeCounter(void);
+
+/**
+ * @brief 	Starts The Periodic Report Timer.
+ * @details The Timer Only Notifies record_task (RECORD_EVENT_DIAG), The Report Itself Runs In record_task Which Owns
+ * 			The Card While Recording.
+ */
+void DIAG_Init(void);
+
+/**
+ * @brief 	Prints The Report Into Debug Console And Appends It Into DIAG_FILE On The Card.
+ * @details Per-Task CPU Usage And ISR Time Are Computed Since The Previous Report, Stack High-Water Marks
+ * 			And Minimum Ever Free Heap Since Start-Up.
+ *
+ * @param 	bToFile Appends The Report Into DIAG_FILE, Only When The File System Is Owned By The Caller.
+ */
+void DIAG_Report(bool bToFile);
+
+#endif /* DIAGNOSTICS_H_ */
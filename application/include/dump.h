@@ -0,0 +1,197 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      dump.h
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Reserved Emergency Region On The SD Card (Power Loss Dump, Intent Record of The Open Log).
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           dump.h
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Reserved Emergency Region On The SD Card (Power Loss Dump, Intent Record of The Open Log).
+ * ****************************/
+
+#ifndef DUMP_H_
+#define DUMP_H_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "defs.h"
+#include "error.h"
+
+/*******************************************************************************
+ * Global Definitions
+ ******************************************************************************/
+/**
+ * @brief 	Sector Size of The Dump Region.
+ */
+#define DUMP_SECTOR_SIZE			512U
+
+/**
+ * @brief 	Layout of The Region: Dump Header, Intent Record, Dumped Buffers.
+ */
+#define DUMP_HEADER_SECTOR			0U
+#define DUMP_INTENT_SECTOR			1U
+#define DUMP_DATA_SECTOR			2U
+
+/**
+ * @brief 	Size of The Dump Region In Sectors (Header And Intent Sector Included).
+ * @details The Data Part Holds The Whole Recorder Arena, So Any Configured Layout Fits.
+ */
+#define DUMP_REGION_SECTORS			(DUMP_DATA_SECTOR + (RECORD_ARENA_SIZE / DUMP_SECTOR_SIZE))
+
+/**
+ * @brief 	Maximal Number of Dumped RAM Buffers (Regions) And Pieces of Data Appended On Reconciliation.
+ */
+#define DUMP_MAX_REGIONS			4U
+#define DUMP_MAX_PIECES				6U
+
+/**
+ * @brief 	Size of The Path of The Log File Stored In The Header.
+ */
+#define DUMP_PATH_SIZE				64U
+
+/**
+ * @brief 	Magic Number ("PDMP") And Version of The Dump Header.
+ */
+#define DUMP_MAGIC					0x504D4450UL
+#define DUMP_VERSION				2U
+
+/**
+ * @brief 	Magic Number of The Intent Record ("INTN").
+ */
+#define DUMP_INTENT_MAGIC			0x4E544E49UL
+
+/**
+ * @brief 	One RAM Buffer Written Raw Into The Region.
+ * @details The Buffer Must Be Aligned For SD DMA (BOARD_SDMMC_DATA_BUFFER_ALIGN_SIZE) And Span Whole Sectors.
+ */
+typedef struct
+{
+	const uint8_t *pu8Data;			/*<! Start of The Buffer							*/
+	uint16_t u16Sectors;			/*<! Number of Sectors Written						*/
+} dump_region_t;
+
+/**
+ * @brief 	Valid Data In a Region, Pieces Are Appended To The Log File In Their Order.
+ */
+typedef struct
+{
+	uint8_t u8Region;				/*<! Index of The Region							*/
+	uint8_t u8Reserved;
+	uint16_t u16Offset;				/*<! Offset of The Data In The Region				*/
+	uint16_t u16Bytes;				/*<! Number of Valid Bytes							*/
+} dump_piece_t;
+
+/**
+ * @brief 	Header Sector, Written After The Regions So a Torn Dump Is Never Valid.
+ */
+typedef struct
+{
+	uint32_t u32Magic;								/*<! DUMP_MAGIC								*/
+	uint16_t u16Version;							/*<! DUMP_VERSION							*/
+	uint16_t u16Regions;							/*<! Number of Regions						*/
+	uint16_t u16Pieces;								/*<! Number of Pieces						*/
+	uint16_t u16Reserved;
+	uint16_t au16RegionSectors[DUMP_MAX_REGIONS];	/*<! Sectors of Each Region, In Order		*/
+	dump_piece_t axPieces[DUMP_MAX_PIECES];			/*<! Data To Append							*/
+	uint32_t u32PayloadCrc;							/*<! CRC-32 of The Pieces					*/
+	char acPath[DUMP_PATH_SIZE];					/*<! Log File, Empty If No File Was Open	*/
+	uint32_t u32HeaderCrc;							/*<! CRC-32 of The Fields Above				*/
+} dump_header_t;
+
+/**
+ * @brief 	Intent Record, Valid While a Log File Is Open (Its Directory Entry May Be Stale).
+ */
+typedef struct
+{
+	uint32_t u32Magic;								/*<! DUMP_INTENT_MAGIC						*/
+	char acPath[DUMP_PATH_SIZE];					/*<! Open Log File							*/
+	uint32_t u32Crc;								/*<! CRC-32 of The Fields Above				*/
+} dump_intent_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+/**
+ * @brief 	Reserves The Dump Region (DUMP_FILE, Hidden, Contiguous) And Invalidates Its Header.
+ * @details Called At The Start of a Recording Session, The Sector Address Is Kept For DUMP_Write.
+ *
+ * @return 	ERROR_NONE If The Region Is Ready, Otherwise The Emergency Path Falls Back To FatFs.
+ */
+error_t DUMP_Prepare(void);
+
+/**
+ * @brief 	Checks Whether The Region Is Reserved.
+ *
+ * @return 	True If DUMP_Write Can Be Used.
+ */
+bool DUMP_IsReady(void);
+
+/**
+ * @brief 	Writes The Buffers Into The Region With Raw Sector Writes Only (No FAT or Directory Update).
+ * @details The Time Depends Only On The Number of Sectors. The Region Is Used Once, DUMP_IsReady Is False
+ * 			Afterwards Till The Next DUMP_Prepare.
+ *
+ * @param 	pcPath Log File The Data Belong To, NULL or Empty If No File Was Open.
+ * @param 	pxRegions RAM Buffers.
+ * @param 	u16Regions Number of Buffers.
+ * @param 	pxPieces Valid Data In The Buffers, In Order.
+ * @param 	u16Pieces Number of Pieces.
+ *
+ * @return 	ERROR_NONE If The Dump Is Complete.
+ */
+error_t DUMP_Write(const char *pcPath, const dump_region_t *pxRegions, uint16_t u16Regions,
+				   const dump_piece_t *pxPieces, uint16_t u16Pieces);
+
+/**
+ * @brief 	Appends a Valid Dump Left By The Last Power Loss To Its Log File And Invalidates It.
+ * @details Called At Boot After The Volume Is Mounted. Data of a Session Without Open File Go Into
+ * 			DUMP_RECOVERED_FILE.
+ *
+ * @return 	ERROR_NONE If There Was No Dump Or It Was Appended.
+ */
+error_t DUMP_Reconcile(void);
+
+/**
+ * @brief 	Marks The Log File As Open (Raw Write of The Intent Sector).
+ * @details Called Once Per File, After Its First Block Is Synced So The Directory Entry Holds The Start Cluster.
+ *
+ * @param 	pcPath Log File.
+ */
+void DUMP_SetIntent(const char *pcPath);
+
+/**
+ * @brief 	Clears The Intent Record After The Log File Was Closed.
+ */
+void DUMP_ClearIntent(void);
+
+/**
+ * @brief 	Repairs The Log File Left Open By The Last Session.
+ * @details Called At Boot Before DUMP_Reconcile, Only The File of The Intent Record Is Checked. Its Size Is Set
+ * 			From The Cluster Chain: Full Clusters Before The Last One, And Sectors of The Last Cluster Till The
+ * 			First Never Written Sector (All 0x00 or All 0xFF).
+ *
+ * @return 	ERROR_NONE If There Was No Open File Or It Was Repaired.
+ */
+error_t DUMP_RepairIntent(void);
+
+/**
+ * @brief 	Computes CRC-32 (IEEE 802.3, Reflected).
+ *
+ * @param 	u32Crc CRC of The Previous Data, 0 At Start.
+ * @param 	pu8Data Data.
+ * @param 	u32Length Number of Bytes.
+ *
+ * @return 	Updated CRC.
+ */
+uint32_t DUMP_Crc32(uint32_t u32Crc, const uint8_t *pu8Data, uint32_t u32Length);
+
+#endif /* DUMP_H_ */
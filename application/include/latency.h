@@ -0,0 +1,65 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      latency.h
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    End-To-End Latency of Received Data (LPUART Arrival -> Written On The Card).
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           latency.h
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          End-To-End Latency of Received Data (LPUART Arrival -> Written On The Card).
+ * ****************************/
+
+#ifndef LATENCY_H_
+#define LATENCY_H_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include "defs.h"
+
+/*******************************************************************************
+ * Global Definitions
+ ******************************************************************************/
+/**
+ * @brief 	Number of Histogram Buckets, Upper Bounds Are In latency.c.
+ */
+#define LATENCY_BUCKETS				11U
+
+/**
+ * @brief 	Report File, Created In The Session Directory.
+ */
+#define LATENCY_FILE				"latency.txt"
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+/**
+ * @brief 	Clears The Histogram At The Start of a Recording Session.
+ */
+void LATENCY_Reset(void);
+
+/**
+ * @brief 	Records Latency of One Block Which Was Just Written On The Card.
+ * @details When The Latency Exceeds The Durability Target (Key 'durability_ms' of Configuration File),
+ * 			An Alert Is Printed And The Tracer Is Triggered.
+ *
+ * @param 	u16OldestTick Low 16 Bits of The Tick Count At Arrival of The Oldest Byte In The Block.
+ */
+void LATENCY_Record(uint16_t u16OldestTick);
+
+/**
+ * @brief 	Prints The Histogram of The Session And Writes It Into LATENCY_FILE In The Session Directory.
+ * @details Does Nothing If No Block Was Recorded Since The Last Report.
+ *
+ * @param 	pcDirectory Session Directory.
+ */
+void LATENCY_Report(const char *pcDirectory);
+
+#endif /* LATENCY_H_ */
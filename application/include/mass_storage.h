@@ -24,6 +24,39 @@
  ******************************************************************************/
 #include "disk.h"
 
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/**
+ * @brief 	Notification Bit of msc_task: USB Host Attached.
+ */
+#define MSC_EVENT_ATTACH			(1UL << 0U)
+
+/**
+ * @brief 	Notification Bit of msc_task: USB Host Detached.
+ */
+#define MSC_EVENT_DETACH			(1UL << 1U)
+
+/**
+ * @brief 	Notification Bit of msc_task: Class Event (Configuration Changed or Read/Write Error).
+ */
+#define MSC_EVENT_CLASS				(1UL << 2U)
+
+/**
+ * @brief 	Notification Bit of msc_task: Host Writes Queued At USB Detach Are On The Card (msc_write_task).
+ */
+#define MSC_EVENT_WRITTEN			(1UL << 3U)
+
+/**
+ * @brief 	Time After Which msc_task Re-Checks The Write Queue Without Notification.
+ */
+#define MSC_WRITTEN_TIMEOUT_MS		(100UL)
+
+/**
+ * @brief 	All Notification Bits of msc_task.
+ */
+#define MSC_EVENT_ALL				(MSC_EVENT_ATTACH | MSC_EVENT_DETACH | MSC_EVENT_CLASS | MSC_EVENT_WRITTEN)
+
 /*******************************************************************************
  * Global Variables
  ******************************************************************************/
@@ -32,6 +65,14 @@
  * Function Declarations
  ******************************************************************************/
 
+/**
+ * @brief 	Gets Time of The Last USB Detach.
+ * @details Captured In USB1_HS ISR, Used As Start of Mode-Switch Latency Measurement.
+ *
+ * @return 	DWT Cycle Counter Value At The Moment of Detach.
+ */
+uint32_t MSC_GetDetachCycles(void);
+
 /**
  * @brief Process Extension to Mass Storage.
  */
@@ -0,0 +1,94 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      mem.h
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Region Arenas From Which The Subsystems Draw Their Buffers At Init, RAM Budget Report.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           mem.h
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Region Arenas From Which The Subsystems Draw Their Buffers At Init, RAM Budget Report.
+ * ****************************/
+
+#ifndef MEM_H_
+#define MEM_H_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include "defs.h"
+
+/*******************************************************************************
+ * Global Definitions
+ ******************************************************************************/
+/**
+ * @brief 	Size of The SRAM Memory of The Managed Linker Script (See .cproject), Bounds The Budget At Build Time.
+ */
+#define MEM_SRAM_TOTAL				0x60000UL
+
+/**
+ * @brief 	Size of The Retained Region, Holds The Retention Header of The Recorder.
+ */
+#define MEM_RETAINED_SIZE			128UL
+
+/**
+ * @brief 	Maximal Number of Blocks Drawn From All Regions, Each Is Listed In The Budget Report.
+ */
+#define MEM_MAX_BLOCKS				16U
+
+/**
+ * @brief 	Region Arenas.
+ * @details MCXN947 Has No Data Cache On SRAM, So Every Region Is DMA-Capable And Non-Cacheable. The DMA Region
+ * 			Guarantees The Alignment Required By SD And USB DMA.
+ */
+typedef enum
+{
+	MEM_REGION_DMA = 0,			/**< Buffers of SD And USB DMA (.noinit), Shared By The Modes			*/
+	MEM_REGION_SRAM,			/**< Task Stacks And Work Buffers (.bss)								*/
+	MEM_REGION_RETAINED,		/**< State Kept Over Reset (.noinit), Its Layout Never Changes			*/
+	MEM_REGION_COUNT
+} mem_region_t;
+
+/**
+ * @brief 	Mode In Which a Block Is Used.
+ * @details Blocks of The Record Mode And of The Mass Storage Mode Overlap, Unless The Modes Run Concurrently
+ * 			(MSC_CONCURRENT_RECORD_ENABLED). The Owner Leaving Its Mode Must Not Keep Data In Them.
+ */
+typedef enum
+{
+	MEM_OWNER_COMMON = 0,		/**< Used In Both Modes					*/
+	MEM_OWNER_RECORD,			/**< Used Only While Recording			*/
+	MEM_OWNER_MSC,				/**< Used Only In Mass Storage Mode		*/
+	MEM_OWNER_COUNT
+} mem_owner_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+/**
+ * @brief 	Draws a Block From a Region, Blocks Are Never Freed.
+ * @details Called At Init Only (main Before The Scheduler, record_task), Not Thread-Safe. The Order of The Calls
+ * 			Is The Same On Every Boot, So a Block Gets The Same Address After Reset.
+ *
+ * @param 	eRegion Region.
+ * @param 	eOwner Mode In Which The Block Is Used.
+ * @param 	u32Size Size In Bytes, Rounded Up To The Alignment of The Region.
+ * @param 	pcName Name In The Budget Report (Static String).
+ *
+ * @return 	Start of The Block, NULL If The Region Is Exhausted (The Budget In mem.c Is Wrong).
+ */
+void *MEM_Alloc(mem_region_t eRegion, mem_owner_t eOwner, uint32_t u32Size, const char *pcName);
+
+/**
+ * @brief 	Prints The RAM Budget: Regions, Their Blocks, Static Consumers And The Use of SRAM.
+ * @details The Regions And Static Consumers (FreeRTOS Heap) Are Summed, ERR If The Total Exceeds SRAM.
+ */
+void MEM_Report(void);
+
+#endif /* MEM_H_ */
@@ -21,6 +21,7 @@
  * Includes
  ******************************************************************************/
 #include <stdint.h>
+#include <stdbool.h>
 #include <string.h>
 #include <errno.h>
 #include <stdlib.h>
@@ -32,6 +33,15 @@
 /*******************************************************************************
  * Definitions
  ******************************************************************************/
+/**
+ * @brief 	Longest Line of The Configuration File (Without Line End), Longer Lines Are Reported As Invalid.
+ */
+#define PARSER_LINE_SIZE			80U
+
+/**
+ * @brief 	Size of The Chunk In Which The Configuration File Is Read.
+ */
+#define PARSER_CHUNK_SIZE			64U
 
 /*******************************************************************************
  * Structures
@@ -53,6 +63,16 @@ typedef enum
 
 } REC_version_t;
 
+/**
+ * @brief 	Format In Which The Received Data Are Stored (Key 'mode').
+ */
+typedef enum
+{
+	RECORD_MODE_TEXT = 0,	/**< Text Lines, Each Line End Followed By a Time Mark			*/
+	RECORD_MODE_BINARY		/**< Verbatim Bytes In Blocks With a Header (See record.h)		*/
+
+} REC_mode_t;
+
 /**
  * @brief 	Configuration structure for the recording system.
  *
@@ -76,8 +96,54 @@ typedef struct
 	uint32_t		max_bytes;			/**< Number of Bytes Between LED Signal	*/
 	uint32_t 		free_space_limit_mb;/**< Defines The Threshold Level of Free Memory on The SD card,
 	 	 	 	 	 	 	 	 	 	  	Below Which The Lack of Memory is Indicated. */
+	uint32_t 		durability_ms;		/**< Durability Target (Arrival -> Card), 0 Disables Alerts */
+
+	REC_mode_t 		mode;				/**< Format of The Stored Data							*/
+
+	/* Sizing And Timing of The Recorder */
+	uint32_t 		fifo_size;			/**< Size of The Software FIFO Filled By LPUART ISR		*/
+	uint32_t 		block_size;			/**< Size of One Block Written To The Card				*/
+	uint32_t 		flush_timeout_ms;	/**< Idle Time After Which The Collected Data Are Flushed	*/
+	uint32_t 		led_interval_ms;	/**< Time Interval Between LED Blinking					*/
+	uint8_t 		rx_watermark;		/**< LPUART Rx FIFO Watermark							*/
 
 } REC_config_t;
+
+/**
+ * @brief 	Type of The Value of a Configuration Key.
+ */
+typedef enum
+{
+	PARSER_TYPE_UINT = 0,		/**< Decimal Number In Range <u32Min, u32Max>	*/
+	PARSER_TYPE_ENUM			/**< One of The Names of pxNames				*/
+
+} parser_type_t;
+
+/**
+ * @brief 	Name of an Enumerated Value.
+ */
+typedef struct
+{
+	const char 		*pcName;	/**< Name In The Configuration File, NULL Terminates The List	*/
+	uint32_t 		u32Value;	/**< Value Passed To The Setter									*/
+
+} parser_name_t;
+
+/**
+ * @brief 	Descriptor of One Configuration Key.
+ * @details Defaults Are Applied Through The Setter As Well, So Derived Values Are Always Consistent.
+ */
+typedef struct
+{
+	const char 				*pcKey;			/**< Key Without '='							*/
+	parser_type_t 			eType;			/**< Type of The Value							*/
+	uint32_t 				u32Min;			/**< Minimal Value (PARSER_TYPE_UINT)			*/
+	uint32_t 				u32Max;			/**< Maximal Value (PARSER_TYPE_UINT)			*/
+	uint32_t 				u32Default;		/**< Value Used If The Key Is Missing or Invalid	*/
+	const parser_name_t 	*pxNames;		/**< Allowed Names (PARSER_TYPE_ENUM)			*/
+	void 					(*pfSet)(uint32_t u32Value);	/**< Applies The Value To g_config	*/
+
+} parser_key_t;
 /*******************************************************************************
  * Prototypes
  ******************************************************************************/
@@ -157,57 +223,90 @@ uint32_t PARSER_GetFreeSpaceLimitMB(void);
 uint32_t PARSER_GetMaxBytes(void);
 
 /**
- * @brief 		Clears The Configuration To Default.
+ * @brief 		Returns The Durability Target of Received Data.
+ *
+ * @return		uint32_t Maximal Time From Arrival To Card In Milliseconds, 0 If Disabled.
+ *
  */
-void PARSER_ClearConfig(void);
+uint32_t PARSER_GetDurabilityMs(void);
+
+/**
+ * @brief 		Returns The Format In Which The Received Data Are Stored.
+ *
+ * @return		REC_mode_t RECORD_MODE_TEXT or RECORD_MODE_BINARY.
+ */
+REC_mode_t PARSER_GetMode(void);
+
+/**
+ * @brief 		Returns The Size of The Software FIFO.
+ *
+ * @return		uint32_t Size In Bytes, Multiple of 512.
+ */
+uint32_t PARSER_GetFifoSize(void);
 
 /**
- * @brief 		Parse Baud Rate From Configuration File.
- * @param[in]	chContent Pointer To Content of Configuration File.
+ * @brief 		Returns The Size of One Block Written To The Card.
  *
- * @returns		ERROR_NONE If The Parsing Succeed.
+ * @return		uint32_t Size In Bytes, Multiple of 512.
  */
-error_t PARSER_ParseBaudrate(const char *chContent);
+uint32_t PARSER_GetBlockSize(void);
 
 /**
- * @brief 		Parse Record File Size From Configuration File.
- * @param[in]	chContent Pointer To Content of Configuration File.
+ * @brief 		Returns The Idle Time After Which The Collected Data Are Flushed.
  *
- * @returns		ERROR_NONE If The Parsing Succeed.
+ * @return		uint32_t Timeout In Milliseconds.
+ */
+uint32_t PARSER_GetFlushTimeoutMs(void);
+
+/**
+ * @brief 		Returns The LPUART Rx FIFO Watermark.
+ *
+ * @return		uint8_t Watermark (Number of Entries).
+ */
+uint8_t PARSER_GetRxWatermark(void);
+
+/**
+ * @brief 		Clears The Configuration To Default.
  */
-error_t PARSER_ParseFileSize(const char *chContent);
+void PARSER_ClearConfig(void);
 
 /**
- * @brief 		Parse Parity From Configuration File.
- * @param[in]	chContent Pointer To Content of Configuration File.
+ * @brief 		Restores a Configuration Returned By PARSER_GetConfig (Reload of The File Failed).
  *
- * @returns		ERROR_NONE If The Parsing Succeed.
+ * @param[in]	pxConfig Configuration To Be Restored.
  */
-error_t PARSER_ParseParity(const char *chContent);
+void PARSER_SetConfig(const REC_config_t *pxConfig);
 
 /**
- * @brief 		Parse The Number of Stop Bits From Configuration File.
- * @param[in]	chContent Pointer To Content of Configuration File.
+ * @brief 		Starts Parsing of a Configuration File, All Keys Are Set To Their Defaults.
+ */
+void PARSER_Begin(void);
+
+/**
+ * @brief 		Feeds Next Chunk of The Configuration File Into The Tokenizer.
+ * @details 	Chunks May Split Lines Anywhere, Each Complete Line Is Applied Immediately.
+ * 				Syntax Per Line: 'key = value', Comments Start With '#' or ';', Empty Lines Are Skipped.
  *
- * @returns		ERROR_NONE If The Parsing Succeed.
+ * @param[in]	pcData Chunk of The File (Not Null-Terminated).
+ * @param[in]	u32Length Number of Bytes In The Chunk.
  */
-error_t PARSER_ParseStopBits(const char *chContent);
+void PARSER_Feed(const char *pcData, uint32_t u32Length);
 
 /**
- * @brief 		Parse The Number of Data Bits From Configuration File.
- * @param[in]	chContent Pointer To Content of Configuration File.
+ * @brief 		Finishes Parsing, The Last Line May Be Without Line End.
  *
- * @returns		ERROR_NONE If The Parsing Succeed.
+ * @returns		ERROR_NONE If All Lines Were Valid, Otherwise ERROR_CONFIG (Each Invalid Line Is Reported
+ * 				With Its Number And Its Key Keeps The Default Value).
  */
-error_t PARSER_ParseDataBits(const char *chContent);
+error_t PARSER_End(void);
 
 /**
- * @brief 		Parse The Size of Free Space When Data Logger Will Signal To The User That
- * 				Data Logger Is Running Out of Space.
- * @param[in]	chContent Pointer To Content of Configuration File.
+ * @brief 		Returns The Table of Key Descriptors.
+ *
+ * @param[out]	pu32Count Number of Keys.
  *
- * @returns		ERROR_NONE If The Parsing Succeed.
+ * @returns		Key Descriptors.
  */
-error_t PARSER_ParseFreeSpace(const char *chContent);
+const parser_key_t *PARSER_GetKeys(uint32_t *pu32Count);
 
 #endif /* PARSER_H_ */
@@ -97,5 +97,13 @@
  */
 void PWRLOSS_DetectionInit(void);
 
+/**
+ * @brief   Measures The Time From The Comparator Trip Till The Data Are Safe On The Card.
+ * @details Called By The Emergency Task After The Flush. The Worst Case Is Kept And Compared Against
+ *          PWRLOSS_HOLDUP_BUDGET_US (Discharge of The Back-Up Capacitors From The Trip
+ *          Till The Brownout, Not Their Charge Time TAU5), Exceeding It Is Reported As an Error.
+ */
+void PWRLOSS_ReportTripToSafe(void);
+
 
 #endif /* PWRLOSS_DET_H_ */
@@ -47,13 +47,54 @@
  * Definitions
  ******************************************************************************/
 /**
- * @brief Timeout Interval Before Flush If No New Data Were Received [In Mili-Seconds].
+ * @brief Notification Bits of record_task.
  */
-#define FLUSH_TIMEOUT_TICKS pdMS_TO_TICKS(3000)
+#define RECORD_EVENT_DATA		(1UL << 0U)		/*<! Line End or Threshold of Data In FIFO (LPUART ISR)	*/
+#define RECORD_EVENT_FLUSH		(1UL << 1U)		/*<! Flush Deadline Expired (Flush Timer)				*/
+#define RECORD_EVENT_USB		(1UL << 2U)		/*<! USB Attached, Recording Stops (USB1_HS ISR)		*/
+#define RECORD_EVENT_DIAG		(1UL << 3U)		/*<! Diagnostics Report Is Due (Diagnostics Timer)		*/
+#define RECORD_EVENT_ALL		(RECORD_EVENT_DATA | RECORD_EVENT_FLUSH | RECORD_EVENT_USB | RECORD_EVENT_DIAG)
+
+#if (true == BINARY_MODE_ENABLED)
+/**
+ * @brief 	Magic Number ("BLK1") And Version of The Block Header In Binary Mode.
+ * @details Keep In Sync With tools/binlog_convert.py.
+ */
+#define RECORD_BIN_MAGIC		0x314B4C42UL
+
+/**
+ * @brief 	Flags of The Block Header, Receiver Events Before a Byte of The Block (The First Byte Received After Them).
+ */
+#define RECORD_BIN_FLAG_OVERRUN	(1U << 0U)		/*<! LPUART Receiver Overrun, Bytes Lost In Hardware		*/
+#define RECORD_BIN_FLAG_NOISE	(1U << 1U)		/*<! Noise Detected In a Received Byte						*/
+#define RECORD_BIN_FLAG_FRAMING	(1U << 2U)		/*<! Framing Error (Stop Bit Missing, Baud Rate Mismatch)	*/
+#define RECORD_BIN_FLAG_PARITY	(1U << 3U)		/*<! Parity Error											*/
+#define RECORD_BIN_FLAG_DROPPED	(1U << 4U)		/*<! FIFO Full, Bytes Dropped By LPUART ISR					*/
+#endif /* (true == BINARY_MODE_ENABLED) */
 
 /*******************************************************************************
  * Structures
  ******************************************************************************/
+#if (true == BINARY_MODE_ENABLED)
+/**
+ * @brief 	Header At The Start of Each Block In Binary Mode, The Received Bytes Follow Verbatim.
+ * @details Blocks Are Written Whole, So a Header Starts Every block_size Bytes of The Log, Bytes Behind The Payload
+ * 			Are Padding. Data Saved On Power Loss or Over Reset End With a Block Cut After Its Payload, Followed By
+ * 			The Raw FIFO Bytes. Arrival Time Is The Tick of The First Byte, The IRTC Time Of The Block Opening Maps
+ * 			The Ticks To The Calendar. Little-Endian, Keep In Sync With tools/binlog_convert.py.
+ */
+typedef struct
+{
+	uint32_t u32Magic;						/*<! RECORD_BIN_MAGIC										*/
+	uint16_t u16Length;						/*<! Payload Bytes Following The Header					*/
+	uint16_t u16Flags;						/*<! RECORD_BIN_FLAG_x									*/
+	uint64_t u64Offset;						/*<! Stream Offset of The First Payload Byte In The Session	*/
+	uint32_t u32TickMs;						/*<! Arrival of The First Payload Byte, ms Since Boot		*/
+	uint32_t u32RtcSeconds;					/*<! IRTC Time When The Block Was Opened, Unix Seconds		*/
+} record_bin_header_t;
+
+_Static_assert(sizeof(record_bin_header_t) == 24U, "Block header layout is shared with tools/binlog_convert.py");
+#endif /* (true == BINARY_MODE_ENABLED) */
 
 /*******************************************************************************
  * Prototypes
@@ -80,6 +121,17 @@ error_t CONSOLELOG_CreateDirectory(void);
  */
 error_t CONSOLELOG_CreateFile(void);
 
+#if (true == SWITCH_LATENCY_ENABLED)
+/**
+ * @brief 		Starts Measurement of Mode-Switch Latency.
+ * @details		The Latency Is Taken By LPUART ISR On The First Received Byte
+ * 				And Printed By The Next CONSOLELOG_Recording() Call.
+ *
+ * @param[in]	u32StartCycles DWT Cycle Counter Value At USB Detach.
+ */
+void CONSOLELOG_StartSwitchMeasure(uint32_t u32StartCycles);
+#endif /* (true == SWITCH_LATENCY_ENABLED) */
+
 /**
  * @brief 		Returns Currently Received Bytes Between LED Blinking.
  *
@@ -104,6 +156,27 @@ void CONSOLELOG_ClearTransferedBytes(void);
  */
 uint32_t CONSOLELOG_GetMaxBytes(void);
 
+/**
+ * @brief 		Returns Full Blocks Overwritten Before They Were Written Since The Session Start.
+ *
+ * @return		Number of Dropped Blocks, Any Other Value Than Zero Is a Bug of The Recorder.
+ */
+uint32_t CONSOLELOG_GetDroppedBlocks(void);
+
+/**
+ * @brief 		Returns Received Bytes Dropped Because The FIFO Was Full Since The Session Start.
+ *
+ * @return		Number of Bytes The LPUART ISR Could Not Store (Text And Binary Mode).
+ */
+uint32_t CONSOLELOG_GetFifoFullBytes(void);
+
+/**
+ * @brief 		Checks Whether All Received Bytes Were Taken From The FIFO.
+ *
+ * @return		True If The FIFO Is Empty.
+ */
+bool CONSOLELOG_IsFifoEmpty(void);
+
 /**
  * @brief		Checks If The File System Is Initialized
  *
@@ -126,12 +199,34 @@ FRESULT CONSOLELOG_CheckFileSystem(void);
  */
 error_t CONSOLELOG_Init(void);
 
+/**
+ * @brief 		Waits Till There Is Work For record_task.
+ * @details		The Task Sleeps Until LPUART ISR Signals a Line End or a Threshold of Data,
+ * 				The Flush Deadline Expires, Or USB Is Attached.
+ *
+ * @return		Received RECORD_EVENT_x Bits.
+ */
+uint32_t CONSOLELOG_WaitForEvent(void);
+
+/**
+ * @brief		Applies The Sizing And Timing Keys of The Configuration To The Recorder.
+ * @details		Carves The FIFO And The Blocks From The Recorder Arena (RECORD_ARENA_SIZE) According To 'fifo_size'
+ * 				And 'block_size', Sets The Idle Flush Timeout And Prints The Memory Map. Called After
+ * 				CONSOLELOG_ReadConfig, Before The UART Is Enabled.
+ *
+ * @return 		ERROR_NONE If The Configured Layout Is Used, ERROR_CONFIG If It Does Not Fit Into The Arena
+ * 				(Defaults Are Used Then).
+ */
+error_t CONSOLELOG_Configure(void);
+
 /**
  * @brief 		Starts The Recording Process by Initializing the File
  * 				System, Creating a Directory, and Writing to a File.
  *
  * @details 	Function Uses `CONSOLELOG_Init` To Initialize The Recording
- * 				System.
+ * 				System. One Pass Collects At Most One Full Block, So It Is Written Before
+ * 				The Next One Is Collected. record_task Is Notified Again If The FIFO
+ * 				Still Holds Data (See CONSOLELOG_IsFifoEmpty).
  *
  * @return 		error_t Returns 0 on Success, Otherwise Returns a Non-Zero Value.
  */
@@ -152,11 +247,47 @@ error_t CONSOLELOG_Flush(void);
  * @brief 		Flushes Collected Data To The File If Power Loss Was Detected.
  * @details		If Power Loss Was Detected, Then This Function Flushes All The Data
  * 				So Far Stored In The DMA Buffer, Saves It To a File on The Physical Media and Closes The File.
+ * 				Must Be Called From a Task (Emergency Task, msc_task), It Waits For The Record Lock.
  *
  * @return		error_t Returns 0 on Success, Otherwise Returns a Non-Zero Value.
  */
 error_t CONSOLELOG_PowerLossFlush(void);
 
+/**
+ * @brief 		Writes The Latency Histogram of The Session Into Its Directory (See latency.h).
+ * @details		Called On The Diagnostics Period, When USB Attaches And After The Power Loss Flush, Not After Every
+ * 				Idle Flush, So a Burst Does Not Cost Another Directory Update.
+ */
+void CONSOLELOG_ReportLatency(void);
+
+/**
+ * @brief 		Hands The Recorder Buffers Over To The MSC Buffers Which Share The DMA Region (mem.c).
+ * @details		Called By msc_task After CONSOLELOG_PowerLossFlush When The Modes Do Not Run Concurrently. Data The
+ * 				Flush Could Not Write Are Dropped, The Retention Header Is Reset So They Are Not "Recovered" From
+ * 				The MSC Data After Reset.
+ */
+void CONSOLELOG_ReleaseBuffers(void);
+
+/**
+ * @brief 		Dumps Collected Data Into The Reserved Dump Region If Power Loss Was Detected.
+ * @details		Only Raw Sector Writes (See dump.h), So The Time Does Not Depend On FAT State. The Data Are
+ * 				Appended To The Log File On The Next Boot. Falls Back To CONSOLELOG_PowerLossFlush If The
+ * 				Region Is Not Reserved Or The Dump Fails. Must Be Called From The Emergency Task.
+ *
+ * @return		error_t Returns 0 on Success, Otherwise Returns a Non-Zero Value.
+ */
+error_t CONSOLELOG_PowerLossDump(void);
+
+/**
+ * @brief 		Takes The Record Lock, record_task Holds It While It Processes The Buffers And The Record File.
+ */
+void CONSOLELOG_Lock(void);
+
+/**
+ * @brief 		Releases The Record Lock.
+ */
+void CONSOLELOG_Unlock(void);
+
 /**
  * @brief 		De-Initializes The Recording System and Un-Mounts The File System.
  *
@@ -167,23 +298,35 @@ error_t CONSOLELOG_Deinit(void);
 /**
  * @brief		Reads and Processes The Configuration File From The Root directory.
  *
- * @details		This Function Scans The Root Directory For a Configuration File, If The File is Found
- * 				Reads its Contents Into g_config Buffer.
+ * @details		The File Is Streamed Into The Parser In Chunks of PARSER_CHUNK_SIZE, So Its Size Is Not Limited.
+ * 				Keys Which Are Missing or Invalid Keep Their Defaults.
  *
- * @return 		error_t Returns 0 If Configuration File Is Correctly Processed,
- * 				Otherwise Returns E_FAULT.
+ * @return 		error_t Returns ERROR_NONE If Configuration File Is Correctly Processed, ERROR_CONFIG If Some
+ * 				Lines Are Invalid, ERROR_OPEN or ERROR_READ If The File Cannot Be Read.
  */
 error_t CONSOLELOG_ReadConfig(void);
 
 /**
- * @brief 		Processes The Content of The Configuration File To Extract
- * 				and Validate The Baudrate.
+ * @brief		Applies The Configuration File If The Host Changed It During The Mass Storage Session.
+ *
+ * @details		Called By record_task When USB Detaches, Before The UART Is Initialized. An Unchanged Directory
+ * 				Entry Skips The File, Otherwise Its CRC Decides. Changed Sizing Re-Carves The Arena, a File Size
+ * 				Limit Below The Current Log Rotates It, The UART Keys Take Effect With The Following UART_Init.
+ * 				The Changed Keys Are Recorded As a Marker Line In The Active Log, The Session Directory Is Kept.
+ * 				A Failed Read or an Invalid Line Keeps The Previous Configuration Whole, Nothing Is Re-Carved.
+ *
+ * @return 		ERROR_NONE If The File Is Unchanged or Was Applied, Otherwise The Error of The Reading or Carving.
+ */
+error_t CONSOLELOG_ReloadConfig(void);
+
+/**
+ * @brief 		Processes The Content of The Configuration File Held In Memory.
  *
  * @param[in] 	content Content The Content of The Configuration File as a Null-Terminated
  * 				String.
  *
- * @return 		error_t Returns 0 If Configuration File Is Correctly Processed,
- * 				Otherwise Returns E_FAULT.
+ * @return 		error_t Returns ERROR_NONE If Configuration File Is Correctly Processed,
+ * 				Otherwise Returns ERROR_CONFIG.
  */
 error_t CONSOLELOG_ProccessConfigFile(const char *content);
 
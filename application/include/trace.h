@@ -0,0 +1,151 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      trace.h
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    DWT Cycle Counter Tracer of The Hot Paths (Begin/End Events In RAM Ring).
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           trace.h
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          DWT Cycle Counter Tracer of The Hot Paths (Begin/End Events In RAM Ring).
+ * ****************************/
+
+#ifndef TRACE_H_
+#define TRACE_H_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "defs.h"
+#include "error.h"
+
+/*******************************************************************************
+ * Global Definitions
+ ******************************************************************************/
+/**
+ * @brief 	Number of Events In The Ring (Power of Two), One Event Takes 8 B.
+ */
+#define TRACE_RING_EVENTS			1024U
+
+/**
+ * @brief 	Number of Events Recorded After a Spike Before The Ring Is Frozen.
+ * @details The Rest of The Ring Keeps The History Before The Spike.
+ */
+#define TRACE_POST_TRIGGER_EVENTS	(TRACE_RING_EVENTS / 4U)
+
+/**
+ * @brief 	Magic Number And Version of The Dump File ("DWTT").
+ */
+#define TRACE_FILE_MAGIC			0x54545744UL
+#define TRACE_FILE_VERSION			1U
+
+/**
+ * @brief 	Traced Code Paths, Their Spike Thresholds Are In trace.c.
+ * @note 	Keep In Sync With tools/trace_convert.py.
+ */
+typedef enum
+{
+	TRACE_ID_UART_ISR 	= 0,		/*<! LP_FLEXCOMM3_IRQHandler							*/
+	TRACE_ID_RECORDING 	= 1,		/*<! One Call of CONSOLELOG_Recording				*/
+	TRACE_ID_TIMESTAMP 	= 2,		/*<! Time Mark Insertion After CRLF					*/
+	TRACE_ID_F_WRITE 	= 3,		/*<! f_write of a Record Block						*/
+	TRACE_ID_SD_WRITE 	= 4,		/*<! SD_WriteBlocks (FatFs Or MSC), Arg = Blocks	*/
+	TRACE_ID_MSC_CMD 	= 5,		/*<! MSC Command From CBW To CSW, Arg = Opcode		*/
+	TRACE_ID_PWRLOSS 	= 6,		/*<! Power Loss Interrupt And Emergency Flush		*/
+	TRACE_ID_COUNT
+} trace_id_t;
+
+/**
+ * @brief 	Event Type.
+ */
+#define TRACE_TYPE_BEGIN			0U
+#define TRACE_TYPE_END				1U
+
+/**
+ * @brief 	One Event of The Ring, Also The Record Format of The Dump File.
+ */
+typedef struct
+{
+	uint32_t u32Cycles;				/*<! DWT->CYCCNT At The Event						*/
+	uint8_t u8Id;					/*<! trace_id_t										*/
+	uint8_t u8Type;					/*<! TRACE_TYPE_x									*/
+	uint16_t u16Arg;				/*<! Event Argument (Opcode, Number of Blocks)		*/
+} trace_event_t;
+
+/**
+ * @brief 	Header of The Dump File, Followed By u32Events trace_event_t In Chronological Order.
+ */
+typedef struct
+{
+	uint32_t u32Magic;				/*<! TRACE_FILE_MAGIC								*/
+	uint16_t u16Version;			/*<! TRACE_FILE_VERSION								*/
+	uint16_t u16EventSize;			/*<! sizeof(trace_event_t)							*/
+	uint32_t u32CoreClockHz;		/*<! DWT Cycle Frequency							*/
+	uint32_t u32Events;				/*<! Number of Events Following The Header			*/
+	uint32_t u32TriggerId;			/*<! trace_id_t of The Spike						*/
+	uint32_t u32TriggerCycles;		/*<! Duration of The Spike In Cycles				*/
+} trace_file_header_t;
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+#if (true == TRACE_ENABLED)
+#define TRACE_BEGIN(id)				TRACE_Event((id), TRACE_TYPE_BEGIN, 0U)
+#define TRACE_BEGIN_ARG(id, arg)	TRACE_Event((id), TRACE_TYPE_BEGIN, (uint16_t)(arg))
+#define TRACE_END(id)				TRACE_Event((id), TRACE_TYPE_END, 0U)
+#else
+#define TRACE_BEGIN(id)
+#define TRACE_BEGIN_ARG(id, arg)
+#define TRACE_END(id)
+#endif /* (true == TRACE_ENABLED) */
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+/**
+ * @brief 	Converts The Spike Thresholds Into Cycles And Arms The Tracer.
+ * @details DWT Cycle Counter Must Already Run (APP_InitBoard).
+ */
+void TRACE_Init(void);
+
+/**
+ * @brief 	Records One Event, Callable From Tasks And Interrupts.
+ * @details An End Event Longer Than The Threshold of Its Path Triggers The Tracer, The Ring Is Frozen
+ * 			TRACE_POST_TRIGGER_EVENTS Events Later And Kept Till TRACE_Dump.
+ *
+ * @param 	eId Traced Path.
+ * @param 	u8Type TRACE_TYPE_BEGIN or TRACE_TYPE_END.
+ * @param 	u16Arg Event Argument.
+ */
+void TRACE_Event(trace_id_t eId, uint8_t u8Type, uint16_t u16Arg);
+
+/**
+ * @brief 	Triggers The Tracer Manually (e.g. On a Latency Alert).
+ *
+ * @param 	eId Path Reported As The Cause.
+ */
+void TRACE_Trigger(trace_id_t eId);
+
+/**
+ * @brief 	Checks Whether The Ring Holds a Spike Waiting For TRACE_Dump.
+ *
+ * @return 	True If Triggered.
+ */
+bool TRACE_IsTriggered(void);
+
+/**
+ * @brief 	Writes The Ring Into TRACE_FILE And Re-Arms The Tracer.
+ * @details Must Be Called By The Owner of The File System (record_task), Not From an Interrupt.
+ *
+ * @return 	ERROR_NONE If Nothing Was Triggered Or The Dump Succeeded, Otherwise ERROR_OPEN Or ERROR_FILESYSTEM.
+ */
+error_t TRACE_Dump(void);
+
+#endif /* TRACE_H_ */
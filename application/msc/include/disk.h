@@ -30,6 +30,7 @@
 #include "clock_config.h"
 #include "board.h"
 
+#include "FreeRTOS.h"
 #include "semphr.h"
 
 #include "usb_device_dci.h"
@@ -53,11 +54,27 @@
 
 #define USB_DEVICE_INTERRUPT_PRIORITY (3U)
 
-/*! @brief enable the write task. 1U supported, 0U not supported . if this macro is enable ,the \
-USB_DEVICE_CONFIG_USE_TASK macro should also be enable.*/
-#define USB_DEVICE_MSC_USE_WRITE_TASK (0U)
+/*! @brief enable the write task. 1U supported, 0U not supported. If this macro is enabled, host WRITE(10)/(12) data
+ * is queued in USB_DEVICE_MSC_BUFFER_NUMBER rotating buffers and committed to the card by msc_write_task, so the
+ * reception of chunk N+1 overlaps the SD programming of chunk N. All card accesses of the MSC path (reads included)
+ * are then serialized through msc_write_task.*/
+#define USB_DEVICE_MSC_USE_WRITE_TASK (1U)
 #define USB_DEVICE_MSC_BUFFER_NUMBER  (3U)
 
+/*! @brief enable the read-ahead. 1U supported, 0U not supported. Requires USB_DEVICE_MSC_USE_WRITE_TASK. If this macro
+ * is enabled, bulk IN chunks are sent from two ping-pong buffers and msc_write_task fetches the next chunk of a
+ * sequential READ(10)/(12) stream from the card while the current one is transferred to the host.*/
+#define USB_DEVICE_MSC_READ_AHEAD (1U)
+
+/*! @brief enable the sector cache. 1U supported, 0U not supported. Requires USB_DEVICE_MSC_USE_WRITE_TASK. If this
+ * macro is enabled, small host reads (boot sector, FAT, directory clusters) are kept in RAM, so the host re-reading
+ * them while the volume is mounted does not access the card. Host writes invalidate the cached sectors.*/
+#define USB_DEVICE_MSC_SECTOR_CACHE (1U)
+/*! @brief Number of cached 512B sectors. */
+#define USB_DEVICE_MSC_CACHE_SECTORS (32U)
+/*! @brief Only reads of at most this many blocks are cached, larger reads are file data. */
+#define USB_DEVICE_MSC_CACHE_MAX_BLOCKS (8U)
+
 #define LOGICAL_UNIT_SUPPORTED (1U)
 
 /* USB MSC config*/
@@ -67,9 +84,34 @@ USB_DEVICE_CONFIG_USE_TASK macro should also be enable.*/
 #define USB_DEVICE_MSC_WRITE_BUFF_SIZE (512 * 64U)
 #define USB_DEVICE_MSC_READ_BUFF_SIZE  (512 * 64U)
 
+/*! @brief Number of read and write buffers drawn from the DMA region (mem.c) in USB_DeviceModeInit. A write-protected
+ * medium (MSC_CONCURRENT_RECORD_ENABLED) accepts no host data, so it needs no write buffers.*/
+#if (USB_DEVICE_MSC_USE_WRITE_TASK > 0U)
+#define USB_DEVICE_MSC_READ_BUFFERS  (2U)
+#define USB_DEVICE_MSC_WRITE_BUFFERS ((true == MSC_CONCURRENT_RECORD_ENABLED) ? 0U : USB_DEVICE_MSC_BUFFER_NUMBER)
+#else
+#define USB_DEVICE_MSC_READ_BUFFERS  (1U)
+#define USB_DEVICE_MSC_WRITE_BUFFERS (1U)
+#endif /* (USB_DEVICE_MSC_USE_WRITE_TASK > 0U) */
+
 #define USB_DEVICE_SDCARD_BLOCK_SIZE_POWER (9U)
 #define USB_DEVICE_MSC_ADMA_TABLE_WORDS    (8U)
 
+/*! @brief SYNCHRONIZE CACHE(10) operation code, the host uses it to commit the write-back queue to the medium. */
+#define USB_DEVICE_MSC_SYNCHRONIZE_CACHE_COMMAND (0x35U)
+
+/*! @brief Additional sense code WRITE PROTECTED, reported with DATA PROTECT sense key. */
+#define USB_DEVICE_MSC_UFI_ASC_WRITE_PROTECTED (0x27U)
+
+/*! @brief Write Protected bit of the device-specific parameter in the MODE SENSE header. */
+#define USB_DEVICE_MSC_MODE_SENSE_WP_BIT (0x80U)
+
+/*! @brief Minimal amount of data of one read or write burst for which the throughput is reported (in bytes). */
+#define USB_DEVICE_MSC_REPORT_THRESHOLD (1024U * 1024U)
+
+/*! @brief Host idle time after which a read or write burst is finished and reported (in milliseconds). */
+#define USB_DEVICE_MSC_BURST_IDLE_MS (200U)
+
 /*******************************************************************************
  * Structures
  ******************************************************************************/
@@ -90,13 +132,19 @@ typedef struct _usb_msc_struct
     uint8_t diskLock;
     uint8_t read_write_error;
     uint8_t currentConfiguration;
-    uint8_t currentInterfaceAlternateSetting[USB_MSC_INTERFACE_COUNT];
+    uint8_t currentInterfaceAlternateSetting[USB_INTERFACE_COUNT];
     uint8_t speed;
     uint8_t attach;
     uint8_t stop; /* indicates this media keeps stop or not, 1: stop, 0: start */
-    usb_msc_buffer_struct_t *headlist;
-    usb_msc_buffer_struct_t *taillist;
-    usb_msc_buffer_struct_t *transferlist;
+    usb_msc_buffer_struct_t *headlist;     /*!< List of free buffers */
+    usb_msc_buffer_struct_t *taillist;     /*!< Last buffer waiting for write to the card */
+    usb_msc_buffer_struct_t *transferlist; /*!< First buffer waiting for write to the card */
+    volatile uint8_t recvPending;          /*!< Bulk OUT could not be primed, no free buffer was available */
+    volatile uint8_t sendPending;          /*!< Bulk IN data chunk waits for msc_write_task to read it */
+    volatile uint8_t cswPending;           /*!< CSW of WRITE or SYNCHRONIZE CACHE waits for the write queue to drain */
+    volatile uint8_t writeError;           /*!< Queued write failed since the last CSW sent by msc_write_task */
+    volatile uint8_t prefetchPending;      /*!< Next chunk of a sequential read waits for msc_write_task */
+    uint8_t readOnly;                      /*!< Medium is presented write-protected, the recorder owns the card */
 } usb_msc_struct_t;
 
 /*******************************************************************************
@@ -111,4 +159,24 @@ void USB_DeviceIsrEnable(void);
 
 void USB_DeviceModeInit(void);
 
+#if (USB_DEVICE_MSC_USE_WRITE_TASK > 0U)
+/*!
+ * @brief Processes the queued card accesses of the MSC path.
+ *
+ * Commits all received write buffers to the card in order, then sends the held CSW of WRITE or SYNCHRONIZE CACHE, a
+ * pending bulk IN chunk and the read-ahead of the next chunk. Called from msc_write_task whenever the USB ISR
+ * notifies it or the returned time elapses.
+ *
+ * @return Ticks to wait for the next notification, finite while a read or write burst waits to be reported.
+ */
+TickType_t USB_DeviceMscWriteTask(void);
+
+/*!
+ * @brief Checks whether all host writes were committed to the card.
+ *
+ * @return true if no write buffer is waiting or being received.
+ */
+bool USB_DeviceMscWriteQueueEmpty(void);
+#endif /* (USB_DEVICE_MSC_USE_WRITE_TASK > 0U) */
+
 #endif /* __USB_DISK_H__ */
@@ -0,0 +1,123 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      usb_device_cdc_acm.h
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    CDC ACM Function of The Composite USB Device, Streams Recorded Lines To The Host.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           usb_device_cdc_acm.h
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          CDC ACM Function of The Composite USB Device, Streams Recorded Lines To The Host.
+ * ****************************/
+
+#ifndef __USB_DEVICE_CDC_ACM_H__
+#define __USB_DEVICE_CDC_ACM_H__
+
+#include <stdbool.h>
+#include "usb_device_config.h"
+#include "usb.h"
+#include "usb_device.h"
+#include "usb_device_descriptor.h"
+
+#if (USB_DEVICE_CONFIG_CDC_ACM > 0U)
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/*! @brief Number of recorder blocks the stream holds at most. A block arriving while the queue is full is dropped, so
+ * a slow or absent host never stalls recording. */
+#define USB_DEVICE_CDC_STREAM_QUEUE_LENGTH (2U)
+
+/*! @brief CDC class requests handled by the function. */
+#define USB_DEVICE_CDC_SET_LINE_CODING        (0x20U)
+#define USB_DEVICE_CDC_GET_LINE_CODING        (0x21U)
+#define USB_DEVICE_CDC_SET_CONTROL_LINE_STATE (0x22U)
+#define USB_DEVICE_CDC_SEND_BREAK             (0x23U)
+
+/*! @brief Size of the line coding structure (dwDTERate, bCharFormat, bParityType, bDataBits). */
+#define USB_DEVICE_CDC_LINE_CODING_SIZE (7U)
+
+/*! @brief DTR bit of SET_CONTROL_LINE_STATE, set while a terminal has the port open. */
+#define USB_DEVICE_CDC_CONTROL_LINE_DTR (0x01U)
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+/*!
+ * @brief Initializes the endpoints of the CDC function, called on SET_CONFIGURATION.
+ *
+ * @param handle  The USB device handle.
+ * @param speed   Current USB speed.
+ *
+ * @return A USB error code or kStatus_USB_Success.
+ */
+usb_status_t USB_DeviceCdcAcmEndpointsInit(usb_device_handle handle, uint8_t speed);
+
+/*!
+ * @brief De-initializes the endpoints of the CDC function and drops the queued blocks.
+ *
+ * @param handle  The USB device handle.
+ *
+ * @return A USB error code or kStatus_USB_Success.
+ */
+usb_status_t USB_DeviceCdcAcmEndpointsDeinit(usb_device_handle handle);
+
+/*!
+ * @brief Resets the stream state on USB bus reset, all queued blocks are released.
+ */
+void USB_DeviceCdcAcmBusReset(void);
+
+/*!
+ * @brief Handles the class requests of the CDC communications interface.
+ *
+ * @param setup   The setup packet.
+ * @param length  Length of the data stage, updated for IN requests.
+ * @param buffer  Data stage buffer, set for IN requests.
+ *
+ * @return kStatus_USB_Success or kStatus_USB_InvalidRequest.
+ */
+usb_status_t USB_DeviceCdcAcmClassRequest(usb_setup_struct_t *setup, uint32_t *length, uint8_t **buffer);
+
+/*!
+ * @brief Checks whether the endpoint belongs to the CDC function.
+ *
+ * @param endpoint Endpoint address including the direction bit.
+ *
+ * @return true for the CDC interrupt and bulk endpoints.
+ */
+bool USB_DeviceCdcAcmIsEndpoint(uint8_t endpoint);
+
+/*!
+ * @brief Queues a recorder block for the host, the block is sent in place (no copy).
+ *
+ * The block must not be refilled while USB_DeviceCdcAcmIsQueued reports it. Callable from task and interrupt context.
+ *
+ * @param pu8Block   Block with timestamped lines.
+ * @param u32Length  Number of valid bytes in the block.
+ *
+ * @return false if the block was dropped (queue full), true if it was queued or nobody listens.
+ */
+bool USB_DeviceCdcAcmStream(const uint8_t *pu8Block, uint32_t u32Length);
+
+/*!
+ * @brief Checks whether the block is still queued or being sent.
+ *
+ * @param pu8Block Block passed to USB_DeviceCdcAcmStream.
+ *
+ * @return true while the block is owned by the USB controller.
+ */
+bool USB_DeviceCdcAcmIsQueued(const uint8_t *pu8Block);
+
+/*!
+ * @brief Gets the number of blocks dropped because the host did not keep up.
+ *
+ * @return Dropped blocks since start-up.
+ */
+uint32_t USB_DeviceCdcAcmGetDropped(void);
+
+#endif /* (USB_DEVICE_CONFIG_CDC_ACM > 0U) */
+#endif /* __USB_DEVICE_CDC_ACM_H__ */
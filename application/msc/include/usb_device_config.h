@@ -44,13 +44,20 @@
 /*! @brief MSC instance count */
 #define USB_DEVICE_CONFIG_MSC 						(1U)
 
+/*! @brief CDC ACM instance count, streams the recorded lines to the host next to MSC (composite device) */
+#define USB_DEVICE_CONFIG_CDC_ACM 					(1U)
+
 /* @} */
 
 /*! @brief Whether device is self power. 1U supported, 0U not supported */
 #define USB_DEVICE_CONFIG_SELF_POWER 				(1U)
 
 /*! @brief How many endpoints are supported in the stack. */
+#if (USB_DEVICE_CONFIG_CDC_ACM > 0U)
+#define USB_DEVICE_CONFIG_ENDPOINTS 				(5U)
+#else
 #define USB_DEVICE_CONFIG_ENDPOINTS 				(4U)
+#endif /* (USB_DEVICE_CONFIG_CDC_ACM > 0U) */
 
 /*! @brief Whether the device task is enabled. */
 #define USB_DEVICE_CONFIG_USE_TASK 					(0U)
@@ -91,8 +98,9 @@
 #define USB_DEVICE_CONFIG_REMOTE_WAKEUP 			(0U)
 #endif
 
-/*! @brief Whether the device detached feature is enabled or not. */
-#define USB_DEVICE_CONFIG_DETACH_ENABLE 			(0U)
+/*! @brief Whether the device detached feature is enabled or not. Enabled, the B-session valid interrupt wakes up
+ * msc_task on attach and detach. */
+#define USB_DEVICE_CONFIG_DETACH_ENABLE 			(1U)
 
 /*! @brief Whether handle the USB bus error. */
 #define USB_DEVICE_CONFIG_ERROR_HANDLING 			(0U)
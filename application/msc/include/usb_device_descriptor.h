@@ -22,7 +22,11 @@
 #define USB_CONFIGURE_COUNT       (1U)
 #define USB_DEVICE_STRING_COUNT   (4U)
 #define USB_DEVICE_LANGUAGE_COUNT (1U)
-#define USB_INTERFACE_COUNT       (1U)
+#if (USB_DEVICE_CONFIG_CDC_ACM > 0U)
+#define USB_INTERFACE_COUNT       (USB_MSC_INTERFACE_COUNT + USB_CDC_INTERFACE_COUNT)
+#else
+#define USB_INTERFACE_COUNT       (USB_MSC_INTERFACE_COUNT)
+#endif /* (USB_DEVICE_CONFIG_CDC_ACM > 0U) */
 
 #define USB_MSC_CONFIGURE_INDEX (1U)
 
@@ -53,9 +57,16 @@
 #define USB_MSC_INTERFACE_ALTERNATE_COUNT (1U)
 #define USB_MSC_INTERFACE_ALTERNATE_0 (0U)
 
+#if (USB_DEVICE_CONFIG_CDC_ACM > 0U)
+/* Miscellaneous device class, the functions are grouped by interface association descriptors */
+#define USB_DEVICE_CLASS    (0xEFU)
+#define USB_DEVICE_SUBCLASS (0x02U)
+#define USB_DEVICE_PROTOCOL (0x01U)
+#else
 #define USB_DEVICE_CLASS    (0x00U)
 #define USB_DEVICE_SUBCLASS (0x00U)
 #define USB_DEVICE_PROTOCOL (0x00U)
+#endif /* (USB_DEVICE_CONFIG_CDC_ACM > 0U) */
 
 #define USB_MSC_CLASS (0x08U)
 /* scsi command set */
@@ -63,6 +74,53 @@
 /* bulk only transport protocol */
 #define USB_MSC_PROTOCOL (0x50U)
 
+#if (USB_DEVICE_CONFIG_CDC_ACM > 0U)
+#define USB_CDC_COMM_INTERFACE_INDEX (1U)
+#define USB_CDC_DATA_INTERFACE_INDEX (2U)
+#define USB_CDC_INTERFACE_COUNT      (2U)
+
+#define USB_CDC_INTERRUPT_IN_ENDPOINT (3U)
+#define USB_CDC_BULK_IN_ENDPOINT      (4U)
+#define USB_CDC_BULK_OUT_ENDPOINT     (4U)
+
+#define HS_CDC_INTERRUPT_IN_PACKET_SIZE (16U)
+#define FS_CDC_INTERRUPT_IN_PACKET_SIZE (16U)
+#define HS_CDC_INTERRUPT_IN_INTERVAL    (0x07U) /* 2^(7-1) x 125us = 8ms */
+#define FS_CDC_INTERRUPT_IN_INTERVAL    (0x08U) /* 8ms */
+#define HS_CDC_BULK_PACKET_SIZE         (512U)
+#define FS_CDC_BULK_PACKET_SIZE         (64U)
+
+/* communications interface, abstract control model, no AT commands */
+#define USB_CDC_COMM_CLASS    (0x02U)
+#define USB_CDC_ACM_SUBCLASS  (0x02U)
+#define USB_CDC_COMM_PROTOCOL (0x00U)
+/* data interface */
+#define USB_CDC_DATA_CLASS    (0x0AU)
+#define USB_CDC_DATA_SUBCLASS (0x00U)
+#define USB_CDC_DATA_PROTOCOL (0x00U)
+
+#define USB_DESCRIPTOR_TYPE_CDC_CS_INTERFACE (0x24U)
+#define USB_CDC_HEADER_FUNC_DESC             (0x00U)
+#define USB_CDC_CALL_MANAGEMENT_FUNC_DESC    (0x01U)
+#define USB_CDC_ACM_FUNC_DESC                (0x02U)
+#define USB_CDC_UNION_FUNC_DESC              (0x06U)
+
+#define USB_DESCRIPTOR_LENGTH_IAD                (8U)
+#define USB_DESCRIPTOR_LENGTH_CDC_HEADER         (5U)
+#define USB_DESCRIPTOR_LENGTH_CDC_CALL_MANAGEMENT (5U)
+#define USB_DESCRIPTOR_LENGTH_CDC_ACM            (4U)
+#define USB_DESCRIPTOR_LENGTH_CDC_UNION          (5U)
+
+/* IAD, communications interface with its functional descriptors and one endpoint, data interface with two */
+#define USB_DESCRIPTOR_LENGTH_CDC_FUNCTION                                                                       \
+    (USB_DESCRIPTOR_LENGTH_IAD + USB_DESCRIPTOR_LENGTH_INTERFACE + USB_DESCRIPTOR_LENGTH_CDC_HEADER +            \
+     USB_DESCRIPTOR_LENGTH_CDC_CALL_MANAGEMENT + USB_DESCRIPTOR_LENGTH_CDC_ACM + USB_DESCRIPTOR_LENGTH_CDC_UNION + \
+     USB_DESCRIPTOR_LENGTH_ENDPOINT + USB_DESCRIPTOR_LENGTH_INTERFACE + USB_DESCRIPTOR_LENGTH_ENDPOINT +         \
+     USB_DESCRIPTOR_LENGTH_ENDPOINT)
+#else
+#define USB_DESCRIPTOR_LENGTH_CDC_FUNCTION (0U)
+#endif /* (USB_DEVICE_CONFIG_CDC_ACM > 0U) */
+
 extern usb_status_t USB_DeviceSetSpeed(uint8_t speed);
 extern usb_status_t usb_device_standard_request(usb_setup_struct_t *setup, uint8_t **descriptor, uint32_t *size);
 
@@ -231,6 +231,15 @@ typedef struct _usb_device_mode_parameters_header_struct
     uint8_t reserved[4];     /*!< reserved*/
 } usb_device_mode_parameters_header_struct_t;
 
+/*! @brief  ufi mode parameters header structure of MODE SENSE(6)*/
+typedef struct _usb_device_mode_parameters_header6_struct
+{
+    uint8_t modeDataLength;          /*!< Mode Data Length, bytes following this one*/
+    uint8_t mediumTypeCode;          /*!< The Medium Type Code field specifies the inserted medium type*/
+    uint8_t devicespecificParameter; /*!< WP and DPOFUA bit*/
+    uint8_t blockDescriptorLength;   /*!< Block Descriptor Length*/
+} usb_device_mode_parameters_header6_struct_t;
+
 /*! @brief  ufi Capacity List structure*/
 typedef struct _usb_device_format_capacity_response_data_struct
 {
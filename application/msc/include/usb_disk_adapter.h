@@ -14,6 +14,10 @@
  * Definitions
  ******************************************************************************/
 #define USB_DEVICE_DISK_BLOCK_SIZE_POWER (9U)
+
+/*! @brief Maximal number of blocks the MSC path reads under one lock while the card is shared with recording. Bounds
+ * the time record_task waits for the card to one such read. */
+#define USB_DEVICE_DISK_ARBITRATION_BLOCKS (16U)
 /*******************************************************************************
  * API
  ******************************************************************************/
@@ -32,6 +36,39 @@ void BOARD_USB_Disk_Config(uint32_t usbPriorty);
  */
 uint8_t USB_DeviceDiskStorageInit(void);
 
+/*!
+ * @brief Takes the card for one block operation.
+ *
+ * Serializes the MSC path and FatFs. Not taken in an interrupt (power loss flush) or before the scheduler starts.
+ */
+void USB_Disk_Lock(void);
+
+/*!
+ * @brief Releases the card taken by USB_Disk_Lock.
+ */
+void USB_Disk_Unlock(void);
+
+/*!
+ * @brief Signals that FatFs has written to the card.
+ *
+ * Data the MSC path cached from the card (sector cache, read-ahead) is dropped.
+ */
+void USB_Disk_NotifyWrite(void);
+
+/*!
+ * @brief Gets the counter of FatFs writes.
+ *
+ * @return Value incremented by every USB_Disk_NotifyWrite call.
+ */
+uint32_t USB_Disk_GetWriteGeneration(void);
+
+/*!
+ * @brief Puts the card into the stand-by state (deselected by CMD7) to lower its idle current.
+ *
+ * The card is selected again by the next USB_Disk_Lock, so every card user wakes it up transparently.
+ */
+void USB_Disk_EnterStandby(void);
+
 /*!
  * @brief Writes data blocks to the disk.
  *
@@ -10,12 +10,34 @@
  * Libraries
  ******************************************************************************/
 #include <disk.h>
+#include <string.h>
+#include "defs.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "usb_device_cdc_acm.h"
+#include "trace.h"
+#include "mem.h"
 /*******************************************************************************
  * Definitions
  ******************************************************************************/
 /*! @brief The maximum timeout time for the transfer complete event */
 #define EVENT_TIMEOUT_TRANSFER_COMPLETE (1000U)
 
+#if (USB_DEVICE_MSC_USE_WRITE_TASK > 0U)
+/*! @brief Throughput statistics of one read or write burst */
+typedef struct _usb_msc_burst_struct
+{
+    uint32_t bytes;       /*!< Data transferred since the burst started */
+    TickType_t startTick; /*!< Tick of the first transfer */
+    TickType_t lastTick;  /*!< Tick of the last transfer */
+} usb_msc_burst_struct_t;
+#endif /* (USB_DEVICE_MSC_USE_WRITE_TASK > 0U) */
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+usb_status_t USB_DeviceMscSend(usb_device_msc_struct_t *mscHandle);
+usb_status_t USB_DeviceMscRecv(usb_device_msc_struct_t *mscHandle);
 
 /*******************************************************************************
  * Variables
@@ -40,6 +62,14 @@ usb_device_mode_parameters_header_struct_t g_ModeParametersHeader = {
     0x00,   /*!MODE SENSE command, a Write Protected bit of zero indicates the medium is write enabled*/
     {0x00, 0x00, 0x00, 0x00} /*!<This bit should be set to zero*/
 };
+USB_DMA_INIT_DATA_ALIGN(USB_DATA_ALIGN_SIZE)
+usb_device_mode_parameters_header6_struct_t g_ModeParametersHeader6 = {
+    /*refer to spc mode parameter header of MODE SENSE(6)*/
+    sizeof(usb_device_mode_parameters_header6_struct_t) - 1U, /*!< Mode Data Length*/
+    0x00, /*!<Default medium type (current mounted medium type)*/
+    0x00, /*!<Device-specific parameter, a Write Protected bit of zero indicates the medium is write enabled*/
+    0x00  /*!<No block descriptor*/
+};
 USB_DMA_NONINIT_DATA_ALIGN(USB_DATA_ALIGN_SIZE) usb_device_msc_cbw_t g_mscCbw; /*!< CBW structure */
 USB_DMA_NONINIT_DATA_ALIGN(USB_DATA_ALIGN_SIZE) usb_device_msc_csw_t g_mscCsw; /*!< CSW structure */
 USB_DMA_NONINIT_DATA_ALIGN(USB_DATA_ALIGN_SIZE) usb_device_request_sense_data_struct_t g_requestSense;
@@ -55,9 +85,59 @@ extern usb_msc_struct_t g_msc;
 
 usb_device_msc_struct_t *g_mscHandle = &g_msc.mscStruct;
 
-USB_DMA_NONINIT_DATA_ALIGN(USB_DATA_ALIGN_SIZE) uint32_t g_mscReadRequestBuffer[USB_DEVICE_MSC_READ_BUFF_SIZE >> 2];
+/* Read and write buffers, drawn from the DMA region (mem.c) in USB_DeviceModeInit. They overlap the recorder buffers
+ * unless recording runs while attached. With the write task the read buffers are ping-pong buffers, one is transferred
+ * to the host while the other one is filled from the card */
+uint8_t *g_mscReadRequestBuffer[USB_DEVICE_MSC_READ_BUFFERS];
+uint8_t *g_mscWriteRequestBuffer[USB_DEVICE_MSC_BUFFER_NUMBER];
+
+#if (USB_DEVICE_MSC_USE_WRITE_TASK > 0U)
+/* Descriptors of the rotating write buffers */
+static usb_msc_buffer_struct_t s_mscDataBuffer[USB_DEVICE_MSC_BUFFER_NUMBER];
+
+/* Buffer currently primed on the bulk OUT endpoint */
+static usb_msc_buffer_struct_t *s_mscRecvBuffer = NULL;
+
+/* Data chunk the bulk IN endpoint waits for */
+static usb_device_lba_app_struct_t s_mscSendLba;
+
+/* Index of the read buffer owned by the bulk IN endpoint, the other one holds the read-ahead */
+static uint8_t s_mscSendIndex = 0U;
+
+/* Data chunk fetched (or to be fetched) ahead of the host request */
+static usb_device_lba_app_struct_t s_mscPrefetchLba;
+static volatile uint8_t s_mscPrefetchValid       = 0U;
+static volatile uint32_t s_mscPrefetchGeneration = 0U;
+
+/* First LBA after the last READ command, a command starting there continues a sequential stream */
+static uint32_t s_mscReadNextLba   = 0xFFFFFFFFU;
+static uint8_t s_mscReadSequential = 0U;
 
-USB_DMA_NONINIT_DATA_ALIGN(USB_DATA_ALIGN_SIZE) uint32_t g_mscWriteRequestBuffer[USB_DEVICE_MSC_WRITE_BUFF_SIZE >> 2];
+/* Bytes sent from the read-ahead buffer by the USB ISR, not yet accounted by msc_write_task */
+static volatile uint32_t s_mscReadHitBytes = 0U;
+
+#if (USB_DEVICE_MSC_SECTOR_CACHE > 0U)
+/* Sector cache of the metadata the host re-reads, owned by msc_write_task. Drawn from the SRAM region (mem.c) in
+ * USB_DeviceModeInit, it overlaps the f_mkfs work buffer unless recording runs while attached */
+static uint32_t (*s_mscCacheData)[512U >> 2] = NULL;
+static uint32_t s_mscCacheLba[USB_DEVICE_MSC_CACHE_SECTORS];
+static uint32_t s_mscCacheUse[USB_DEVICE_MSC_CACHE_SECTORS];
+static uint32_t s_mscCacheClock = 0U;
+
+/* Set by the USB ISR on bus reset, the card (and the overlapping memory) may have been changed by recording meanwhile */
+static volatile uint8_t s_mscCacheFlush = 1U;
+
+/* Card write counter of FatFs seen by the last flush check, recording runs while attached */
+static uint32_t s_mscCacheDiskGeneration = 0U;
+#endif /* (USB_DEVICE_MSC_SECTOR_CACHE > 0U) */
+
+/* Throughput statistics of the current read and write burst */
+static usb_msc_burst_struct_t s_mscReadBurst;
+static usb_msc_burst_struct_t s_mscWriteBurst;
+
+/* Task committing the queued writes, created in main.c */
+extern TaskHandle_t g_xMscWriteTaskHandle;
+#endif /* (USB_DEVICE_MSC_USE_WRITE_TASK > 0U) */
 
 USB_DMA_NONINIT_DATA_ALIGN(USB_DATA_ALIGN_SIZE) static uint8_t s_SetupOutBuffer[8];
 
@@ -119,6 +199,648 @@ void USB_DeviceIsrEnable(void)
     EnableIRQ((IRQn_Type)irqNumber);
 }
 
+#if (USB_DEVICE_MSC_USE_WRITE_TASK > 0U)
+/*!
+ * @brief Wakes up msc_write_task from the USB ISR.
+ */
+static void USB_DeviceMscNotifyWriteTask(void)
+{
+    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+    if (NULL != g_xMscWriteTaskHandle)
+    {
+        vTaskNotifyGiveFromISR(g_xMscWriteTaskHandle, &xHigherPriorityTaskWoken);
+        portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+    }
+}
+
+/*!
+ * @brief Masks the USB controller interrupt, so msc_write_task does not race with a bus reset or a transfer cancel.
+ *
+ * @return True if the interrupt was enabled before.
+ */
+static bool USB_DeviceMscIsrMask(void)
+{
+    uint8_t usbDeviceEhciIrq[] = USBHS_IRQS;
+    IRQn_Type irqNumber        = (IRQn_Type)usbDeviceEhciIrq[CONTROLLER_ID - kUSB_ControllerEhci0];
+    bool bEnabled              = (0U != NVIC_GetEnableIRQ(irqNumber));
+
+    (void)DisableIRQ(irqNumber);
+    return bEnabled;
+}
+
+/*!
+ * @brief Restores the USB controller interrupt masked by USB_DeviceMscIsrMask.
+ */
+static void USB_DeviceMscIsrRestore(bool bEnabled)
+{
+    uint8_t usbDeviceEhciIrq[] = USBHS_IRQS;
+
+    if (bEnabled)
+    {
+        (void)EnableIRQ((IRQn_Type)usbDeviceEhciIrq[CONTROLLER_ID - kUSB_ControllerEhci0]);
+    }
+}
+
+/*!
+ * @brief Puts all write buffers to the free list.
+ */
+static void USB_DeviceMscInitQueue(void)
+{
+    uint32_t i;
+
+    g_msc.headlist     = NULL;
+    g_msc.taillist     = NULL;
+    g_msc.transferlist = NULL;
+    g_msc.recvPending  = 0U;
+    g_msc.sendPending  = 0U;
+    g_msc.cswPending   = 0U;
+    g_msc.writeError   = 0U;
+    s_mscRecvBuffer    = NULL;
+
+    g_msc.prefetchPending = 0U;
+    s_mscPrefetchValid    = 0U;
+    s_mscReadNextLba      = 0xFFFFFFFFU;
+    s_mscReadHitBytes     = 0U;
+
+    for (i = 0U; i < USB_DEVICE_MSC_WRITE_BUFFERS; i++)
+    {
+        s_mscDataBuffer[i].buffer = g_mscWriteRequestBuffer[i];
+        s_mscDataBuffer[i].next   = g_msc.headlist;
+        g_msc.headlist            = &s_mscDataBuffer[i];
+    }
+}
+
+/*!
+ * @brief Takes a buffer from the free list.
+ *
+ * @return The free buffer or NULL if all buffers wait for the card.
+ */
+static usb_msc_buffer_struct_t *USB_DeviceMscGetFreeBuffer(void)
+{
+    usb_msc_buffer_struct_t *buffer;
+    OSA_SR_ALLOC();
+
+    OSA_ENTER_CRITICAL();
+    buffer = g_msc.headlist;
+    if (NULL != buffer)
+    {
+        g_msc.headlist = buffer->next;
+        buffer->next   = NULL;
+    }
+    OSA_EXIT_CRITICAL();
+    return buffer;
+}
+
+/*!
+ * @brief Returns a committed buffer to the free list.
+ */
+static void USB_DeviceMscPutFreeBuffer(usb_msc_buffer_struct_t *buffer)
+{
+    OSA_SR_ALLOC();
+
+    OSA_ENTER_CRITICAL();
+    buffer->next   = g_msc.headlist;
+    g_msc.headlist = buffer;
+    OSA_EXIT_CRITICAL();
+}
+
+/*!
+ * @brief Appends a received buffer to the tail of the write queue.
+ */
+static void USB_DeviceMscAddToTransferList(usb_msc_buffer_struct_t *buffer)
+{
+    OSA_SR_ALLOC();
+
+    OSA_ENTER_CRITICAL();
+    buffer->next = NULL;
+    if (NULL == g_msc.taillist)
+    {
+        g_msc.transferlist = buffer;
+    }
+    else
+    {
+        g_msc.taillist->next = buffer;
+    }
+    g_msc.taillist = buffer;
+    OSA_EXIT_CRITICAL();
+}
+
+/*!
+ * @brief Peeks the oldest buffer of the write queue.
+ *
+ * The buffer stays queued until it is committed, so USB_DeviceMscWriteQueueEmpty() does not report an empty queue
+ * while the card is still being programmed.
+ */
+static usb_msc_buffer_struct_t *USB_DeviceMscPeekTransferList(void)
+{
+    usb_msc_buffer_struct_t *buffer;
+    OSA_SR_ALLOC();
+
+    OSA_ENTER_CRITICAL();
+    buffer = g_msc.transferlist;
+    OSA_EXIT_CRITICAL();
+    return buffer;
+}
+
+/*!
+ * @brief Removes the oldest buffer from the write queue.
+ */
+static void USB_DeviceMscRemoveFromTransferList(void)
+{
+    OSA_SR_ALLOC();
+
+    OSA_ENTER_CRITICAL();
+    if (NULL != g_msc.transferlist)
+    {
+        g_msc.transferlist = g_msc.transferlist->next;
+        if (NULL == g_msc.transferlist)
+        {
+            g_msc.taillist = NULL;
+        }
+    }
+    OSA_EXIT_CRITICAL();
+}
+
+/*!
+ * @brief Sends the CSW of the current command.
+ */
+static void USB_DeviceMscSendCsw(usb_device_msc_struct_t *mscHandle)
+{
+    (void)USB_DeviceSendRequest(g_msc.deviceHandle, mscHandle->bulkInEndpoint, (uint8_t *)mscHandle->mscCsw,
+                                USB_DEVICE_MSC_CSW_LENGTH);
+    mscHandle->cswPrimeFlag = 1;
+}
+
+/*!
+ * @brief Reports the throughput of a finished burst.
+ */
+static void USB_DeviceMscReportBurst(usb_msc_burst_struct_t *burst, const char *pcName)
+{
+    uint32_t u32ElapsedMs;
+    uint32_t u32KBps;
+
+    if (burst->bytes >= USB_DEVICE_MSC_REPORT_THRESHOLD)
+    {
+        u32ElapsedMs = (uint32_t)((burst->lastTick - burst->startTick) * portTICK_PERIOD_MS);
+        if (0U == u32ElapsedMs)
+        {
+            u32ElapsedMs = portTICK_PERIOD_MS;
+        }
+        u32KBps = (uint32_t)(((uint64_t)burst->bytes * 1000U) / ((uint64_t)u32ElapsedMs * 1024U));
+#if (true == INFO_ENABLED)
+        PRINTF("INFO: MSC %s %u KB in %u ms (%u.%02u MB/s)\r\n", pcName, burst->bytes / 1024U, u32ElapsedMs,
+               u32KBps / 1024U, ((u32KBps % 1024U) * 100U) / 1024U);
+#else
+        (void)pcName;
+        (void)u32KBps;
+#endif /* (true == INFO_ENABLED) */
+    }
+    burst->bytes = 0U;
+}
+
+/*!
+ * @brief Reports a burst once the host was idle for USB_DEVICE_MSC_BURST_IDLE_MS.
+ */
+static void USB_DeviceMscCheckBurst(usb_msc_burst_struct_t *burst, const char *pcName, TickType_t xNow)
+{
+    if ((0U != burst->bytes) && ((xNow - burst->lastTick) >= pdMS_TO_TICKS(USB_DEVICE_MSC_BURST_IDLE_MS)))
+    {
+        USB_DeviceMscReportBurst(burst, pcName);
+    }
+}
+
+/*!
+ * @brief Adds transferred data to a burst, called from msc_write_task.
+ */
+static void USB_DeviceMscAccountBurst(usb_msc_burst_struct_t *burst, const char *pcName, uint32_t u32Bytes)
+{
+    TickType_t xNow = xTaskGetTickCount();
+
+    USB_DeviceMscCheckBurst(burst, pcName, xNow);
+    if (0U == burst->bytes)
+    {
+        burst->startTick = xNow;
+    }
+    burst->bytes += u32Bytes;
+    burst->lastTick = xNow;
+}
+
+/*!
+ * @brief Drops the read-ahead data overlapping the blocks the host writes.
+ */
+static void USB_DeviceMscInvalidatePrefetch(uint32_t u32Offset, uint32_t u32Size)
+{
+    uint32_t u32Blocks         = u32Size >> USB_DEVICE_SDCARD_BLOCK_SIZE_POWER;
+    uint32_t u32PrefetchBlocks = 0U;
+    OSA_SR_ALLOC();
+
+    OSA_ENTER_CRITICAL();
+    u32PrefetchBlocks = s_mscPrefetchLba.size >> USB_DEVICE_SDCARD_BLOCK_SIZE_POWER;
+    if ((u32Offset < (s_mscPrefetchLba.offset + u32PrefetchBlocks)) &&
+        (s_mscPrefetchLba.offset < (u32Offset + u32Blocks)))
+    {
+        /* A Read-Ahead In Progress Is Dropped When It Completes */
+        s_mscPrefetchGeneration++;
+        s_mscPrefetchValid = 0U;
+    }
+    OSA_EXIT_CRITICAL();
+}
+
+/*!
+ * @brief Requests the read-ahead of the chunk following the one being sent.
+ *
+ * The rest of the current command is always fetched, the data behind its last block only if the command continued
+ * a sequential stream. Must be called before the chunk is sent, the IN completion updates transferRemaining.
+ */
+static void USB_DeviceMscRequestPrefetch(usb_device_msc_struct_t *mscHandle, const usb_device_lba_app_struct_t *lba)
+{
+#if (USB_DEVICE_MSC_READ_AHEAD > 0U)
+    uint32_t u32Offset = lba->offset + (lba->size >> USB_DEVICE_SDCARD_BLOCK_SIZE_POWER);
+    uint32_t u32Size   = mscHandle->transferRemaining - lba->size;
+    OSA_SR_ALLOC();
+
+    if (0U == u32Size)
+    {
+        if (0U == s_mscReadSequential)
+        {
+            return;
+        }
+        u32Size = USB_DEVICE_MSC_READ_BUFF_SIZE;
+    }
+    if (u32Size > USB_DEVICE_MSC_READ_BUFF_SIZE)
+    {
+        u32Size = USB_DEVICE_MSC_READ_BUFF_SIZE;
+    }
+    if (u32Offset >= mscHandle->totalLogicalBlockNumber)
+    {
+        return;
+    }
+    if ((mscHandle->totalLogicalBlockNumber - u32Offset) < (u32Size >> USB_DEVICE_SDCARD_BLOCK_SIZE_POWER))
+    {
+        u32Size = (mscHandle->totalLogicalBlockNumber - u32Offset) << USB_DEVICE_SDCARD_BLOCK_SIZE_POWER;
+    }
+
+    OSA_ENTER_CRITICAL();
+    s_mscPrefetchLba.offset = u32Offset;
+    s_mscPrefetchLba.size   = u32Size;
+    s_mscPrefetchLba.buffer = g_mscReadRequestBuffer[s_mscSendIndex ^ 1U];
+    s_mscPrefetchValid      = 0U;
+    g_msc.prefetchPending   = 1U;
+    OSA_EXIT_CRITICAL();
+#else
+    (void)mscHandle;
+    (void)lba;
+#endif /* (USB_DEVICE_MSC_READ_AHEAD > 0U) */
+}
+
+#if (USB_DEVICE_MSC_SECTOR_CACHE > 0U)
+/*!
+ * @brief Finds the cache slot holding the given block.
+ *
+ * @return The slot index or USB_DEVICE_MSC_CACHE_SECTORS if the block is not cached.
+ */
+static uint32_t USB_DeviceMscCacheFind(uint32_t lba)
+{
+    uint32_t i;
+
+    for (i = 0U; i < USB_DEVICE_MSC_CACHE_SECTORS; i++)
+    {
+        if (lba == s_mscCacheLba[i])
+        {
+            break;
+        }
+    }
+    return i;
+}
+
+/*!
+ * @brief Drops all cached sectors, applies a flush requested by the USB ISR.
+ */
+static void USB_DeviceMscCacheCheckFlush(void)
+{
+    uint32_t i;
+    uint32_t u32DiskGeneration = USB_Disk_GetWriteGeneration();
+
+    /* Recorder Wrote To The Card, Cached Sectors (FAT, Directories) May Be Outdated */
+    if (u32DiskGeneration != s_mscCacheDiskGeneration)
+    {
+        s_mscCacheDiskGeneration = u32DiskGeneration;
+        s_mscCacheFlush          = 1U;
+    }
+
+    if (0U != s_mscCacheFlush)
+    {
+        s_mscCacheFlush = 0U;
+        for (i = 0U; i < USB_DEVICE_MSC_CACHE_SECTORS; i++)
+        {
+            s_mscCacheLba[i] = 0xFFFFFFFFU;
+            s_mscCacheUse[i] = 0U;
+        }
+    }
+}
+
+/*!
+ * @brief Copies the chunk from the cache if all its blocks are cached.
+ *
+ * @return true if the chunk was served from the cache.
+ */
+static bool USB_DeviceMscCacheRead(const usb_device_lba_app_struct_t *lba)
+{
+    uint32_t u32Blocks = lba->size >> USB_DEVICE_SDCARD_BLOCK_SIZE_POWER;
+    uint32_t u32Slot;
+    uint32_t i;
+
+    if ((NULL == s_mscCacheData) || (0U == u32Blocks) || (u32Blocks > USB_DEVICE_MSC_CACHE_MAX_BLOCKS))
+    {
+        return false;
+    }
+    for (i = 0U; i < u32Blocks; i++)
+    {
+        if (USB_DEVICE_MSC_CACHE_SECTORS == USB_DeviceMscCacheFind(lba->offset + i))
+        {
+            return false;
+        }
+    }
+    for (i = 0U; i < u32Blocks; i++)
+    {
+        u32Slot = USB_DeviceMscCacheFind(lba->offset + i);
+        (void)memcpy(&lba->buffer[i << USB_DEVICE_SDCARD_BLOCK_SIZE_POWER], &s_mscCacheData[u32Slot][0], 512U);
+        s_mscCacheUse[u32Slot] = ++s_mscCacheClock;
+    }
+    return true;
+}
+
+/*!
+ * @brief Stores the blocks of a small chunk just read from the card, the least recently used slots are replaced.
+ */
+static void USB_DeviceMscCacheFill(const usb_device_lba_app_struct_t *lba)
+{
+    uint32_t u32Blocks = lba->size >> USB_DEVICE_SDCARD_BLOCK_SIZE_POWER;
+    uint32_t u32Slot;
+    uint32_t i;
+    uint32_t j;
+
+    if ((NULL == s_mscCacheData) || (u32Blocks > USB_DEVICE_MSC_CACHE_MAX_BLOCKS))
+    {
+        return;
+    }
+    for (i = 0U; i < u32Blocks; i++)
+    {
+        u32Slot = USB_DeviceMscCacheFind(lba->offset + i);
+        if (USB_DEVICE_MSC_CACHE_SECTORS == u32Slot)
+        {
+            u32Slot = 0U;
+            for (j = 1U; j < USB_DEVICE_MSC_CACHE_SECTORS; j++)
+            {
+                if (s_mscCacheUse[j] < s_mscCacheUse[u32Slot])
+                {
+                    u32Slot = j;
+                }
+            }
+        }
+        (void)memcpy(&s_mscCacheData[u32Slot][0], &lba->buffer[i << USB_DEVICE_SDCARD_BLOCK_SIZE_POWER], 512U);
+        s_mscCacheLba[u32Slot] = lba->offset + i;
+        s_mscCacheUse[u32Slot] = ++s_mscCacheClock;
+    }
+}
+
+/*!
+ * @brief Drops the cached blocks the host has written.
+ */
+static void USB_DeviceMscCacheInvalidate(uint32_t u32Offset, uint32_t u32Blocks)
+{
+    uint32_t i;
+
+    for (i = 0U; i < USB_DEVICE_MSC_CACHE_SECTORS; i++)
+    {
+        if ((s_mscCacheLba[i] >= u32Offset) && (s_mscCacheLba[i] < (u32Offset + u32Blocks)))
+        {
+            s_mscCacheLba[i] = 0xFFFFFFFFU;
+            s_mscCacheUse[i] = 0U;
+        }
+    }
+}
+#endif /* (USB_DEVICE_MSC_SECTOR_CACHE > 0U) */
+
+/*!
+ * @brief Sends the chunk from the read-ahead buffer if it holds the requested data.
+ *
+ * @return true if the chunk was sent, false if it has to be read from the card.
+ */
+static bool USB_DeviceMscSendPrefetched(usb_device_msc_struct_t *mscHandle, usb_device_lba_app_struct_t *lba)
+{
+    bool bHit = false;
+    OSA_SR_ALLOC();
+
+    OSA_ENTER_CRITICAL();
+    if ((0U != s_mscPrefetchValid) && (lba->offset == s_mscPrefetchLba.offset) && (lba->size <= s_mscPrefetchLba.size))
+    {
+        /* Read-Ahead Buffer Goes To The Bulk IN Endpoint, The Sent One Takes The Next Read-Ahead */
+        s_mscPrefetchValid = 0U;
+        s_mscSendIndex ^= 1U;
+        s_mscReadHitBytes += lba->size;
+        lba->buffer = s_mscPrefetchLba.buffer;
+        bHit        = true;
+    }
+    else if ((0U != g_msc.prefetchPending) && (lba->offset != s_mscPrefetchLba.offset))
+    {
+        /* Host Left The Sequential Stream */
+        g_msc.prefetchPending = 0U;
+    }
+    else
+    {
+    }
+    OSA_EXIT_CRITICAL();
+
+    if (bHit)
+    {
+        USB_DeviceMscRequestPrefetch(mscHandle, lba);
+        (void)USB_DeviceSendRequest(g_msc.deviceHandle, mscHandle->bulkInEndpoint, lba->buffer, lba->size);
+    }
+    return bHit;
+}
+
+/*!
+ * @brief Reads the pending bulk IN chunk from the card and sends it, called from msc_write_task.
+ */
+static void USB_DeviceMscSendPending(usb_device_msc_struct_t *mscHandle)
+{
+    status_t errorCode;
+
+    /* Read-Ahead Completed After The Request Arrived */
+    if (USB_DeviceMscSendPrefetched(mscHandle, &s_mscSendLba))
+    {
+        return;
+    }
+
+    s_mscSendLba.buffer = g_mscReadRequestBuffer[s_mscSendIndex];
+#if (USB_DEVICE_MSC_SECTOR_CACHE > 0U)
+    USB_DeviceMscCacheCheckFlush();
+    /* Boot Sector, FAT and Directories Re-Read By The Host */
+    if (USB_DeviceMscCacheRead(&s_mscSendLba))
+    {
+        errorCode = kStatus_Success;
+    }
+    else
+    {
+        errorCode = USB_Disk_ReadBlocks(s_mscSendLba.buffer, s_mscSendLba.offset,
+                                        s_mscSendLba.size >> USB_DEVICE_SDCARD_BLOCK_SIZE_POWER);
+        if (kStatus_Success == errorCode)
+        {
+            USB_DeviceMscCacheFill(&s_mscSendLba);
+        }
+    }
+#else
+    errorCode = USB_Disk_ReadBlocks(s_mscSendLba.buffer, s_mscSendLba.offset,
+                                    s_mscSendLba.size >> USB_DEVICE_SDCARD_BLOCK_SIZE_POWER);
+#endif /* (USB_DEVICE_MSC_SECTOR_CACHE > 0U) */
+    if (kStatus_Success != errorCode)
+    {
+        g_msc.read_write_error = 1;
+        usb_echo("Read error, error = 0x%x\r\n", errorCode);
+    }
+    else
+    {
+        USB_DeviceMscAccountBurst(&s_mscReadBurst, "Read", s_mscSendLba.size);
+        USB_DeviceMscRequestPrefetch(mscHandle, &s_mscSendLba);
+    }
+    (void)USB_DeviceSendRequest(g_msc.deviceHandle, mscHandle->bulkInEndpoint, s_mscSendLba.buffer,
+                                s_mscSendLba.size);
+}
+
+/*!
+ * @brief Fetches the requested read-ahead chunk from the card, called from msc_write_task.
+ */
+static void USB_DeviceMscPrefetch(void)
+{
+    usb_device_lba_app_struct_t lba;
+    uint32_t u32Generation;
+    uint32_t u32DiskGeneration;
+    status_t errorCode;
+    OSA_SR_ALLOC();
+
+    OSA_ENTER_CRITICAL();
+    /* Queued Writes Go First, The Read-Ahead Must See Their Data */
+    if ((0U == g_msc.prefetchPending) || (NULL != g_msc.transferlist))
+    {
+        OSA_EXIT_CRITICAL();
+        return;
+    }
+    g_msc.prefetchPending = 0U;
+    lba                   = s_mscPrefetchLba;
+    u32Generation         = s_mscPrefetchGeneration;
+    OSA_EXIT_CRITICAL();
+
+    u32DiskGeneration = USB_Disk_GetWriteGeneration();
+    errorCode = USB_Disk_ReadBlocks(lba.buffer, lba.offset, lba.size >> USB_DEVICE_SDCARD_BLOCK_SIZE_POWER);
+
+    OSA_ENTER_CRITICAL();
+    /* Data Overwritten By The Host Or The Recorder Or Superseded By a New Request Meanwhile Is Dropped */
+    if ((kStatus_Success == errorCode) && (u32Generation == s_mscPrefetchGeneration) &&
+        (u32DiskGeneration == USB_Disk_GetWriteGeneration()) && (0U == g_msc.prefetchPending))
+    {
+        s_mscPrefetchValid = 1U;
+    }
+    OSA_EXIT_CRITICAL();
+}
+
+bool USB_DeviceMscWriteQueueEmpty(void)
+{
+    return (NULL == USB_DeviceMscPeekTransferList());
+}
+
+TickType_t USB_DeviceMscWriteTask(void)
+{
+    usb_msc_buffer_struct_t *buffer;
+    uint32_t u32HitBytes;
+    TickType_t xNow;
+    bool bIsrEnabled;
+    OSA_SR_ALLOC();
+
+#if (USB_DEVICE_MSC_SECTOR_CACHE > 0U)
+    USB_DeviceMscCacheCheckFlush();
+#endif /* (USB_DEVICE_MSC_SECTOR_CACHE > 0U) */
+
+    /* Commit Received Buffers In The Order of Reception */
+    while (NULL != (buffer = USB_DeviceMscPeekTransferList()))
+    {
+        if (kStatus_Success !=
+            USB_Disk_WriteBlocks(buffer->buffer, buffer->offset, buffer->size >> USB_DEVICE_SDCARD_BLOCK_SIZE_POWER))
+        {
+            g_msc.read_write_error = 1;
+            g_msc.writeError       = 1U;
+            usb_echo("Write error, LBA = %u\r\n", buffer->offset);
+        }
+#if (USB_DEVICE_MSC_SECTOR_CACHE > 0U)
+        USB_DeviceMscCacheInvalidate(buffer->offset, buffer->size >> USB_DEVICE_SDCARD_BLOCK_SIZE_POWER);
+#endif /* (USB_DEVICE_MSC_SECTOR_CACHE > 0U) */
+        USB_DeviceMscAccountBurst(&s_mscWriteBurst, "Write", buffer->size);
+
+        USB_DeviceMscRemoveFromTransferList();
+        USB_DeviceMscPutFreeBuffer(buffer);
+
+        /* Bulk OUT Waited For a Free Buffer, Prime It Now, The Bus Reset Handler Must Not Run Meanwhile */
+        bIsrEnabled = USB_DeviceMscIsrMask();
+        if (0U != g_msc.recvPending)
+        {
+            g_msc.recvPending = 0U;
+            (void)USB_DeviceMscRecv(g_mscHandle);
+        }
+        USB_DeviceMscIsrRestore(bIsrEnabled);
+    }
+
+    /* WRITE And SYNCHRONIZE CACHE Complete Once All Queued Data Is On The Card, a Failed Write Fails The CSW */
+    bIsrEnabled = USB_DeviceMscIsrMask();
+    if ((0U != g_msc.cswPending) && (NULL == USB_DeviceMscPeekTransferList()))
+    {
+        g_msc.cswPending = 0U;
+        if (0U != g_msc.writeError)
+        {
+            g_msc.writeError                                   = 0U;
+            g_mscHandle->mscCsw->cswStatus                     = USB_DEVICE_MSC_COMMAND_FAILED;
+            g_mscHandle->mscUfi.requestSense->senseKey            = USB_DEVICE_MSC_UFI_MEDIUM_ERROR;
+            g_mscHandle->mscUfi.requestSense->additionalSenseCode = USB_DEVICE_MSC_UFI_WRITE_FAULT;
+        }
+        USB_DeviceMscSendCsw(g_mscHandle);
+    }
+    USB_DeviceMscIsrRestore(bIsrEnabled);
+
+    /* Next Chunk Is Fetched While The Current One Is Transferred To The Host */
+    USB_DeviceMscPrefetch();
+
+    /* Reads Are Served After All Preceding Writes, So The Host Never Reads Stale Data */
+    if ((0U != g_msc.sendPending) && (NULL == USB_DeviceMscPeekTransferList()))
+    {
+        g_msc.sendPending = 0U;
+        USB_DeviceMscSendPending(g_mscHandle);
+        USB_DeviceMscPrefetch();
+    }
+
+    /* Chunks Sent Straight From The Read-Ahead Buffer By The USB ISR */
+    OSA_ENTER_CRITICAL();
+    u32HitBytes       = s_mscReadHitBytes;
+    s_mscReadHitBytes = 0U;
+    OSA_EXIT_CRITICAL();
+    if (0U != u32HitBytes)
+    {
+        USB_DeviceMscAccountBurst(&s_mscReadBurst, "Read", u32HitBytes);
+    }
+
+    xNow = xTaskGetTickCount();
+    if (USB_DeviceMscWriteQueueEmpty() && (0U == g_mscHandle->dataOutFlag))
+    {
+        USB_DeviceMscCheckBurst(&s_mscWriteBurst, "Write", xNow);
+    }
+    USB_DeviceMscCheckBurst(&s_mscReadBurst, "Read", xNow);
+
+    /* Wake Up Again To Report The Bursts Once The Host Goes Idle */
+    return ((0U != s_mscWriteBurst.bytes) || (0U != s_mscReadBurst.bytes)) ?
+               pdMS_TO_TICKS(USB_DEVICE_MSC_BURST_IDLE_MS) :
+               portMAX_DELAY;
+}
+#endif /* (USB_DEVICE_MSC_USE_WRITE_TASK > 0U) */
+
 /*!
  * @brief Send data through a specified endpoint.
  *
@@ -154,7 +876,23 @@ usb_status_t USB_DeviceMscSend(usb_device_msc_struct_t *mscHandle)
     lba.size =
         (mscHandle->transferRemaining > lba.size) ? lba.size : mscHandle->transferRemaining; /* whichever is smaller */
 
-    lba.buffer = (uint8_t *)&g_mscReadRequestBuffer[0];
+#if (USB_DEVICE_MSC_USE_WRITE_TASK > 0U)
+    lba.buffer = NULL;
+    if (mscHandle->currentOffset < (mscHandle->totalLogicalBlockNumber))
+    {
+        if (!USB_DeviceMscSendPrefetched(mscHandle, &lba))
+        {
+            /* The Card May Be Busy With Queued Writes, Let msc_write_task Read The Chunk */
+            s_mscSendLba      = lba;
+            g_msc.sendPending = 1U;
+        }
+        /* On a Read-Ahead Hit msc_write_task Fetches The Next Chunk */
+        USB_DeviceMscNotifyWriteTask();
+        (void)errorCode;
+        return error;
+    }
+#else
+    lba.buffer = g_mscReadRequestBuffer[0];
 
     errorCode = USB_Disk_ReadBlocks(lba.buffer, lba.offset, lba.size >> USB_DEVICE_SDCARD_BLOCK_SIZE_POWER);
 
@@ -166,6 +904,7 @@ usb_status_t USB_DeviceMscSend(usb_device_msc_struct_t *mscHandle)
             error);
         error = kStatus_USB_Error;
     }
+#endif /* (USB_DEVICE_MSC_USE_WRITE_TASK > 0U) */
 
     if (mscHandle->currentOffset < (mscHandle->totalLogicalBlockNumber))
     {
@@ -215,7 +954,22 @@ usb_status_t USB_DeviceMscRecv(usb_device_msc_struct_t *mscHandle)
     lba.size =
         (mscHandle->transferRemaining > lba.size) ? lba.size : mscHandle->transferRemaining; /* whichever is smaller */
 
-    lba.buffer = (uint8_t *)&g_mscWriteRequestBuffer[0];
+#if (USB_DEVICE_MSC_USE_WRITE_TASK > 0U)
+    if (mscHandle->currentOffset < (mscHandle->totalLogicalBlockNumber))
+    {
+        s_mscRecvBuffer = USB_DeviceMscGetFreeBuffer();
+        if (NULL == s_mscRecvBuffer)
+        {
+            /* All Buffers Wait For The Card, msc_write_task Primes The Endpoint Once One Is Committed */
+            g_msc.recvPending = 1U;
+            return error;
+        }
+        s_mscRecvBuffer->offset = lba.offset;
+        lba.buffer              = s_mscRecvBuffer->buffer;
+    }
+#else
+    lba.buffer = g_mscWriteRequestBuffer[0];
+#endif /* (USB_DEVICE_MSC_USE_WRITE_TASK > 0U) */
 
     if (NULL == lba.buffer)
     {
@@ -259,6 +1013,11 @@ usb_status_t USB_DeviceMscLbaTransfer(usb_device_msc_struct_t *mscHandle,
 
     if (direction == USB_IN)
     {
+#if (USB_DEVICE_MSC_USE_WRITE_TASK > 0U)
+        /* A Command Starting Right After The Previous One Continues a Sequential Stream */
+        s_mscReadSequential = (uint8_t)((lba->startingLogicalBlockAddress == s_mscReadNextLba) ? 1U : 0U);
+        s_mscReadNextLba    = lba->startingLogicalBlockAddress + lba->transferNumber;
+#endif /* (USB_DEVICE_MSC_USE_WRITE_TASK > 0U) */
         error = USB_DeviceMscSend(mscHandle);
     }
     else
@@ -268,6 +1027,32 @@ usb_status_t USB_DeviceMscLbaTransfer(usb_device_msc_struct_t *mscHandle,
     return error;
 }
 
+/*!
+ * @brief Rejects WRITE(10)/WRITE(12) of a write-protected medium.
+ *
+ * No data is accepted, the OUT endpoint is stalled by the thirteen cases check and the host gets DATA PROTECT.
+ *
+ * @param mscHandle       The device msc class handle.
+ *
+ * @return A USB error code or kStatus_USB_Success.
+ */
+static usb_status_t USB_DeviceMscUfiRejectWrite(usb_device_msc_struct_t *mscHandle)
+{
+    usb_device_msc_ufi_struct_t *ufi = &mscHandle->mscUfi;
+    usb_status_t error;
+
+    ufi->thirteenCase.deviceExpectedDirection  = USB_OUT;
+    ufi->thirteenCase.deviceExpectedDataLength = 0U;
+    ufi->thirteenCase.buffer                   = NULL;
+    ufi->thirteenCase.lbaSendRecvSelect        = 0U;
+
+    error = USB_DeviceMscUfiThirteenCasesCheck(mscHandle);
+
+    ufi->requestSense->senseKey            = USB_DEVICE_MSC_UFI_DATA_PROTECT;
+    ufi->requestSense->additionalSenseCode = USB_DEVICE_MSC_UFI_ASC_WRITE_PROTECTED;
+    return error;
+}
+
 /*!
  * @brief Process usb msc ufi command.
  *
@@ -314,13 +1099,25 @@ usb_status_t USB_DeviceMscProcessUfiCommand(usb_device_msc_struct_t *mscHandle)
             break;
         case USB_DEVICE_MSC_WRITE_10_COMMAND: /*operation code : 0x2A */
         case USB_DEVICE_MSC_WRITE_12_COMMAND: /*operation code : 0xAA */
-            error = USB_DeviceMscUfiWriteCommand(mscHandle);
+            if (0U != g_msc.readOnly)
+            {
+                error = USB_DeviceMscUfiRejectWrite(mscHandle);
+            }
+            else
+            {
+                error = USB_DeviceMscUfiWriteCommand(mscHandle);
+            }
             break;
         case USB_DEVICE_MSC_PREVENT_ALLOW_MEDIUM_REM_COMMAND: /*operation code :0x1E */
             error = USB_DeviceMscUfiPreventAllowMediumCommand(mscHandle);
             break;
         case USB_DEVICE_MSC_FORMAT_UNIT_COMMAND: /*operation code : 0x04*/
             error = USB_DeviceMscUfiFormatUnitCommand(mscHandle);
+            if (0U != g_msc.readOnly)
+            {
+                ufi->requestSense->senseKey            = USB_DEVICE_MSC_UFI_DATA_PROTECT;
+                ufi->requestSense->additionalSenseCode = USB_DEVICE_MSC_UFI_ASC_WRITE_PROTECTED;
+            }
             break;
         case USB_DEVICE_MSC_READ_CAPACITY_10_COMMAND: /*operation code : 0x25*/
         case USB_DEVICE_MSC_READ_CAPACITY_16_COMMAND: /*operation code : 0x9E*/
@@ -328,6 +1125,10 @@ usb_status_t USB_DeviceMscProcessUfiCommand(usb_device_msc_struct_t *mscHandle)
             break;
         case USB_DEVICE_MSC_MODE_SENSE_10_COMMAND: /* operation code :0x5A*/
         case USB_DEVICE_MSC_MODE_SENSE_6_COMMAND:  /* operation code : 0x1A */
+            /* Write Protect Bit Is In The Device-Specific Parameter of Both Headers, The Medium Type Stays 0 */
+            g_ModeParametersHeader6.devicespecificParameter =
+                (0U != g_msc.readOnly) ? USB_DEVICE_MSC_MODE_SENSE_WP_BIT : 0x00U;
+            g_ModeParametersHeader.wpDpfua = g_ModeParametersHeader6.devicespecificParameter;
             error = USB_DeviceMscUfiModeSenseCommand(mscHandle);
             break;
         case USB_DEVICE_MSC_MODE_SELECT_10_COMMAND: /*operation code : 0x55 */
@@ -343,6 +1144,15 @@ usb_status_t USB_DeviceMscProcessUfiCommand(usb_device_msc_struct_t *mscHandle)
         case USB_DEVICE_MSC_VERIFY_COMMAND: /*operation code : 0x2F*/
             error = USB_DeviceMscUfiVerifyCommand(mscHandle);
             break;
+        case USB_DEVICE_MSC_SYNCHRONIZE_CACHE_COMMAND: /*operation code : 0x35*/
+            error = USB_DeviceMscUfiTestUnitReadyCommand(mscHandle);
+#if (USB_DEVICE_MSC_USE_WRITE_TASK > 0U)
+            if (USB_DEVICE_MSC_COMMAND_PASSED == mscHandle->mscCsw->cswStatus)
+            {
+                g_msc.cswPending = 1U;
+            }
+#endif /* (USB_DEVICE_MSC_USE_WRITE_TASK > 0U) */
+            break;
         case USB_DEVICE_MSC_START_STOP_UNIT_COMMAND:            /*operation code : 0x1B*/
             if (0x00U == (mscHandle->mscCbw->cbwcb[4] & 0x01U)) /* check start bit */
             {
@@ -454,6 +1264,8 @@ usb_status_t USB_DeviceMscBulkIn(usb_device_handle deviceHandle,
     }
     else if ((event->length == USB_DEVICE_MSC_CSW_LENGTH) && (csw->signature == USB_DEVICE_MSC_DCSWSIGNATURE))
     {
+        /* CSW Delivered, The Command Is Complete */
+        TRACE_END(TRACE_ID_MSC_CMD);
         mscHandle->cbwValidFlag = 1;
         mscHandle->cswPrimeFlag = 0;
 #if (defined(USB_DEVICE_CONFIG_RETURN_VALUE_CHECK) && (USB_DEVICE_CONFIG_RETURN_VALUE_CHECK > 0U))
@@ -492,6 +1304,13 @@ usb_status_t USB_DeviceMscBulkOut(usb_device_handle deviceHandle,
     /* endpoint callback length is USB_CANCELLED_TRANSFER_LENGTH (0xFFFFFFFFU) when transfer is canceled */
     if (event->length == USB_CANCELLED_TRANSFER_LENGTH)
     {
+#if (USB_DEVICE_MSC_USE_WRITE_TASK > 0U)
+        if (NULL != s_mscRecvBuffer)
+        {
+            USB_DeviceMscPutFreeBuffer(s_mscRecvBuffer);
+            s_mscRecvBuffer = NULL;
+        }
+#endif /* (USB_DEVICE_MSC_USE_WRITE_TASK > 0U) */
 
         if ((mscHandle->cbwPrimeFlag == 0) && (mscHandle->inEndpointStallFlag == 0) &&
             (mscHandle->outEndpointStallFlag == 0))
@@ -521,6 +1340,24 @@ usb_status_t USB_DeviceMscBulkOut(usb_device_handle deviceHandle,
 
     if (mscHandle->dataOutFlag)
     {
+#if (USB_DEVICE_MSC_USE_WRITE_TASK > 0U)
+        /*queue the data for msc_write_task, the next chunk is received while this one is written*/
+        if (NULL != s_mscRecvBuffer)
+        {
+            if (0 != event->length)
+            {
+                s_mscRecvBuffer->size = event->length;
+                USB_DeviceMscInvalidatePrefetch(s_mscRecvBuffer->offset, s_mscRecvBuffer->size);
+                USB_DeviceMscAddToTransferList(s_mscRecvBuffer);
+                USB_DeviceMscNotifyWriteTask();
+            }
+            else
+            {
+                USB_DeviceMscPutFreeBuffer(s_mscRecvBuffer);
+            }
+            s_mscRecvBuffer = NULL;
+        }
+#else
         /*write the data to sd card*/
         if (0 != event->length)
         {
@@ -535,6 +1372,7 @@ usb_status_t USB_DeviceMscBulkOut(usb_device_handle deviceHandle,
                 error = kStatus_USB_Error;
             }
         }
+#endif /* (USB_DEVICE_MSC_USE_WRITE_TASK > 0U) */
 
         if (mscHandle->transferRemaining)
         {
@@ -545,11 +1383,17 @@ usb_status_t USB_DeviceMscBulkOut(usb_device_handle deviceHandle,
         if (!mscHandle->transferRemaining)
         {
             mscHandle->dataOutFlag = 0;
+#if (USB_DEVICE_MSC_USE_WRITE_TASK > 0U)
+            /*CSW of WRITE is sent by msc_write_task once its data is on the card, so the host sees a failed write*/
+            g_msc.cswPending = 1U;
+            USB_DeviceMscNotifyWriteTask();
+#else
             {
                 USB_DeviceSendRequest(g_msc.deviceHandle, mscHandle->bulkInEndpoint, (uint8_t *)mscHandle->mscCsw,
                                       USB_DEVICE_MSC_CSW_LENGTH);
                 mscHandle->cswPrimeFlag = 1;
             }
+#endif /* (USB_DEVICE_MSC_USE_WRITE_TASK > 0U) */
         }
     }
     else if ((mscHandle->cbwValidFlag) && (event->length == USB_DEVICE_MSC_CBW_LENGTH) &&
@@ -584,6 +1428,7 @@ usb_status_t USB_DeviceMscBulkOut(usb_device_handle deviceHandle,
             error = kStatus_USB_Error;
             return error;
         }
+        TRACE_BEGIN_ARG(TRACE_ID_MSC_CMD, mscHandle->mscCbw->cbwcb[0]);
         error = USB_DeviceMscProcessUfiCommand(mscHandle);
         if (error == kStatus_USB_InvalidRequest)
         {
@@ -609,6 +1454,14 @@ usb_status_t USB_DeviceMscBulkOut(usb_device_handle deviceHandle,
             mscHandle->stallStatus = (uint8_t)USB_DEVICE_MSC_STALL_IN_DATA;
         }
 
+#if (USB_DEVICE_MSC_USE_WRITE_TASK > 0U)
+        if (0U != g_msc.cswPending)
+        {
+            /*CSW of SYNCHRONIZE CACHE is sent by msc_write_task once the write queue is drained*/
+            USB_DeviceMscNotifyWriteTask();
+        }
+        else
+#endif /* (USB_DEVICE_MSC_USE_WRITE_TASK > 0U) */
         if (!((mscHandle->dataOutFlag) || ((mscHandle->dataInFlag) || (mscHandle->needInStallFlag))))
         {
             USB_DeviceSendRequest(g_msc.deviceHandle, mscHandle->bulkInEndpoint, (uint8_t *)mscHandle->mscCsw,
@@ -732,6 +1585,28 @@ usb_status_t USB_DeviceCallback(usb_device_handle handle, uint32_t event, void *
             g_msc.attach = 0;
             g_msc.stop   = 0U;
             error        = kStatus_USB_Success;
+#if (USB_DEVICE_CONFIG_CDC_ACM > 0U)
+            USB_DeviceCdcAcmBusReset();
+#endif /* (USB_DEVICE_CONFIG_CDC_ACM > 0U) */
+#if (USB_DEVICE_MSC_USE_WRITE_TASK > 0U)
+            /* Buffer Primed Before The Reset Will Never Be Completed */
+            if (NULL != s_mscRecvBuffer)
+            {
+                USB_DeviceMscPutFreeBuffer(s_mscRecvBuffer);
+                s_mscRecvBuffer = NULL;
+            }
+            g_msc.recvPending     = 0U;
+            g_msc.sendPending     = 0U;
+            g_msc.cswPending      = 0U;
+            g_msc.prefetchPending = 0U;
+            s_mscPrefetchValid    = 0U;
+            s_mscPrefetchGeneration++;
+            s_mscReadNextLba = 0xFFFFFFFFU;
+#if (USB_DEVICE_MSC_SECTOR_CACHE > 0U)
+            /* Recording May Have Changed The Card Since The Last Session */
+            s_mscCacheFlush = 1U;
+#endif /* (USB_DEVICE_MSC_SECTOR_CACHE > 0U) */
+#endif /* (USB_DEVICE_MSC_USE_WRITE_TASK > 0U) */
 
             /* Get USB speed to configure the device, including max packet size and interval of the endpoints. */
             if (kStatus_USB_Success == USB_DeviceGetStatus(g_msc.deviceHandle, kUSB_DeviceStatusSpeed, &g_msc.speed))
@@ -741,8 +1616,10 @@ usb_status_t USB_DeviceCallback(usb_device_handle handle, uint32_t event, void *
         }
             break;
 #if (defined(USB_DEVICE_CONFIG_DETACH_ENABLE) && (USB_DEVICE_CONFIG_DETACH_ENABLE > 0U))
+        case kUSB_DeviceEventAttach:
         case kUSB_DeviceEventDetach:
         {
+            /* msc_task is notified by USB1_HS_IRQHandler */
             error = kStatus_USB_Success;
         }
         break;
@@ -755,6 +1632,9 @@ usb_status_t USB_DeviceCallback(usb_device_handle handle, uint32_t event, void *
             if (g_msc.currentConfiguration)
             {
                 USB_DeviceMscEndpointsDeinit();
+#if (USB_DEVICE_CONFIG_CDC_ACM > 0U)
+                (void)USB_DeviceCdcAcmEndpointsDeinit(g_msc.deviceHandle);
+#endif /* (USB_DEVICE_CONFIG_CDC_ACM > 0U) */
             }
             g_msc.currentConfiguration = *temp8;
             error                      = kStatus_USB_Success;
@@ -764,6 +1644,9 @@ usb_status_t USB_DeviceCallback(usb_device_handle handle, uint32_t event, void *
                 USB_DeviceRecvRequest(g_msc.deviceHandle, g_mscHandle->bulkOutEndpoint, (uint8_t *)g_mscHandle->mscCbw,
                                       USB_DEVICE_MSC_CBW_LENGTH);
                 g_mscHandle->cbwPrimeFlag = 1;
+#if (USB_DEVICE_CONFIG_CDC_ACM > 0U)
+                (void)USB_DeviceCdcAcmEndpointsInit(g_msc.deviceHandle, g_msc.speed);
+#endif /* (USB_DEVICE_CONFIG_CDC_ACM > 0U) */
 
                 g_msc.attach = 1;
             }
@@ -794,6 +1677,13 @@ usb_status_t USB_DeviceConfigureRemoteWakeup(usb_device_handle handle, uint8_t e
 usb_status_t USB_DeviceConfigureEndpointStatus(usb_device_handle handle, uint8_t ep, uint8_t status)
 {
     usb_status_t error = kStatus_USB_Error;
+#if (USB_DEVICE_CONFIG_CDC_ACM > 0U)
+    /* CDC Endpoints Have No Bulk-Only Transport Recovery */
+    if (USB_DeviceCdcAcmIsEndpoint(ep))
+    {
+        return (0U != status) ? USB_DeviceStallEndpoint(handle, ep) : USB_DeviceUnstallEndpoint(handle, ep);
+    }
+#endif /* (USB_DEVICE_CONFIG_CDC_ACM > 0U) */
     if (status)
     {
         if ((USB_MSC_BULK_IN_ENDPOINT == (ep & USB_ENDPOINT_NUMBER_MASK)) && (ep & 0x80))
@@ -923,6 +1813,12 @@ usb_status_t USB_DeviceProcessClassRequest(usb_device_handle handle,
     {
         return error;
     }
+#if (USB_DEVICE_CONFIG_CDC_ACM > 0U)
+    if (USB_CDC_COMM_INTERFACE_INDEX == setup->wIndex)
+    {
+        return USB_DeviceCdcAcmClassRequest(setup, length, buffer);
+    }
+#endif /* (USB_DEVICE_CONFIG_CDC_ACM > 0U) */
 
     switch (setup->bRequest)
     {
@@ -965,6 +1861,24 @@ usb_status_t USB_DeviceProcessClassRequest(usb_device_handle handle,
 
 void USB_DeviceModeInit(void)
 {
+    uint32_t i;
+
+    /* Drawn Before The Card Is Initialized, So The Layout of The DMA Region Is The Same On Every Boot */
+    for (i = 0U; i < USB_DEVICE_MSC_READ_BUFFERS; i++)
+    {
+        g_mscReadRequestBuffer[i] =
+            (uint8_t *)MEM_Alloc(MEM_REGION_DMA, MEM_OWNER_MSC, USB_DEVICE_MSC_READ_BUFF_SIZE, "MSC Read Buffer");
+    }
+    for (i = 0U; i < USB_DEVICE_MSC_WRITE_BUFFERS; i++)
+    {
+        g_mscWriteRequestBuffer[i] =
+            (uint8_t *)MEM_Alloc(MEM_REGION_DMA, MEM_OWNER_MSC, USB_DEVICE_MSC_WRITE_BUFF_SIZE, "MSC Write Buffer");
+    }
+#if (USB_DEVICE_MSC_SECTOR_CACHE > 0U)
+    s_mscCacheData = (uint32_t (*)[512U >> 2])MEM_Alloc(MEM_REGION_SRAM, MEM_OWNER_MSC,
+                                                        USB_DEVICE_MSC_CACHE_SECTORS * 512U, "MSC Sector Cache");
+#endif /* (USB_DEVICE_MSC_SECTOR_CACHE > 0U) */
+
     USB_DeviceClockInit();
 
     if (kStatus_USB_Success != USB_DeviceDiskStorageInit())
@@ -978,6 +1892,12 @@ void USB_DeviceModeInit(void)
     g_msc.speed                      = USB_SPEED_FULL;
     g_msc.attach                     = 0;
     g_msc.deviceHandle               = NULL;
+#if (true == MSC_CONCURRENT_RECORD_ENABLED)
+    /* Card Is Written By The Recorder, The Host Must Not Modify It */
+    g_msc.readOnly = 1U;
+#else
+    g_msc.readOnly = 0U;
+#endif /* (true == MSC_CONCURRENT_RECORD_ENABLED) */
 
     if (kStatus_USB_Success != USB_DeviceInit(CONTROLLER_ID, USB_DeviceCallback, &g_msc.deviceHandle))
     {
@@ -1018,6 +1938,10 @@ void USB_DeviceModeInit(void)
     g_mscHandle->cbwPrimeFlag = 0;
     g_mscHandle->cswPrimeFlag = 0;
 
+#if (USB_DEVICE_MSC_USE_WRITE_TASK > 0U)
+    USB_DeviceMscInitQueue();
+#endif /* (USB_DEVICE_MSC_USE_WRITE_TASK > 0U) */
+
     USB_DeviceIsrEnable();
 
     /*Add one delay here to make the DP pull down long enough to allow host to detect the previous disconnection.*/
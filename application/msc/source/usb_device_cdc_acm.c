@@ -0,0 +1,303 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      usb_device_cdc_acm.c
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    CDC ACM Function of The Composite USB Device, Streams Recorded Lines To The Host.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           usb_device_cdc_acm.c
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          CDC ACM Function of The Composite USB Device, Streams Recorded Lines To The Host.
+ * ****************************/
+
+#include <string.h>
+#include "usb_device_cdc_acm.h"
+
+#if (USB_DEVICE_CONFIG_CDC_ACM > 0U)
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/*! @brief Endpoint addresses including the direction bit */
+#define USB_CDC_INTERRUPT_IN_ADDRESS \
+    (USB_CDC_INTERRUPT_IN_ENDPOINT | (USB_IN << USB_DESCRIPTOR_ENDPOINT_ADDRESS_DIRECTION_SHIFT))
+#define USB_CDC_BULK_IN_ADDRESS \
+    (USB_CDC_BULK_IN_ENDPOINT | (USB_IN << USB_DESCRIPTOR_ENDPOINT_ADDRESS_DIRECTION_SHIFT))
+#define USB_CDC_BULK_OUT_ADDRESS \
+    (USB_CDC_BULK_OUT_ENDPOINT | (USB_OUT << USB_DESCRIPTOR_ENDPOINT_ADDRESS_DIRECTION_SHIFT))
+
+/*! @brief Block queued for the bulk IN endpoint */
+typedef struct _usb_cdc_stream_entry
+{
+    const uint8_t *block; /*!< Recorder block, sent in place */
+    uint32_t length;      /*!< Valid bytes in the block */
+} usb_cdc_stream_entry_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+/* Line coding reported to the host, the stream does not depend on it: 115200 8N1 */
+USB_DMA_INIT_DATA_ALIGN(USB_DATA_ALIGN_SIZE)
+static uint8_t s_cdcLineCoding[USB_DEVICE_CDC_LINE_CODING_SIZE] = {0x00U, 0xC2U, 0x01U, 0x00U, 0x00U, 0x00U, 0x08U};
+
+/* Data the host sends to the data interface is ignored */
+USB_DMA_NONINIT_DATA_ALIGN(USB_DATA_ALIGN_SIZE) static uint8_t s_cdcRecvBuffer[HS_CDC_BULK_PACKET_SIZE];
+
+/* Queue of recorder blocks, the entry at s_cdcHead is on the bulk IN endpoint */
+static usb_cdc_stream_entry_t s_cdcQueue[USB_DEVICE_CDC_STREAM_QUEUE_LENGTH];
+static volatile uint8_t s_cdcHead  = 0U;
+static volatile uint8_t s_cdcCount = 0U;
+
+static usb_device_handle s_cdcDeviceHandle = NULL;
+static volatile uint8_t s_cdcConfigured    = 0U;
+static volatile uint8_t s_cdcPortOpen      = 0U;
+static volatile uint32_t s_cdcDropped      = 0U;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+/*!
+ * @brief Drops all queued blocks, the recorder may refill them.
+ */
+static void USB_DeviceCdcAcmFlushQueue(void)
+{
+    OSA_SR_ALLOC();
+
+    OSA_ENTER_CRITICAL();
+    s_cdcHead  = 0U;
+    s_cdcCount = 0U;
+    OSA_EXIT_CRITICAL();
+}
+
+/*!
+ * @brief Bulk IN callback, releases the sent block and starts the next one.
+ */
+static usb_status_t USB_DeviceCdcAcmBulkIn(usb_device_handle handle,
+                                           usb_device_endpoint_callback_message_struct_t *message,
+                                           void *callbackParam)
+{
+    usb_cdc_stream_entry_t *entry;
+
+    if ((USB_CANCELLED_TRANSFER_LENGTH == message->length) || (0U == s_cdcCount))
+    {
+        return kStatus_USB_Success;
+    }
+
+    /* Block Sent, Give It Back To The Recorder */
+    s_cdcHead = (uint8_t)((s_cdcHead + 1U) % USB_DEVICE_CDC_STREAM_QUEUE_LENGTH);
+    s_cdcCount--;
+
+    if ((0U != s_cdcCount) && (0U != s_cdcConfigured))
+    {
+        entry = &s_cdcQueue[s_cdcHead];
+        (void)USB_DeviceSendRequest(handle, USB_CDC_BULK_IN_ADDRESS, (uint8_t *)entry->block, entry->length);
+    }
+    return kStatus_USB_Success;
+}
+
+/*!
+ * @brief Bulk OUT callback, data typed in the terminal is discarded.
+ */
+static usb_status_t USB_DeviceCdcAcmBulkOut(usb_device_handle handle,
+                                            usb_device_endpoint_callback_message_struct_t *message,
+                                            void *callbackParam)
+{
+    if ((USB_CANCELLED_TRANSFER_LENGTH != message->length) && (0U != s_cdcConfigured))
+    {
+        (void)USB_DeviceRecvRequest(handle, USB_CDC_BULK_OUT_ADDRESS, s_cdcRecvBuffer, sizeof(s_cdcRecvBuffer));
+    }
+    return kStatus_USB_Success;
+}
+
+/*!
+ * @brief Interrupt IN callback, no notification is ever sent.
+ */
+static usb_status_t USB_DeviceCdcAcmInterruptIn(usb_device_handle handle,
+                                                usb_device_endpoint_callback_message_struct_t *message,
+                                                void *callbackParam)
+{
+    return kStatus_USB_Success;
+}
+
+usb_status_t USB_DeviceCdcAcmEndpointsInit(usb_device_handle handle, uint8_t speed)
+{
+    usb_device_endpoint_init_struct_t epInitStruct;
+    usb_device_endpoint_callback_struct_t epCallback;
+    usb_status_t error;
+
+    s_cdcDeviceHandle = handle;
+
+    epCallback.callbackFn        = USB_DeviceCdcAcmInterruptIn;
+    epCallback.callbackParam     = NULL;
+    epInitStruct.zlt             = 0U;
+    epInitStruct.transferType    = USB_ENDPOINT_INTERRUPT;
+    epInitStruct.endpointAddress = USB_CDC_INTERRUPT_IN_ADDRESS;
+    epInitStruct.interval = (USB_SPEED_HIGH == speed) ? HS_CDC_INTERRUPT_IN_INTERVAL : FS_CDC_INTERRUPT_IN_INTERVAL;
+    epInitStruct.maxPacketSize =
+        (USB_SPEED_HIGH == speed) ? HS_CDC_INTERRUPT_IN_PACKET_SIZE : FS_CDC_INTERRUPT_IN_PACKET_SIZE;
+    error = USB_DeviceInitEndpoint(handle, &epInitStruct, &epCallback);
+
+    /* Recorder Blocks Are Multiples of The Packet Size, The Controller Terminates Them By a Zero Length Packet */
+    epCallback.callbackFn        = USB_DeviceCdcAcmBulkIn;
+    epInitStruct.zlt             = 1U;
+    epInitStruct.interval        = 0U;
+    epInitStruct.transferType    = USB_ENDPOINT_BULK;
+    epInitStruct.endpointAddress = USB_CDC_BULK_IN_ADDRESS;
+    epInitStruct.maxPacketSize   = (USB_SPEED_HIGH == speed) ? HS_CDC_BULK_PACKET_SIZE : FS_CDC_BULK_PACKET_SIZE;
+    if (kStatus_USB_Success == error)
+    {
+        error = USB_DeviceInitEndpoint(handle, &epInitStruct, &epCallback);
+    }
+
+    epCallback.callbackFn        = USB_DeviceCdcAcmBulkOut;
+    epInitStruct.zlt             = 0U;
+    epInitStruct.endpointAddress = USB_CDC_BULK_OUT_ADDRESS;
+    if (kStatus_USB_Success == error)
+    {
+        error = USB_DeviceInitEndpoint(handle, &epInitStruct, &epCallback);
+    }
+
+    USB_DeviceCdcAcmFlushQueue();
+    if (kStatus_USB_Success == error)
+    {
+        s_cdcConfigured = 1U;
+        (void)USB_DeviceRecvRequest(handle, USB_CDC_BULK_OUT_ADDRESS, s_cdcRecvBuffer, sizeof(s_cdcRecvBuffer));
+    }
+    return error;
+}
+
+usb_status_t USB_DeviceCdcAcmEndpointsDeinit(usb_device_handle handle)
+{
+    s_cdcConfigured = 0U;
+    s_cdcPortOpen   = 0U;
+
+    (void)USB_DeviceDeinitEndpoint(handle, USB_CDC_INTERRUPT_IN_ADDRESS);
+    (void)USB_DeviceDeinitEndpoint(handle, USB_CDC_BULK_IN_ADDRESS);
+    (void)USB_DeviceDeinitEndpoint(handle, USB_CDC_BULK_OUT_ADDRESS);
+
+    USB_DeviceCdcAcmFlushQueue();
+    return kStatus_USB_Success;
+}
+
+void USB_DeviceCdcAcmBusReset(void)
+{
+    /* Transfers Primed Before The Reset Are Cancelled By The Controller */
+    s_cdcConfigured = 0U;
+    s_cdcPortOpen   = 0U;
+    USB_DeviceCdcAcmFlushQueue();
+}
+
+usb_status_t USB_DeviceCdcAcmClassRequest(usb_setup_struct_t *setup, uint32_t *length, uint8_t **buffer)
+{
+    usb_status_t error = kStatus_USB_InvalidRequest;
+
+    if (USB_CDC_COMM_INTERFACE_INDEX != setup->wIndex)
+    {
+        return error;
+    }
+
+    switch (setup->bRequest)
+    {
+        case USB_DEVICE_CDC_SET_LINE_CODING:
+            /* Called After The Data Stage, The Data Is In The Class Receive Buffer */
+            if ((NULL != *buffer) && (*length >= USB_DEVICE_CDC_LINE_CODING_SIZE))
+            {
+                (void)memcpy(s_cdcLineCoding, *buffer, USB_DEVICE_CDC_LINE_CODING_SIZE);
+            }
+            error = kStatus_USB_Success;
+            break;
+        case USB_DEVICE_CDC_GET_LINE_CODING:
+            *buffer = s_cdcLineCoding;
+            *length = USB_DEVICE_CDC_LINE_CODING_SIZE;
+            error   = kStatus_USB_Success;
+            break;
+        case USB_DEVICE_CDC_SET_CONTROL_LINE_STATE:
+            /* Stream Only While a Terminal Holds The Port Open */
+            s_cdcPortOpen = (uint8_t)(((setup->wValue & USB_DEVICE_CDC_CONTROL_LINE_DTR) != 0U) ? 1U : 0U);
+            *length       = 0U;
+            error         = kStatus_USB_Success;
+            break;
+        case USB_DEVICE_CDC_SEND_BREAK:
+            *length = 0U;
+            error   = kStatus_USB_Success;
+            break;
+        default:
+            break;
+    }
+    return error;
+}
+
+bool USB_DeviceCdcAcmIsEndpoint(uint8_t endpoint)
+{
+    uint8_t number = endpoint & USB_ENDPOINT_NUMBER_MASK;
+
+    return ((USB_CDC_INTERRUPT_IN_ENDPOINT == number) || (USB_CDC_BULK_IN_ENDPOINT == number) ||
+            (USB_CDC_BULK_OUT_ENDPOINT == number));
+}
+
+bool USB_DeviceCdcAcmStream(const uint8_t *pu8Block, uint32_t u32Length)
+{
+    usb_cdc_stream_entry_t *entry;
+    bool bQueued = true;
+    OSA_SR_ALLOC();
+
+    if ((0U == s_cdcConfigured) || (0U == s_cdcPortOpen) || (0U == u32Length))
+    {
+        /* Nobody Listens */
+        return true;
+    }
+
+    OSA_ENTER_CRITICAL();
+    if (USB_DEVICE_CDC_STREAM_QUEUE_LENGTH <= s_cdcCount)
+    {
+        /* Host Does Not Keep Up, Recording Must Not Wait For It */
+        s_cdcDropped++;
+        bQueued = false;
+    }
+    else
+    {
+        entry         = &s_cdcQueue[(s_cdcHead + s_cdcCount) % USB_DEVICE_CDC_STREAM_QUEUE_LENGTH];
+        entry->block  = pu8Block;
+        entry->length = u32Length;
+        s_cdcCount++;
+        if (1U == s_cdcCount)
+        {
+            /* Endpoint Idle, Start Right Away, Otherwise The Completion Callback Continues With This Entry */
+            (void)USB_DeviceSendRequest(s_cdcDeviceHandle, USB_CDC_BULK_IN_ADDRESS, (uint8_t *)entry->block,
+                                        entry->length);
+        }
+    }
+    OSA_EXIT_CRITICAL();
+
+    return bQueued;
+}
+
+bool USB_DeviceCdcAcmIsQueued(const uint8_t *pu8Block)
+{
+    bool bQueued = false;
+    uint8_t i;
+    OSA_SR_ALLOC();
+
+    OSA_ENTER_CRITICAL();
+    for (i = 0U; i < s_cdcCount; i++)
+    {
+        if (pu8Block == s_cdcQueue[(s_cdcHead + i) % USB_DEVICE_CDC_STREAM_QUEUE_LENGTH].block)
+        {
+            bQueued = true;
+            break;
+        }
+    }
+    OSA_EXIT_CRITICAL();
+
+    return bQueued;
+}
+
+uint32_t USB_DeviceCdcAcmGetDropped(void)
+{
+    return s_cdcDropped;
+}
+#endif /* (USB_DEVICE_CONFIG_CDC_ACM > 0U) */
@@ -25,7 +25,7 @@
  * Variables
  ******************************************************************************/
 uint8_t g_UsbDeviceCurrentConfigure = 0U;
-uint8_t g_UsbDeviceInterface[USB_MSC_INTERFACE_COUNT];
+uint8_t g_UsbDeviceInterface[USB_INTERFACE_COUNT];
 
 USB_DMA_INIT_DATA_ALIGN(USB_DATA_ALIGN_SIZE)
 uint8_t g_UsbDeviceDescriptor[] = {
@@ -57,11 +57,12 @@ uint8_t g_UsbDeviceConfigurationDescriptor[] = {
     USB_DESCRIPTOR_LENGTH_CONFIGURE, /* Size of this descriptor in bytes */
     USB_DESCRIPTOR_TYPE_CONFIGURE,   /* CONFIGURATION Descriptor Type */
     USB_SHORT_GET_LOW(USB_DESCRIPTOR_LENGTH_CONFIGURE + USB_DESCRIPTOR_LENGTH_INTERFACE +
-                      USB_DESCRIPTOR_LENGTH_ENDPOINT + USB_DESCRIPTOR_LENGTH_ENDPOINT),
+                      USB_DESCRIPTOR_LENGTH_ENDPOINT + USB_DESCRIPTOR_LENGTH_ENDPOINT +
+                      USB_DESCRIPTOR_LENGTH_CDC_FUNCTION),
     USB_SHORT_GET_HIGH(USB_DESCRIPTOR_LENGTH_CONFIGURE + USB_DESCRIPTOR_LENGTH_INTERFACE +
-                       USB_DESCRIPTOR_LENGTH_ENDPOINT +
-                       USB_DESCRIPTOR_LENGTH_ENDPOINT), /* Total length of data returned for this configuration. */
-    USB_MSC_INTERFACE_COUNT,                            /* Number of interfaces supported by this configuration */
+                       USB_DESCRIPTOR_LENGTH_ENDPOINT + USB_DESCRIPTOR_LENGTH_ENDPOINT +
+                       USB_DESCRIPTOR_LENGTH_CDC_FUNCTION), /* Total length of data returned for this configuration. */
+    USB_INTERFACE_COUNT,                                /* Number of interfaces supported by this configuration */
     USB_MSC_CONFIGURE_INDEX,                            /* Value to use as an argument to the
                                                                 SetConfiguration() request to select this configuration */
     0U,                                                 /* Index of string descriptor describing this configuration */
@@ -111,8 +112,84 @@ uint8_t g_UsbDeviceConfigurationDescriptor[] = {
                          described by this descriptor. */
     USB_ENDPOINT_BULK, /* This field describes the endpoint's attributes */
     USB_SHORT_GET_LOW(FS_MSC_BULK_OUT_PACKET_SIZE), USB_SHORT_GET_HIGH(FS_MSC_BULK_OUT_PACKET_SIZE),
-    0x00U /*For high-speed bulk/control OUT endpoints, the bInterval must specify the
+    0x00U, /*For high-speed bulk/control OUT endpoints, the bInterval must specify the
          maximum NAK rate of the endpoint. refer to usb spec 9.6.6*/
+
+#if (USB_DEVICE_CONFIG_CDC_ACM > 0U)
+    /* Interface Association Descriptor, binds both CDC interfaces to one function */
+    USB_DESCRIPTOR_LENGTH_IAD,                 /* Size of this descriptor in bytes */
+    USB_DESCRIPTOR_TYPE_INTERFACE_ASSOCIATION, /* INTERFACE ASSOCIATION Descriptor Type */
+    USB_CDC_COMM_INTERFACE_INDEX,              /* The first interface number associated with this function */
+    USB_CDC_INTERFACE_COUNT,                   /* The number of contiguous interfaces associated with this function */
+    USB_CDC_COMM_CLASS,                        /* Class code */
+    USB_CDC_ACM_SUBCLASS,                      /* Subclass code */
+    USB_CDC_COMM_PROTOCOL,                     /* Protocol code */
+    0x00U,                                     /* Index of string descriptor describing this function */
+
+    USB_DESCRIPTOR_LENGTH_INTERFACE, /* Size of this descriptor in bytes */
+    USB_DESCRIPTOR_TYPE_INTERFACE,   /* INTERFACE Descriptor Type */
+    USB_CDC_COMM_INTERFACE_INDEX,    /* Number of this interface. */
+    0x00U,                           /* Value used to select this alternate setting */
+    0x01U,                           /* Number of endpoints used by this interface (excluding endpoint zero). */
+    USB_CDC_COMM_CLASS,              /* Class code (assigned by the USB-IF). */
+    USB_CDC_ACM_SUBCLASS,            /* Subclass code (assigned by the USB-IF). */
+    USB_CDC_COMM_PROTOCOL,           /* Protocol code (assigned by the USB). */
+    0x00U,                           /* Index of string descriptor describing this interface */
+
+    USB_DESCRIPTOR_LENGTH_CDC_HEADER,     /* Size of this descriptor in bytes */
+    USB_DESCRIPTOR_TYPE_CDC_CS_INTERFACE, /* CS_INTERFACE Descriptor Type */
+    USB_CDC_HEADER_FUNC_DESC,             /* Header functional descriptor subtype */
+    0x10U,
+    0x01U, /* USB Class Definitions for Communications the Communication specification version 1.10 */
+
+    USB_DESCRIPTOR_LENGTH_CDC_CALL_MANAGEMENT, /* Size of this descriptor in bytes */
+    USB_DESCRIPTOR_TYPE_CDC_CS_INTERFACE,      /* CS_INTERFACE Descriptor Type */
+    USB_CDC_CALL_MANAGEMENT_FUNC_DESC,         /* Call management functional descriptor subtype */
+    0x00U,                                     /* Device does not handle call management itself */
+    USB_CDC_DATA_INTERFACE_INDEX,              /* Interface number of data class interface */
+
+    USB_DESCRIPTOR_LENGTH_CDC_ACM,        /* Size of this descriptor in bytes */
+    USB_DESCRIPTOR_TYPE_CDC_CS_INTERFACE, /* CS_INTERFACE Descriptor Type */
+    USB_CDC_ACM_FUNC_DESC,                /* Abstract control management functional descriptor subtype */
+    0x02U, /* Supports Set_Line_Coding, Set_Control_Line_State, Get_Line_Coding and Serial_State */
+
+    USB_DESCRIPTOR_LENGTH_CDC_UNION,      /* Size of this descriptor in bytes */
+    USB_DESCRIPTOR_TYPE_CDC_CS_INTERFACE, /* CS_INTERFACE Descriptor Type */
+    USB_CDC_UNION_FUNC_DESC,              /* Union functional descriptor subtype */
+    USB_CDC_COMM_INTERFACE_INDEX,         /* The interface number of the controlling interface */
+    USB_CDC_DATA_INTERFACE_INDEX,         /* Interface number of the subordinate interface */
+
+    USB_DESCRIPTOR_LENGTH_ENDPOINT, /* Size of this descriptor in bytes */
+    USB_DESCRIPTOR_TYPE_ENDPOINT,   /* ENDPOINT Descriptor Type */
+    USB_CDC_INTERRUPT_IN_ENDPOINT | (USB_IN << USB_DESCRIPTOR_ENDPOINT_ADDRESS_DIRECTION_SHIFT),
+    USB_ENDPOINT_INTERRUPT, /* This field describes the endpoint's attributes */
+    USB_SHORT_GET_LOW(FS_CDC_INTERRUPT_IN_PACKET_SIZE), USB_SHORT_GET_HIGH(FS_CDC_INTERRUPT_IN_PACKET_SIZE),
+    FS_CDC_INTERRUPT_IN_INTERVAL, /* Interval for polling endpoint for data transfers */
+
+    USB_DESCRIPTOR_LENGTH_INTERFACE, /* Size of this descriptor in bytes */
+    USB_DESCRIPTOR_TYPE_INTERFACE,   /* INTERFACE Descriptor Type */
+    USB_CDC_DATA_INTERFACE_INDEX,    /* Number of this interface. */
+    0x00U,                           /* Value used to select this alternate setting */
+    0x02U,                           /* Number of endpoints used by this interface (excluding endpoint zero). */
+    USB_CDC_DATA_CLASS,              /* Class code (assigned by the USB-IF). */
+    USB_CDC_DATA_SUBCLASS,           /* Subclass code (assigned by the USB-IF). */
+    USB_CDC_DATA_PROTOCOL,           /* Protocol code (assigned by the USB). */
+    0x00U,                           /* Index of string descriptor describing this interface */
+
+    USB_DESCRIPTOR_LENGTH_ENDPOINT, /* Size of this descriptor in bytes */
+    USB_DESCRIPTOR_TYPE_ENDPOINT,   /* ENDPOINT Descriptor Type */
+    USB_CDC_BULK_IN_ENDPOINT | (USB_IN << USB_DESCRIPTOR_ENDPOINT_ADDRESS_DIRECTION_SHIFT),
+    USB_ENDPOINT_BULK, /* This field describes the endpoint's attributes */
+    USB_SHORT_GET_LOW(FS_CDC_BULK_PACKET_SIZE), USB_SHORT_GET_HIGH(FS_CDC_BULK_PACKET_SIZE),
+    0x00U, /* Useless for bulk in endpoint */
+
+    USB_DESCRIPTOR_LENGTH_ENDPOINT, /* Size of this descriptor in bytes */
+    USB_DESCRIPTOR_TYPE_ENDPOINT,   /* ENDPOINT Descriptor Type */
+    USB_CDC_BULK_OUT_ENDPOINT | (USB_OUT << USB_DESCRIPTOR_ENDPOINT_ADDRESS_DIRECTION_SHIFT),
+    USB_ENDPOINT_BULK, /* This field describes the endpoint's attributes */
+    USB_SHORT_GET_LOW(FS_CDC_BULK_PACKET_SIZE), USB_SHORT_GET_HIGH(FS_CDC_BULK_PACKET_SIZE),
+    0x00U, /* The maximum NAK rate of the endpoint */
+#endif /* (USB_DEVICE_CONFIG_CDC_ACM > 0U) */
 };
 
 USB_DMA_INIT_DATA_ALIGN(USB_DATA_ALIGN_SIZE)
@@ -316,7 +393,7 @@ usb_status_t USB_DeviceGetConfigure(usb_device_handle handle, uint8_t *configure
 /* Set current alternate settting of the interface request */
 usb_status_t USB_DeviceSetInterface(usb_device_handle handle, uint8_t interface, uint8_t alternateSetting)
 {
-    if (interface < USB_MSC_INTERFACE_COUNT)
+    if (interface < USB_INTERFACE_COUNT)
     {
         g_UsbDeviceInterface[interface] = alternateSetting;
         return USB_DeviceCallback(handle, kUSB_DeviceEventSetInterface, &interface);
@@ -326,7 +403,7 @@ usb_status_t USB_DeviceSetInterface(usb_device_handle handle, uint8_t interface,
 /* Get current alternate settting of the interface request */
 usb_status_t USB_DeviceGetInterface(usb_device_handle handle, uint8_t interface, uint8_t *alternateSetting)
 {
-    if (interface < USB_MSC_INTERFACE_COUNT)
+    if (interface < USB_INTERFACE_COUNT)
     {
         *alternateSetting = g_UsbDeviceInterface[interface];
         return kStatus_USB_Success;
@@ -352,6 +429,23 @@ usb_status_t USB_DeviceSetSpeed(uint8_t speed)
     {
         if (descriptorHead->endpoint.bDescriptorType == USB_DESCRIPTOR_TYPE_ENDPOINT)
         {
+#if (USB_DEVICE_CONFIG_CDC_ACM > 0U)
+            if (USB_CDC_INTERRUPT_IN_ENDPOINT == (descriptorHead->endpoint.bEndpointAddress & USB_ENDPOINT_NUMBER_MASK))
+            {
+                descriptorHead->endpoint.bInterval =
+                    (USB_SPEED_HIGH == speed) ? HS_CDC_INTERRUPT_IN_INTERVAL : FS_CDC_INTERRUPT_IN_INTERVAL;
+            }
+            else if (USB_CDC_BULK_IN_ENDPOINT ==
+                     (descriptorHead->endpoint.bEndpointAddress & USB_ENDPOINT_NUMBER_MASK))
+            {
+                /* Bulk IN and OUT of the data interface share the endpoint number */
+                descriptorHead->endpoint.wMaxPacketSize[0] =
+                    USB_SHORT_GET_LOW((USB_SPEED_HIGH == speed) ? HS_CDC_BULK_PACKET_SIZE : FS_CDC_BULK_PACKET_SIZE);
+                descriptorHead->endpoint.wMaxPacketSize[1] =
+                    USB_SHORT_GET_HIGH((USB_SPEED_HIGH == speed) ? HS_CDC_BULK_PACKET_SIZE : FS_CDC_BULK_PACKET_SIZE);
+            }
+            else
+#endif /* (USB_DEVICE_CONFIG_CDC_ACM > 0U) */
             if (USB_SPEED_HIGH == speed)
             {
                 if (((descriptorHead->endpoint.bEndpointAddress & USB_DESCRIPTOR_ENDPOINT_ADDRESS_DIRECTION_MASK) ==
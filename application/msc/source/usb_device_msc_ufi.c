@@ -25,6 +25,7 @@
  ******************************************************************************/
 extern usb_device_inquiry_data_fromat_struct_t g_InquiryInfo;
 extern usb_device_mode_parameters_header_struct_t g_ModeParametersHeader;
+extern usb_device_mode_parameters_header6_struct_t g_ModeParametersHeader6;
 /*******************************************************************************
  * Code
  ******************************************************************************/
@@ -519,10 +520,19 @@ usb_status_t USB_DeviceMscUfiModeSenseCommand(usb_device_msc_struct_t *mscHandle
 
     ufi = &mscHandle->mscUfi;
 
-    ufi->thirteenCase.deviceExpectedDataLength = sizeof(g_ModeParametersHeader);
-    ufi->thirteenCase.deviceExpectedDirection  = USB_IN;
-    ufi->thirteenCase.buffer                   = (uint8_t *)&g_ModeParametersHeader;
-    ufi->thirteenCase.lbaSendRecvSelect        = 0;
+    /* MODE SENSE(6) Has Its Own Shorter Header */
+    if (USB_DEVICE_MSC_MODE_SENSE_6_COMMAND == mscHandle->mscCbw->cbwcb[0])
+    {
+        ufi->thirteenCase.deviceExpectedDataLength = sizeof(g_ModeParametersHeader6);
+        ufi->thirteenCase.buffer                   = (uint8_t *)&g_ModeParametersHeader6;
+    }
+    else
+    {
+        ufi->thirteenCase.deviceExpectedDataLength = sizeof(g_ModeParametersHeader);
+        ufi->thirteenCase.buffer                   = (uint8_t *)&g_ModeParametersHeader;
+    }
+    ufi->thirteenCase.deviceExpectedDirection = USB_IN;
+    ufi->thirteenCase.lbaSendRecvSelect       = 0;
 
     error = USB_DeviceMscUfiThirteenCasesCheck(mscHandle);
     return error;
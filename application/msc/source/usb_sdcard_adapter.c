@@ -9,6 +9,12 @@
 #include "fsl_sd.h"
 #include "sdmmc_config.h"
 #include "fsl_debug_console.h"
+#include "usb_disk_adapter.h"
+#include "defs.h"
+#include "trace.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
 /*******************************************************************************
  * Definitions
  ******************************************************************************/
@@ -25,12 +31,81 @@ sd_card_t g_sd;
 
 sd_card_t *usbDeviceMscSdcard;
 
+/* Arbitrates the card between the MSC path (msc_write_task) and FatFs (record_task) */
+static SemaphoreHandle_t s_diskMutex = NULL;
+static StaticSemaphore_t s_diskMutexBuffer;
+
+/* Incremented on every FatFs write, the MSC path drops its cached card data when it changes */
+static volatile uint32_t s_diskWriteGeneration = 0U;
+
+/* Set while the card is deselected into stand-by state, cleared by the next card access */
+static volatile bool s_diskStandby = false;
+
 /*******************************************************************************
  * Code
  ******************************************************************************/
 void BOARD_USB_Disk_Config(uint8_t usbPriorty)
 {
     BOARD_SD_Config(&g_sd, NULL, (usbPriorty - 1U), NULL);
+    s_diskMutex = xSemaphoreCreateMutexStatic(&s_diskMutexBuffer);
+}
+
+/*!
+ * @brief Checks whether the card lock can be used in the current context.
+ *
+ * The card is not locked before the scheduler starts (mount in initialization) and never from an interrupt.
+ * The emergency task of the power loss flush takes the lock, its priority is inherited by the holder
+ * so the in-flight card transfer completes first.
+ */
+static bool USB_Disk_LockUsable(void)
+{
+    return ((NULL != s_diskMutex) && (0U == xPortIsInsideInterrupt()) &&
+            (taskSCHEDULER_RUNNING == xTaskGetSchedulerState()));
+}
+
+void USB_Disk_Lock(void)
+{
+    if (USB_Disk_LockUsable())
+    {
+        (void)xSemaphoreTake(s_diskMutex, portMAX_DELAY);
+    }
+
+    if (s_diskStandby)
+    {
+        s_diskStandby = false;
+        if (kStatus_Success != SD_SelectCard(&g_sd, true))
+        {
+            PRINTF("ERR: SD Card Wake-Up From Stand-By Failed.\r\n");
+        }
+    }
+}
+
+void USB_Disk_EnterStandby(void)
+{
+    USB_Disk_Lock();
+    if (kStatus_Success == SD_SelectCard(&g_sd, false))
+    {
+        s_diskStandby = true;
+    }
+    USB_Disk_Unlock();
+}
+
+void USB_Disk_Unlock(void)
+{
+    if (USB_Disk_LockUsable())
+    {
+        (void)xSemaphoreGive(s_diskMutex);
+    }
+}
+
+void USB_Disk_NotifyWrite(void)
+{
+    s_diskWriteGeneration++;
+}
+
+uint32_t USB_Disk_GetWriteGeneration(void)
+{
+    return s_diskWriteGeneration;
 }
 
 /*!
@@ -56,12 +131,46 @@ uint8_t USB_DeviceDiskStorageInit(void)
 
 status_t USB_Disk_WriteBlocks(const uint8_t *buffer, uint32_t startBlock, uint32_t blockCount)
 {
-    return SD_WriteBlocks(usbDeviceMscSdcard, buffer, startBlock, blockCount);
+    status_t error;
+
+    USB_Disk_Lock();
+    TRACE_BEGIN_ARG(TRACE_ID_SD_WRITE, blockCount);
+    error = SD_WriteBlocks(usbDeviceMscSdcard, buffer, startBlock, blockCount);
+    TRACE_END(TRACE_ID_SD_WRITE);
+    USB_Disk_Unlock();
+    return error;
 }
 
 status_t USB_Disk_ReadBlocks(uint8_t *buffer, uint32_t startBlock, uint32_t blockCount)
 {
-    return SD_ReadBlocks(usbDeviceMscSdcard, buffer, startBlock, blockCount);
+    status_t error = kStatus_Success;
+#if (true == MSC_CONCURRENT_RECORD_ENABLED)
+    uint32_t count;
+
+    /* The Card Is Shared With Recording, Release It Between Pieces So The Recorder Waits For One Piece At Most */
+    while ((0U != blockCount) && (kStatus_Success == error))
+    {
+        count = (blockCount > USB_DEVICE_DISK_ARBITRATION_BLOCKS) ? USB_DEVICE_DISK_ARBITRATION_BLOCKS : blockCount;
+
+        USB_Disk_Lock();
+        error = SD_ReadBlocks(usbDeviceMscSdcard, buffer, startBlock, count);
+        USB_Disk_Unlock();
+
+        buffer += (count << USB_DEVICE_DISK_BLOCK_SIZE_POWER);
+        startBlock += count;
+        blockCount -= count;
+        if ((0U != blockCount) && USB_Disk_LockUsable())
+        {
+            /* record_task Runs At The Same Priority, Let It Take The Card */
+            taskYIELD();
+        }
+    }
+#else
+    USB_Disk_Lock();
+    error = SD_ReadBlocks(usbDeviceMscSdcard, buffer, startBlock, blockCount);
+    USB_Disk_Unlock();
+#endif /* (true == MSC_CONCURRENT_RECORD_ENABLED) */
+    return error;
 }
 
 uint32_t USB_Disk_GetBlockSize()
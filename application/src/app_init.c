@@ -81,6 +81,10 @@ void APP_InitBoard(void)
 
 #endif /* (true == PWRLOSS_DETECTION_ENABLED) */
 
+    /* Attach FRO 12M To CTIMER1 (FreeRTOS Run-Time Stats Counter) */
+    CLOCK_SetClkDiv(kCLOCK_DivCtimer1Clk, 1u);
+    CLOCK_AttachClk(kFRO12M_to_CTIMER1);
+
 	BOARD_InitPins();
     BOARD_PowerMode_OD();
     BOARD_InitBootClocks();
@@ -101,4 +105,14 @@ void APP_InitBoard(void)
 
     PWRLOSS_DetectionInit();
 #endif /* (true == PWRLOSS_DETECTION_ENABLED) */
+
+#if ((true == SWITCH_LATENCY_ENABLED) || (true == CPU_LOAD_MEASUREMENT_ENABLED) || (true == DIAG_ENABLED) || \
+     (true == TRACE_ENABLED) || (true == PWRLOSS_DETECTION_ENABLED))
+    /* Enable DWT Cycle Counter For Mode-Switch Latency, CPU Load, ISR Time, Tracer And Power Loss Trip-To-Safe */
+    DCB->DEMCR |= DCB_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0UL;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif /* ((true == SWITCH_LATENCY_ENABLED) || ... || (true == TRACE_ENABLED)) */
+
+    TRACE_Init();
 }
@@ -24,6 +24,11 @@
 
 #include "task_switching.h"
 #include "record.h"
+#include "diagnostics.h"
+#include "trace.h"
+#include "pwrloss_det.h"
+#include "dump.h"
+#include "mem.h"
 
 /**
  * MISRA Deviation: Rule 21.10
@@ -70,6 +75,13 @@ static StaticTask_t xTimerTaskTCB;
 static StackType_t uxTimerTaskStack[configTIMER_TASK_STACK_DEPTH];
 /*lint +e9029 */
 
+#if (USB_DEVICE_MSC_USE_WRITE_TASK > 0U)
+/*!
+ * @brief 	msc_task Waits For The Write Queue To Drain, msc_write_task Notifies It (MSC_EVENT_WRITTEN).
+ */
+static volatile bool g_bMscWaitWritten = false;
+#endif /* (USB_DEVICE_MSC_USE_WRITE_TASK > 0U) */
+
 /** @} */ // End of TaskManagement group
 
 /*******************************************************************************
@@ -98,6 +110,11 @@ void msc_task(void *handle)
 		{
         	LED_SignalError();
 		}
+        CONSOLELOG_ReportLatency();
+#if (false == MSC_CONCURRENT_RECORD_ENABLED)
+        /* MSC Buffers Reuse The Recorder Buffers (mem.c) */
+        CONSOLELOG_ReleaseBuffers();
+#endif /* (false == MSC_CONCURRENT_RECORD_ENABLED) */
 
         while (true)
         {
@@ -109,17 +126,78 @@ void msc_task(void *handle)
 #if (true == INFO_ENABLED)
                 PRINTF("INFO: MSC Task Ending - USB Detached\r\n");
 #endif
+#if (USB_DEVICE_MSC_USE_WRITE_TASK > 0U)
+                /* Host Writes Still Queued Must Reach The Card Before Recording Uses It */
+                g_bMscWaitWritten = true;
+                while (!USB_DeviceMscWriteQueueEmpty())
+                {
+                	(void)xTaskNotifyWait(0UL, MSC_EVENT_WRITTEN, NULL, pdMS_TO_TICKS(MSC_WRITTEN_TIMEOUT_MS));
+                }
+                g_bMscWaitWritten = false;
+#endif /* (USB_DEVICE_MSC_USE_WRITE_TASK > 0U) */
+#if (true == SWITCH_LATENCY_ENABLED)
+                CONSOLELOG_StartSwitchMeasure(MSC_GetDetachCycles());
+#endif /* (true == SWITCH_LATENCY_ENABLED) */
                 (void)xSemaphoreGive(g_xSemRecord);
                 break;
             }
 
-            vTaskDelay(pdMS_TO_TICKS(100));
+            /**
+             * Sleep Till USB1_HS ISR Signals Attach/Detach or Class Event,
+             * The USB State Is Re-Checked After Every Wake-Up, The Bits Only Wake The Task.
+             */
+            (void)xTaskNotifyWait(0UL, MSC_EVENT_ALL, NULL, portMAX_DELAY);
         }
     }
 }
 
 
 
+#if (USB_DEVICE_MSC_USE_WRITE_TASK > 0U)
+void msc_write_task(void *handle)
+{
+    TickType_t xBlockTime = portMAX_DELAY;
+
+    while (true)
+    {
+    	/* Wait Here Till USB ISR Queues a Buffer, a Read or SYNCHRONIZE CACHE, or a Burst Is To Be Reported */
+    	(void)ulTaskNotifyTake(pdTRUE, xBlockTime);
+
+    	xBlockTime = USB_DeviceMscWriteTask();
+
+    	/* msc_task Waits On USB Detach Till The Queued Host Writes Are On The Card */
+    	if (g_bMscWaitWritten && USB_DeviceMscWriteQueueEmpty())
+    	{
+    		(void)xTaskNotify(g_xMscTaskHandle, MSC_EVENT_WRITTEN, eSetBits);
+    	}
+    }
+}
+#endif /* (USB_DEVICE_MSC_USE_WRITE_TASK > 0U) */
+
+#if (true == PWRLOSS_DETECTION_ENABLED)
+void emergency_task(void *handle)
+{
+    while (true)
+    {
+    	/* Wait Here Till HSCMP1 ISR Signals Power Loss */
+    	(void)ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+    	/* Preempts Every Task, The Lock Holders Inherit This Priority And Complete Their Transfer */
+    	if (ERROR_NONE != CONSOLELOG_PowerLossDump())
+    	{
+#if (CONTROL_LED_ENABLED == true)
+    		LED_SignalError();
+#endif /* (CONTROL_LED_ENABLED == true) */
+    	}
+
+    	PWRLOSS_ReportTripToSafe();
+
+    	/* Data Are Safe, The Rest of The Hold-Up Writes The Histogram */
+    	CONSOLELOG_ReportLatency();
+    }
+}
+#endif /* (true == PWRLOSS_DETECTION_ENABLED) */
+
 void record_task(void *handle)
 {
     error_t  retVal             = ERROR_UNKNOWN;
@@ -129,6 +207,14 @@ void record_task(void *handle)
     uint32_t u32MaxBytes        = 0UL;
     uint32_t u32FreeSpaceSdCard = 0UL;
     uint32_t u32FreeSpaceLimit  = 0UL;
+    uint32_t u32Events          = 0UL;
+#if (true == CPU_LOAD_MEASUREMENT_ENABLED)
+    uint32_t u32BusyStart       = 0UL;
+    uint64_t u64BusyCycles      = 0ULL;
+    uint64_t u64WindowCycles    = 0ULL;
+    uint32_t u32Load            = 0UL;
+    TickType_t xWindowStart     = 0U;
+#endif /* (true == CPU_LOAD_MEASUREMENT_ENABLED) */
     edma_config_t edmaConfig 	= { 0U };
 
     /* Initialize SD Card and File System */
@@ -157,22 +243,34 @@ void record_task(void *handle)
 		return;
 	}
 
-    if (CONSOLELOG_ReadConfig() != ERROR_NONE)
-    {
-        u32Baudrate = DEFAULT_BAUDRATE;
-        u32FileSize = DEFAULT_MAX_FILESIZE;
-    }
-    else
-    {
-        u32Baudrate = PARSER_GetBaudrate();
-        u32FileSize = PARSER_GetFileSize();
-    }
+    /* Periodic Report of CPU Usage, Stack And Heap Watermarks */
+    DIAG_Init();
+
+    /* Missing or Invalid Keys Keep Their Defaults, The Errors Are Reported By The Parser */
+    (void)CONSOLELOG_ReadConfig();
+    u32Baudrate = PARSER_GetBaudrate();
+    u32FileSize = PARSER_GetFileSize();
+
+    /* Recorder Buffers And Timings From The Configuration, Invalid Layout Falls Back To Defaults */
+    (void)CONSOLELOG_Configure();
+
+#if (true == INFO_ENABLED)
+    /* All Subsystems Have Drawn Their Buffers By Now */
+    MEM_Report();
+#endif /* (true == INFO_ENABLED) */
 
     while (true)
     {
 
     	(void)xSemaphoreTake(g_xSemRecord, portMAX_DELAY);
 
+#if (true == CONFIG_RELOAD_ENABLED)
+		/* The Host May Have Edited The Configuration, The UART Below Is Initialized With The Applied Keys */
+		(void)CONSOLELOG_ReloadConfig();
+		u32Baudrate = PARSER_GetBaudrate();
+		u32FileSize = PARSER_GetFileSize();
+#endif /* (true == CONFIG_RELOAD_ENABLED) */
+
 		UART_Init(u32Baudrate);
 		UART_Enable();
 
@@ -180,17 +278,49 @@ void record_task(void *handle)
 		PRINTF("INFO: UART Initialized for Record Mode\r\n");
 #endif /* (true == INFO_ENABLED) */
 
+		/* Region For The Power Loss Dump, Reserved Again Since The Host May Have Changed The Card */
+		CONSOLELOG_Lock();
+		(void)DUMP_Prepare();
+		CONSOLELOG_Unlock();
+
+#if (true == CPU_LOAD_MEASUREMENT_ENABLED)
+		u64BusyCycles = 0ULL;
+		xWindowStart = xTaskGetTickCount();
+#endif /* (true == CPU_LOAD_MEASUREMENT_ENABLED) */
+
+#if (true == MSC_CONCURRENT_RECORD_ENABLED)
+        /* Recording Continues While USB Is Attached, The Host Gets a Write-Protected View of The Card */
+        while (true)
+#else
         while (kUSB_DeviceNotifyAttach != USB_State(g_msc.deviceHandle))
+#endif /* (true == MSC_CONCURRENT_RECORD_ENABLED) */
         {
-			if (ERROR_NONE != CONSOLELOG_Recording(u32FileSize))
+        	/* Sleep Until LPUART ISR (Line End, FIFO Threshold), Flush Timer or USB Attach Wakes The Task Up */
+        	u32Events = CONSOLELOG_WaitForEvent();
+#if (true == CPU_LOAD_MEASUREMENT_ENABLED)
+        	u32BusyStart = DWT->CYCCNT;
+#endif /* (true == CPU_LOAD_MEASUREMENT_ENABLED) */
+
+        	/* The Power Loss Flush Waits Till This Pass Is Finished */
+        	CONSOLELOG_Lock();
+
+        	/* Always Drain The FIFO, Bytes Received Before The Deadline Belong Into The Flushed Block */
+			retVal = CONSOLELOG_Recording(u32FileSize);
+			/* A Pass Stores One Block, The Flush And USB Attach Need The Whole FIFO In The Blocks */
+			while ((ERROR_NONE == retVal) && (0UL != (u32Events & (RECORD_EVENT_FLUSH | RECORD_EVENT_USB))) &&
+			       !CONSOLELOG_IsFifoEmpty())
 			{
-#if (CONTROL_LED_ENABLED == true)
-				LED_SignalError();
-#endif /* (CONTROL_LED_ENABLED == true) */
-				ERR_HandleError();
+				retVal = CONSOLELOG_Recording(u32FileSize);
 			}
 
-			if (ERROR_NONE != CONSOLELOG_Flush())
+			if ((ERROR_NONE == retVal) && (0UL != (u32Events & RECORD_EVENT_FLUSH)))
+			{
+				retVal = CONSOLELOG_Flush();
+			}
+			CONSOLELOG_Unlock();
+
+			/* Error State Is Entered Without The Lock, So The Power Loss Flush Still Saves The Buffers */
+			if (ERROR_NONE != retVal)
 			{
 #if (CONTROL_LED_ENABLED == true)
 				LED_SignalError();
@@ -198,6 +328,19 @@ void record_task(void *handle)
 				ERR_HandleError();
 			}
 
+			/* record_task Owns The Card While Recording, So The Report File Is Written From Here */
+			if (0UL != (u32Events & RECORD_EVENT_DIAG))
+			{
+				DIAG_Report(true);
+				CONSOLELOG_ReportLatency();
+			}
+
+			/* Trace of a Spike Is Dumped When The Line Went Idle, Not In The Middle of a Burst */
+			if ((0UL != (u32Events & RECORD_EVENT_FLUSH)) && TRACE_IsTriggered())
+			{
+				(void)TRACE_Dump();
+			}
+
 #if (CONTROL_LED_ENABLED == true)
 			u32CurrentBytes = CONSOLELOG_GetTransferedBytes();
 			u32MaxBytes = PARSER_GetMaxBytes();
@@ -223,6 +366,23 @@ void record_task(void *handle)
 			}
 #endif /* (true == CONTROL_LED_ENABLED) */
 
+#if (true == CPU_LOAD_MEASUREMENT_ENABLED)
+			/* Busy Cycles of This Wake-Up Against All Cycles of The Window, Reported In Hundredths of Percent */
+			u64BusyCycles += (uint64_t)(DWT->CYCCNT - u32BusyStart);
+			if ((xTaskGetTickCount() - xWindowStart) >= CPU_LOAD_REPORT_TICKS)
+			{
+				u64WindowCycles = (uint64_t)(xTaskGetTickCount() - xWindowStart) *
+								  (uint64_t)(SystemCoreClock / configTICK_RATE_HZ);
+				u32Load = (uint32_t)((u64BusyCycles * 10000ULL) / u64WindowCycles);
+#if (true == INFO_ENABLED)
+				PRINTF("INFO: record_task CPU Load: %u.%02u %%\r\n", u32Load / 100UL, u32Load % 100UL);
+#else
+				(void)u32Load;
+#endif /* (true == INFO_ENABLED) */
+				u64BusyCycles = 0ULL;
+				xWindowStart = xTaskGetTickCount();
+			}
+#endif /* (true == CPU_LOAD_MEASUREMENT_ENABLED) */
         }
 
 		(void)xSemaphoreGive(g_xSemMassStorage);
@@ -267,3 +427,15 @@ void vApplicationGetTimerTaskMemory(StaticTask_t **ppxTimerTaskTCBBuffer,
     *pulTimerTaskStackSize = (uint32_t)configTIMER_TASK_STACK_DEPTH;
     /*lint +e9029 */
 }
+
+void vApplicationStackOverflowHook(TaskHandle_t xTask, char *pcTaskName)
+{
+	(void)xTask;
+
+	/* Stack Is Already Corrupted, Report The Task And Stop */
+	PRINTF("ERR: Stack Overflow In Task %s\r\n", pcTaskName);
+#if (CONTROL_LED_ENABLED == true)
+	LED_SignalError();
+#endif /* (CONTROL_LED_ENABLED == true) */
+	ERR_HandleError();
+}
@@ -0,0 +1,274 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      diagnostics.c
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Run-Time Statistics, Stack And Heap Watermarks of The Data Logger.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           diagnostics.c
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Run-Time Statistics, Stack And Heap Watermarks of The Data Logger.
+ * ****************************/
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "fsl_ctimer.h"
+#include "fsl_debug_console.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "timers.h"
+#include "ff.h"
+
+#include "diagnostics.h"
+#include "record.h"
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/**
+ * @brief 	CTIMER Instance Used As Run-Time Stats Counter.
+ */
+#define DIAG_CTIMER					CTIMER1
+
+/**
+ * @brief 	Clock of DIAG_CTIMER (FRO 12 MHz, Attached In APP_InitBoard).
+ */
+#define DIAG_CTIMER_CLK_FREQ		CLOCK_GetCTimerClkFreq(1U)
+
+/**
+ * @brief 	Size of One Report Line.
+ */
+#define DIAG_LINE_SIZE				96U
+
+/*******************************************************************************
+ * Global Variables
+ ******************************************************************************/
+#if (true == DIAG_ENABLED)
+volatile uint32_t g_u32DiagIsrCycles = 0UL;
+
+/**
+ * @brief 	Handle of record_task, Notified By The Report Timer.
+ */
+extern TaskHandle_t g_xRecordTaskHandle;
+
+/**
+ * @brief 	Periodic Report Timer.
+ */
+static TimerHandle_t g_xDiagTimer = NULL;
+
+/**
+ * @brief 	Memory of The Static Report Timer.
+ */
+static StaticTimer_t g_xDiagTimerBuffer;
+
+/**
+ * @brief 	Task States Filled By uxTaskGetSystemState.
+ */
+static TaskStatus_t g_axTaskStatus[DIAG_MAX_TASKS];
+
+/**
+ * @brief 	Task Handles And Their Run-Time Counters At The Previous Report.
+ */
+static TaskHandle_t g_axPrevTask[DIAG_MAX_TASKS];
+static uint32_t g_au32PrevRunTime[DIAG_MAX_TASKS];
+
+/**
+ * @brief 	Run-Time Counter, ISR Cycles And Tick Count At The Previous Report.
+ */
+static uint32_t g_u32PrevTotalRunTime = 0UL;
+static uint32_t g_u32PrevIsrCycles = 0UL;
+static TickType_t g_xPrevTick = 0U;
+
+/**
+ * @brief 	Report File, Kept Only For The Time of One Report.
+ */
+static FIL g_diagFile;
+#endif /* (true == DIAG_ENABLED) */
+
+/*******************************************************************************
+ * Static Functions
+ ******************************************************************************/
+#if (true == DIAG_ENABLED)
+/**
+ * @brief 	Report Timer Callback, Runs In Timer Service Task.
+ *
+ * @param 	xTimer Report Timer.
+ */
+static void DIAG_TimerCallback(TimerHandle_t xTimer)
+{
+	(void)xTimer;
+	(void)xTaskNotify(g_xRecordTaskHandle, RECORD_EVENT_DIAG, eSetBits);
+}
+
+/**
+ * @brief 	Computes Share In Hundredths of Percent.
+ *
+ * @param 	u64Part Part.
+ * @param 	u64Whole Whole.
+ *
+ * @return 	Share, 10000 Is 100 %.
+ */
+static uint32_t DIAG_Share(uint64_t u64Part, uint64_t u64Whole)
+{
+	return (0ULL == u64Whole) ? 0UL : (uint32_t)((u64Part * 10000ULL) / u64Whole);
+}
+
+/**
+ * @brief 	Prints One Report Line And Appends It Into The Open Report File.
+ *
+ * @param 	pcLine Line Without Line End.
+ * @param 	bToFile The Report File Is Open.
+ */
+static void DIAG_Emit(const char *pcLine, bool bToFile)
+{
+	UINT bytesWritten;
+
+#if (true == INFO_ENABLED)
+	PRINTF("INFO: %s\r\n", pcLine);
+#endif /* (true == INFO_ENABLED) */
+	if (bToFile)
+	{
+		(void)f_write(&g_diagFile, pcLine, (UINT)strlen(pcLine), &bytesWritten);
+		(void)f_write(&g_diagFile, "\r\n", 2U, &bytesWritten);
+	}
+}
+
+/**
+ * @brief 	Gets The Run-Time Counter of The Task At The Previous Report And Stores The Current One.
+ *
+ * @param 	xHandle Task Handle.
+ * @param 	u32RunTime Current Run-Time Counter of The Task.
+ *
+ * @return 	Run-Time Counter At The Previous Report, 0 For a Task Not Seen Before.
+ */
+static uint32_t DIAG_SwapPrevRunTime(TaskHandle_t xHandle, uint32_t u32RunTime)
+{
+	uint32_t u32Prev = 0UL;
+	uint32_t u32Free = DIAG_MAX_TASKS;
+
+	for (uint32_t i = 0UL; i < DIAG_MAX_TASKS; i++)
+	{
+		if (xHandle == g_axPrevTask[i])
+		{
+			u32Prev = g_au32PrevRunTime[i];
+			g_au32PrevRunTime[i] = u32RunTime;
+			return u32Prev;
+		}
+		if ((NULL == g_axPrevTask[i]) && (DIAG_MAX_TASKS == u32Free))
+		{
+			u32Free = i;
+		}
+	}
+
+	if (DIAG_MAX_TASKS != u32Free)
+	{
+		g_axPrevTask[u32Free] = xHandle;
+		g_au32PrevRunTime[u32Free] = u32RunTime;
+	}
+	return u32Prev;
+}
+#endif /* (true == DIAG_ENABLED) */
+
+/*******************************************************************************
+ * Functions
+ ******************************************************************************/
+void DIAG_InitRunTimeCounter(void)
+{
+	ctimer_config_t config;
+
+	CTIMER_GetDefaultConfig(&config);
+
+	/* Count At DIAG_COUNTER_FREQ_HZ, No Match And No Interrupt, Only The Timer Counter Is Read */
+	config.prescale = (DIAG_CTIMER_CLK_FREQ / DIAG_COUNTER_FREQ_HZ) - 1UL;
+	CTIMER_Init(DIAG_CTIMER, &config);
+	CTIMER_StartTimer(DIAG_CTIMER);
+}
+
+uint32_t DIAG_GetRunTimeCounter(void)
+{
+	return DIAG_CTIMER->TC;
+}
+
+void DIAG_Init(void)
+{
+#if (true == DIAG_ENABLED)
+	if (NULL == g_xDiagTimer)
+	{
+		g_xDiagTimer = xTimerCreateStatic("diag", DIAG_REPORT_TICKS, pdTRUE, NULL,
+										  DIAG_TimerCallback, &g_xDiagTimerBuffer);
+	}
+
+	if ((NULL == g_xDiagTimer) || (pdPASS != xTimerStart(g_xDiagTimer, 0U)))
+	{
+		PRINTF("ERR: Diagnostics Timer Start Failed.\r\n");
+	}
+#endif /* (true == DIAG_ENABLED) */
+}
+
+void DIAG_Report(bool bToFile)
+{
+#if (true == DIAG_ENABLED)
+	char acLine[DIAG_LINE_SIZE];
+	UBaseType_t uxTasks;
+	uint32_t u32TotalRunTime;
+	uint32_t u32Window;
+	uint32_t u32IsrCycles;
+	uint32_t u32Share;
+	uint32_t u32Prev;
+	TickType_t xNow = xTaskGetTickCount();
+
+	uxTasks = uxTaskGetSystemState(g_axTaskStatus, DIAG_MAX_TASKS, &u32TotalRunTime);
+	u32Window = u32TotalRunTime - g_u32PrevTotalRunTime;
+
+	if (bToFile && (FR_OK != f_open(&g_diagFile, DIAG_FILE, (FA_WRITE | FA_OPEN_APPEND))))
+	{
+		PRINTF("ERR: Failed to Open %s.\r\n", DIAG_FILE);
+		bToFile = false;
+	}
+
+	(void)snprintf(acLine, sizeof(acLine), "Diagnostics At %u s, Window %u ms",
+				   (unsigned)(xNow / configTICK_RATE_HZ), (unsigned)(u32Window / (DIAG_COUNTER_FREQ_HZ / 1000UL)));
+	DIAG_Emit(acLine, bToFile);
+
+	/* Per-Task CPU Usage Since The Previous Report, Stack High-Water Mark Since Start-Up */
+	for (UBaseType_t i = 0U; i < uxTasks; i++)
+	{
+		u32Prev  = DIAG_SwapPrevRunTime(g_axTaskStatus[i].xHandle, g_axTaskStatus[i].ulRunTimeCounter);
+		u32Share = DIAG_Share((uint64_t)(g_axTaskStatus[i].ulRunTimeCounter - u32Prev), (uint64_t)u32Window);
+		(void)snprintf(acLine, sizeof(acLine), "Task %-16s CPU %3u.%02u %%, Stack Free %u B",
+					   g_axTaskStatus[i].pcTaskName, (unsigned)(u32Share / 100UL), (unsigned)(u32Share % 100UL),
+					   (unsigned)(g_axTaskStatus[i].usStackHighWaterMark * sizeof(StackType_t)));
+		DIAG_Emit(acLine, bToFile);
+	}
+
+	/* ISR Time Is Accounted To The Interrupted Task By The Kernel, It Is Measured Separately By DWT */
+	u32IsrCycles = g_u32DiagIsrCycles;
+	u32Share = DIAG_Share((uint64_t)(u32IsrCycles - g_u32PrevIsrCycles),
+						  (uint64_t)(xNow - g_xPrevTick) * (uint64_t)(SystemCoreClock / configTICK_RATE_HZ));
+	(void)snprintf(acLine, sizeof(acLine), "ISR (LPUART, USB) CPU %u.%02u %%",
+				   (unsigned)(u32Share / 100UL), (unsigned)(u32Share % 100UL));
+	DIAG_Emit(acLine, bToFile);
+
+	(void)snprintf(acLine, sizeof(acLine), "Heap Free %u B, Minimum Ever Free %u B",
+				   (unsigned)xPortGetFreeHeapSize(), (unsigned)xPortGetMinimumEverFreeHeapSize());
+	DIAG_Emit(acLine, bToFile);
+
+	if (bToFile)
+	{
+		(void)f_close(&g_diagFile);
+	}
+
+	g_u32PrevTotalRunTime 	= u32TotalRunTime;
+	g_u32PrevIsrCycles 		= u32IsrCycles;
+	g_xPrevTick 			= xNow;
+#else
+	(void)bToFile;
+#endif /* (true == DIAG_ENABLED) */
+}
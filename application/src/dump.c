@@ -0,0 +1,645 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      dump.c
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Reserved Emergency Region On The SD Card (Power Loss Dump, Intent Record of The Open Log).
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           dump.c
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Reserved Emergency Region On The SD Card (Power Loss Dump, Intent Record of The Open Log).
+ * ****************************/
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stddef.h>
+#include <string.h>
+#include "fsl_common.h"
+#include "fsl_debug_console.h"
+#include "sdmmc_config.h"
+#include "ff.h"
+#include "diskio.h"
+
+#include "dump.h"
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/**
+ * @brief 	Size of The Region In Bytes.
+ */
+#define DUMP_REGION_BYTES			((FSIZE_t)DUMP_REGION_SECTORS * DUMP_SECTOR_SIZE)
+
+/*******************************************************************************
+ * Global Variables
+ ******************************************************************************/
+/**
+ * @brief 	Header Sector, Aligned For SD DMA. Also Serves As Intent Sector And Read Buffer of The Boot Checks.
+ * @details Run-Time Users (Dump, Intent) Are Serialized By The Record Lock.
+ */
+SDK_ALIGN(static uint8_t g_au8DumpSector[DUMP_SECTOR_SIZE], BOARD_SDMMC_DATA_BUFFER_ALIGN_SIZE);
+
+/**
+ * @brief 	First Sector of The Region (Header), Valid While g_bDumpReady.
+ */
+static LBA_t g_xDumpLba 		= 0U;
+
+/**
+ * @brief 	The Region Is Reserved (g_xDumpLba Valid).
+ */
+static bool g_bDumpReserved 	= false;
+
+/**
+ * @brief 	The Region Is Reserved And The Dump Part Is Not Used Yet.
+ */
+static bool g_bDumpReady 		= false;
+
+/**
+ * @brief 	Intent Record On The Card Is Valid.
+ */
+static bool g_bIntentSet 		= false;
+
+/**
+ * @brief 	Dump of The Last Power Loss Could Not Be Appended, The Region Is Kept Untouched.
+ */
+static bool g_bDumpPending 		= false;
+
+/**
+ * @brief 	Dump File Object.
+ */
+static FIL g_dumpFile;
+
+/*******************************************************************************
+ * Static Functions
+ ******************************************************************************/
+/**
+ * @brief 	Checks The Magic, Version And CRC of The Header.
+ *
+ * @param 	pxHeader Header.
+ *
+ * @return 	True If Valid.
+ */
+static bool DUMP_HeaderValid(const dump_header_t *pxHeader)
+{
+	if ((DUMP_MAGIC != pxHeader->u32Magic) || (DUMP_VERSION != pxHeader->u16Version) ||
+		(DUMP_MAX_REGIONS < pxHeader->u16Regions) || (DUMP_MAX_PIECES < pxHeader->u16Pieces))
+	{
+		return false;
+	}
+	return (pxHeader->u32HeaderCrc ==
+			DUMP_Crc32(0UL, (const uint8_t *)pxHeader, (uint32_t)offsetof(dump_header_t, u32HeaderCrc)));
+}
+
+/**
+ * @brief 	Offset of a Piece In The Dump File.
+ *
+ * @param 	pxHeader Header.
+ * @param 	pxPiece Piece.
+ *
+ * @return 	Offset In Bytes, 0 If The Piece Lies Outside The Region.
+ */
+static FSIZE_t DUMP_PieceOffset(const dump_header_t *pxHeader, const dump_piece_t *pxPiece)
+{
+	uint32_t u32Sector = DUMP_DATA_SECTOR;
+	FSIZE_t xOffset;
+
+	if (pxPiece->u8Region >= pxHeader->u16Regions)
+	{
+		return 0U;
+	}
+	for (uint32_t i = 0UL; i < pxPiece->u8Region; i++)
+	{
+		u32Sector += pxHeader->au16RegionSectors[i];
+	}
+
+	xOffset = ((FSIZE_t)u32Sector * DUMP_SECTOR_SIZE) + pxPiece->u16Offset;
+	return ((xOffset + pxPiece->u16Bytes) <= DUMP_REGION_BYTES) ? xOffset : 0U;
+}
+
+/**
+ * @brief 	Reads The Pieces of The Dump, Verifies Them Or Appends Them To a File.
+ *
+ * @param 	pxHeader Header.
+ * @param 	pxTarget Log File To Append To, NULL Only Computes The CRC.
+ * @param 	pu32Crc CRC of The Pieces.
+ *
+ * @return 	ERROR_NONE On Success.
+ */
+static error_t DUMP_ProcessPieces(const dump_header_t *pxHeader, FIL *pxTarget, uint32_t *pu32Crc)
+{
+	uint32_t u32Crc = 0UL;
+	UINT chunk;
+	UINT bytes;
+
+	for (uint32_t i = 0UL; i < pxHeader->u16Pieces; i++)
+	{
+		const dump_piece_t *pxPiece = &pxHeader->axPieces[i];
+		FSIZE_t xOffset = DUMP_PieceOffset(pxHeader, pxPiece);
+		uint32_t u32Left = pxPiece->u16Bytes;
+
+		if ((0U == xOffset) || (FR_OK != f_lseek(&g_dumpFile, xOffset)))
+		{
+			return ERROR_READ;
+		}
+
+		while (0UL < u32Left)
+		{
+			chunk = (u32Left > DUMP_SECTOR_SIZE) ? DUMP_SECTOR_SIZE : (UINT)u32Left;
+			if ((FR_OK != f_read(&g_dumpFile, g_au8DumpSector, chunk, &bytes)) || (bytes != chunk))
+			{
+				return ERROR_READ;
+			}
+			u32Crc = DUMP_Crc32(u32Crc, g_au8DumpSector, chunk);
+
+			if ((NULL != pxTarget) &&
+				((FR_OK != f_write(pxTarget, g_au8DumpSector, chunk, &bytes)) || (bytes != chunk)))
+			{
+				return ERROR_FILESYSTEM;
+			}
+			u32Left -= chunk;
+		}
+	}
+
+	*pu32Crc = u32Crc;
+	return ERROR_NONE;
+}
+
+/**
+ * @brief 	Reads a FAT Entry Straight From The Card (Boot Check Only, FatFs Window Is Clean After Mount).
+ *
+ * @param 	pxFs File System.
+ * @param 	u32Cluster Cluster.
+ * @param 	pxCached Sector Currently In g_au8DumpSector, Updated.
+ * @param 	pu32Next Value of The Entry.
+ *
+ * @return 	True On Success, False On Read Error Or FAT12.
+ */
+static bool DUMP_GetFat(const FATFS *pxFs, DWORD u32Cluster, LBA_t *pxCached, DWORD *pu32Next)
+{
+	LBA_t xSector;
+	uint32_t u32Offset;
+
+	if (FS_FAT32 == pxFs->fs_type)
+	{
+		xSector 	= pxFs->fatbase + (u32Cluster / (DUMP_SECTOR_SIZE / 4U));
+		u32Offset 	= (u32Cluster % (DUMP_SECTOR_SIZE / 4U)) * 4U;
+	}
+	else if (FS_FAT16 == pxFs->fs_type)
+	{
+		xSector 	= pxFs->fatbase + (u32Cluster / (DUMP_SECTOR_SIZE / 2U));
+		u32Offset 	= (u32Cluster % (DUMP_SECTOR_SIZE / 2U)) * 2U;
+	}
+	else
+	{
+		return false;
+	}
+
+	if ((xSector != *pxCached) && (RES_OK != disk_read(SDDISK, g_au8DumpSector, xSector, 1U)))
+	{
+		return false;
+	}
+	*pxCached = xSector;
+
+	if (FS_FAT32 == pxFs->fs_type)
+	{
+		*pu32Next = ((DWORD)g_au8DumpSector[u32Offset] | ((DWORD)g_au8DumpSector[u32Offset + 1U] << 8) |
+					 ((DWORD)g_au8DumpSector[u32Offset + 2U] << 16) | ((DWORD)g_au8DumpSector[u32Offset + 3U] << 24)) &
+					0x0FFFFFFFUL;
+	}
+	else
+	{
+		*pu32Next = (DWORD)g_au8DumpSector[u32Offset] | ((DWORD)g_au8DumpSector[u32Offset + 1U] << 8);
+	}
+	return true;
+}
+
+/**
+ * @brief 	Checks Whether a Sector Was Never Written (Erased State of The Card).
+ *
+ * @return 	True If The Sector In g_au8DumpSector Is All 0x00 or All 0xFF.
+ */
+static bool DUMP_SectorBlank(void)
+{
+	uint8_t u8First = g_au8DumpSector[0];
+
+	if ((0x00U != u8First) && (0xFFU != u8First))
+	{
+		return false;
+	}
+	for (uint32_t i = 1UL; i < DUMP_SECTOR_SIZE; i++)
+	{
+		if (g_au8DumpSector[i] != u8First)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+/**
+ * @brief 	Writes g_au8DumpSector Into a Sector of The Region.
+ *
+ * @param 	u32Sector Sector In The Region.
+ */
+static void DUMP_WriteSector(uint32_t u32Sector)
+{
+	if (RES_OK != disk_write(SDDISK, g_au8DumpSector, g_xDumpLba + u32Sector, 1U))
+	{
+		PRINTF("ERR: Failed to Write Sector %u of %s.\r\n", u32Sector, DUMP_FILE);
+	}
+}
+
+/*******************************************************************************
+ * Functions
+ ******************************************************************************/
+uint32_t DUMP_Crc32(uint32_t u32Crc, const uint8_t *pu8Data, uint32_t u32Length)
+{
+	/* Nibble Table of The Reflected Polynomial 0xEDB88320, Small Enough For The Emergency Path And Still Fast */
+	static const uint32_t au32Table[16] =
+	{
+		0x00000000UL, 0x1DB71064UL, 0x3B6E20C8UL, 0x26D930ACUL, 0x76DC4190UL, 0x6B6B51F4UL, 0x4DB26158UL, 0x5005713CUL,
+		0xEDB88320UL, 0xF00F9344UL, 0xD6D6A3E8UL, 0xCB61B38CUL, 0x9B64C2B0UL, 0x86D3D2D4UL, 0xA00AE278UL, 0xBDBDF21CUL
+	};
+	uint32_t u32Value = ~u32Crc;
+
+	for (uint32_t i = 0UL; i < u32Length; i++)
+	{
+		u32Value ^= pu8Data[i];
+		u32Value = (u32Value >> 4) ^ au32Table[u32Value & 0x0FUL];
+		u32Value = (u32Value >> 4) ^ au32Table[u32Value & 0x0FUL];
+	}
+	return ~u32Value;
+}
+
+error_t DUMP_Prepare(void)
+{
+#if (true == DUMP_ENABLED)
+	FRESULT res;
+	UINT bytes;
+	FATFS *pxFs;
+	DWORD u32Clusters;
+
+	g_bDumpReady 	= false;
+	g_bDumpReserved = false;
+	g_bIntentSet 	= false;
+	if (g_bDumpPending)
+	{
+		PRINTF("ERR: Dump of The Last Power Loss Not Appended, %s Is Kept.\r\n", DUMP_FILE);
+		return ERROR_RECORD;
+	}
+
+	res = f_open(&g_dumpFile, DUMP_FILE, (FA_READ | FA_WRITE | FA_OPEN_ALWAYS));
+	if (FR_OK != res)
+	{
+		PRINTF("ERR: Failed to Open %s. Error=%d\r\n", DUMP_FILE, (int)res);
+		return ERROR_OPEN;
+	}
+
+	pxFs = g_dumpFile.obj.fs;
+	u32Clusters = (DWORD)((DUMP_REGION_BYTES + ((FSIZE_t)pxFs->csize * DUMP_SECTOR_SIZE) - 1U) /
+						  ((FSIZE_t)pxFs->csize * DUMP_SECTOR_SIZE));
+
+	/* Raw Writes Need a Contiguous Region, The Last Cluster of a Contiguous Chain Is Start + Count - 1 */
+	if ((DUMP_REGION_BYTES == f_size(&g_dumpFile)) && (FR_OK == f_lseek(&g_dumpFile, DUMP_REGION_BYTES - 1U)) &&
+		(g_dumpFile.clust == (g_dumpFile.obj.sclust + u32Clusters - 1UL)))
+	{
+		res = f_lseek(&g_dumpFile, 0U);
+	}
+	else
+	{
+		/* Missing, Resized Or Fragmented, Allocated Again */
+		res = f_lseek(&g_dumpFile, 0U);
+		if (FR_OK == res)
+		{
+			res = f_truncate(&g_dumpFile);
+		}
+		if (FR_OK == res)
+		{
+			res = f_expand(&g_dumpFile, DUMP_REGION_BYTES, 1U);
+		}
+	}
+
+	/* Header And Intent Are Invalidated, The Region Is Now Owned By This Session */
+	(void)memset(g_au8DumpSector, 0, sizeof(g_au8DumpSector));
+	if (FR_OK == res)
+	{
+		res = f_write(&g_dumpFile, g_au8DumpSector, DUMP_SECTOR_SIZE, &bytes);
+	}
+	if (FR_OK == res)
+	{
+		res = f_write(&g_dumpFile, g_au8DumpSector, DUMP_SECTOR_SIZE, &bytes);
+	}
+
+	g_xDumpLba = pxFs->database + ((LBA_t)(g_dumpFile.obj.sclust - 2UL) * pxFs->csize);
+	if (FR_OK != f_close(&g_dumpFile))
+	{
+		res = FR_DISK_ERR;
+	}
+
+	if (FR_OK != res)
+	{
+		PRINTF("ERR: Failed to Reserve Dump Region %s. Error=%d\r\n", DUMP_FILE, (int)res);
+		return ERROR_FILESYSTEM;
+	}
+
+	(void)f_chmod(DUMP_FILE, (AM_HID | AM_SYS), (AM_HID | AM_SYS));
+	g_bDumpReserved = true;
+	g_bDumpReady 	= true;
+
+#if (true == DEBUG_ENABLED)
+	PRINTF("DEBUG: Dump Region Reserved At Sector %u.\r\n", (uint32_t)g_xDumpLba);
+#endif /* (true == DEBUG_ENABLED) */
+	return ERROR_NONE;
+#else
+	return ERROR_RECORD;
+#endif /* (true == DUMP_ENABLED) */
+}
+
+bool DUMP_IsReady(void)
+{
+	return g_bDumpReady;
+}
+
+error_t DUMP_Write(const char *pcPath, const dump_region_t *pxRegions, uint16_t u16Regions,
+				   const dump_piece_t *pxPieces, uint16_t u16Pieces)
+{
+	dump_header_t *pxHeader = (dump_header_t *)(void *)g_au8DumpSector;
+	LBA_t xSector;
+	uint32_t u32Sectors = DUMP_DATA_SECTOR;
+
+	if ((!g_bDumpReady) || (DUMP_MAX_REGIONS < u16Regions) || (DUMP_MAX_PIECES < u16Pieces))
+	{
+		return ERROR_RECORD;
+	}
+	for (uint16_t i = 0U; i < u16Regions; i++)
+	{
+		u32Sectors += pxRegions[i].u16Sectors;
+	}
+	if (DUMP_REGION_SECTORS < u32Sectors)
+	{
+		return ERROR_RECORD;
+	}
+
+	/* Region Is Used Once, Another Trip Before The Next Session Goes Through FatFs */
+	g_bDumpReady = false;
+
+	(void)memset(g_au8DumpSector, 0, sizeof(g_au8DumpSector));
+	pxHeader->u32Magic 		= DUMP_MAGIC;
+	pxHeader->u16Version 	= DUMP_VERSION;
+	pxHeader->u16Regions 	= u16Regions;
+	pxHeader->u16Pieces 	= u16Pieces;
+	pxHeader->u32PayloadCrc = 0UL;
+	for (uint16_t i = 0U; i < u16Pieces; i++)
+	{
+		const uint8_t *pu8Region = pxRegions[pxPieces[i].u8Region].pu8Data;
+
+		pxHeader->axPieces[i] = pxPieces[i];
+		pxHeader->u32PayloadCrc = DUMP_Crc32(pxHeader->u32PayloadCrc, &pu8Region[pxPieces[i].u16Offset],
+											 pxPieces[i].u16Bytes);
+	}
+	if (NULL != pcPath)
+	{
+		(void)strncpy(pxHeader->acPath, pcPath, DUMP_PATH_SIZE - 1U);
+	}
+
+	/* Regions First, The Header Makes The Dump Valid Only When Everything Else Is On The Card */
+	xSector = g_xDumpLba + DUMP_DATA_SECTOR;
+	for (uint16_t i = 0U; i < u16Regions; i++)
+	{
+		pxHeader->au16RegionSectors[i] = pxRegions[i].u16Sectors;
+		if (RES_OK != disk_write(SDDISK, pxRegions[i].pu8Data, xSector, pxRegions[i].u16Sectors))
+		{
+			return ERROR_FILESYSTEM;
+		}
+		xSector += pxRegions[i].u16Sectors;
+	}
+
+	pxHeader->u32HeaderCrc = DUMP_Crc32(0UL, (const uint8_t *)pxHeader, (uint32_t)offsetof(dump_header_t, u32HeaderCrc));
+	if (RES_OK != disk_write(SDDISK, g_au8DumpSector, g_xDumpLba + DUMP_HEADER_SECTOR, 1U))
+	{
+		return ERROR_FILESYSTEM;
+	}
+	return ERROR_NONE;
+}
+
+error_t DUMP_Reconcile(void)
+{
+#if (true == DUMP_ENABLED)
+	dump_header_t xHeader;
+	FIL xTarget;
+	const char *pcTarget;
+	uint32_t u32Crc = 0UL;
+	UINT bytes;
+	error_t retVal;
+
+	if (FR_OK != f_open(&g_dumpFile, DUMP_FILE, (FA_READ | FA_WRITE | FA_OPEN_EXISTING)))
+	{
+		return ERROR_NONE;
+	}
+
+	if ((FR_OK != f_read(&g_dumpFile, g_au8DumpSector, DUMP_SECTOR_SIZE, &bytes)) || (DUMP_SECTOR_SIZE != bytes))
+	{
+		(void)f_close(&g_dumpFile);
+		return ERROR_NONE;
+	}
+	(void)memcpy(&xHeader, g_au8DumpSector, sizeof(xHeader));
+	xHeader.acPath[DUMP_PATH_SIZE - 1U] = '\0';
+
+	if (!DUMP_HeaderValid(&xHeader))
+	{
+		(void)f_close(&g_dumpFile);
+		return ERROR_NONE;
+	}
+
+	/* Whole Payload Is Verified Before Anything Is Appended */
+	retVal = DUMP_ProcessPieces(&xHeader, NULL, &u32Crc);
+	if ((ERROR_NONE != retVal) || (u32Crc != xHeader.u32PayloadCrc))
+	{
+		PRINTF("ERR: Power Loss Dump Corrupted (CRC), Discarded.\r\n");
+	}
+	else
+	{
+		pcTarget = ('\0' != xHeader.acPath[0]) ? xHeader.acPath : DUMP_RECOVERED_FILE;
+		if (FR_OK != f_open(&xTarget, pcTarget, (FA_WRITE | FA_OPEN_APPEND)))
+		{
+			PRINTF("ERR: Failed to Open %s For Power Loss Dump.\r\n", pcTarget);
+			(void)f_close(&g_dumpFile);
+			g_bDumpPending = true;
+			return ERROR_OPEN;
+		}
+
+		retVal = DUMP_ProcessPieces(&xHeader, &xTarget, &u32Crc);
+		if (FR_OK != f_close(&xTarget))
+		{
+			retVal = ERROR_CLOSE;
+		}
+		if (ERROR_NONE != retVal)
+		{
+			PRINTF("ERR: Failed to Append Power Loss Dump To %s.\r\n", pcTarget);
+			(void)f_close(&g_dumpFile);
+			g_bDumpPending = true;
+			return retVal;
+		}
+#if (true == INFO_ENABLED)
+		PRINTF("INFO: Power Loss Dump Appended To %s.\r\n", pcTarget);
+#endif /* (true == INFO_ENABLED) */
+	}
+
+	/* Invalidate, So The Dump Is Never Appended Twice */
+	(void)memset(g_au8DumpSector, 0, sizeof(g_au8DumpSector));
+	retVal = ERROR_NONE;
+	if ((FR_OK != f_lseek(&g_dumpFile, 0U)) || (FR_OK != f_write(&g_dumpFile, g_au8DumpSector, DUMP_SECTOR_SIZE, &bytes)))
+	{
+		retVal = ERROR_FILESYSTEM;
+	}
+	(void)f_close(&g_dumpFile);
+	return retVal;
+#else
+	return ERROR_NONE;
+#endif /* (true == DUMP_ENABLED) */
+}
+
+void DUMP_SetIntent(const char *pcPath)
+{
+	dump_intent_t *pxIntent = (dump_intent_t *)(void *)g_au8DumpSector;
+
+	if (!g_bDumpReserved)
+	{
+		return;
+	}
+
+	(void)memset(g_au8DumpSector, 0, sizeof(g_au8DumpSector));
+	pxIntent->u32Magic = DUMP_INTENT_MAGIC;
+	(void)strncpy(pxIntent->acPath, pcPath, DUMP_PATH_SIZE - 1U);
+	pxIntent->u32Crc = DUMP_Crc32(0UL, (const uint8_t *)pxIntent, (uint32_t)offsetof(dump_intent_t, u32Crc));
+	DUMP_WriteSector(DUMP_INTENT_SECTOR);
+	g_bIntentSet = true;
+}
+
+void DUMP_ClearIntent(void)
+{
+	if ((!g_bDumpReserved) || (!g_bIntentSet))
+	{
+		return;
+	}
+
+	(void)memset(g_au8DumpSector, 0, sizeof(g_au8DumpSector));
+	DUMP_WriteSector(DUMP_INTENT_SECTOR);
+	g_bIntentSet = false;
+}
+
+error_t DUMP_RepairIntent(void)
+{
+#if (true == DUMP_ENABLED)
+	dump_intent_t xIntent;
+	FIL xLog;
+	FATFS *pxFs;
+	LBA_t xCached = 0U;
+	LBA_t xSector;
+	DWORD u32Cluster;
+	DWORD u32Next;
+	DWORD u32Clusters = 1UL;
+	FSIZE_t xClusterBytes;
+	FSIZE_t xSize;
+	UINT bytes;
+	uint32_t u32Start;
+	uint32_t u32Written;
+	error_t retVal = ERROR_NONE;
+
+	if (FR_OK != f_open(&g_dumpFile, DUMP_FILE, (FA_READ | FA_WRITE | FA_OPEN_EXISTING)))
+	{
+		return ERROR_NONE;
+	}
+	if ((FR_OK != f_lseek(&g_dumpFile, (FSIZE_t)DUMP_INTENT_SECTOR * DUMP_SECTOR_SIZE)) ||
+		(FR_OK != f_read(&g_dumpFile, g_au8DumpSector, DUMP_SECTOR_SIZE, &bytes)) || (DUMP_SECTOR_SIZE != bytes))
+	{
+		(void)f_close(&g_dumpFile);
+		return ERROR_NONE;
+	}
+	(void)memcpy(&xIntent, g_au8DumpSector, sizeof(xIntent));
+	xIntent.acPath[DUMP_PATH_SIZE - 1U] = '\0';
+
+	if ((DUMP_INTENT_MAGIC != xIntent.u32Magic) ||
+		(xIntent.u32Crc != DUMP_Crc32(0UL, (const uint8_t *)&xIntent, (uint32_t)offsetof(dump_intent_t, u32Crc))))
+	{
+		/* Last Session Closed Its File */
+		(void)f_close(&g_dumpFile);
+		return ERROR_NONE;
+	}
+
+	if (FR_OK == f_open(&xLog, xIntent.acPath, (FA_WRITE | FA_OPEN_EXISTING)))
+	{
+		pxFs 			= xLog.obj.fs;
+		u32Cluster 		= xLog.obj.sclust;
+		xClusterBytes 	= (FSIZE_t)pxFs->csize * DUMP_SECTOR_SIZE;
+
+		/* Start Cluster Is In The Directory Entry Since The First Block Was Synced */
+		while ((u32Cluster >= 2UL) && (u32Clusters < pxFs->n_fatent))
+		{
+			if (!DUMP_GetFat(pxFs, u32Cluster, &xCached, &u32Next))
+			{
+				retVal = ERROR_READ;
+				break;
+			}
+			if ((u32Next < 2UL) || (u32Next >= pxFs->n_fatent))
+			{
+				break;		/* End of Chain */
+			}
+			u32Cluster = u32Next;
+			u32Clusters++;
+		}
+
+		if ((ERROR_NONE == retVal) && (u32Cluster >= 2UL))
+		{
+			/* Only The Last Cluster Is Scanned, From The Recorded Size If It Lies In It */
+			xSize 		= (FSIZE_t)(u32Clusters - 1UL) * xClusterBytes;
+			u32Start 	= (f_size(&xLog) > xSize) ? (uint32_t)((f_size(&xLog) - xSize) / DUMP_SECTOR_SIZE) : 0UL;
+			xSector 	= pxFs->database + ((LBA_t)(u32Cluster - 2UL) * pxFs->csize);
+			u32Written 	= u32Start;
+			while (u32Written < pxFs->csize)
+			{
+				if ((RES_OK != disk_read(SDDISK, g_au8DumpSector, xSector + u32Written, 1U)) || DUMP_SectorBlank())
+				{
+					break;
+				}
+				u32Written++;
+			}
+			xSize += (FSIZE_t)u32Written * DUMP_SECTOR_SIZE;
+
+			/* Seek Beyond The Size In Write Mode Follows The Existing Chain And Updates The Entry On Close */
+			if (xSize > f_size(&xLog))
+			{
+#if (true == INFO_ENABLED)
+				PRINTF("INFO: Repaired Size of %s (%u -> %u B).\r\n", xIntent.acPath, (uint32_t)f_size(&xLog),
+					   (uint32_t)xSize);
+#endif /* (true == INFO_ENABLED) */
+				if (FR_OK != f_lseek(&xLog, xSize))
+				{
+					retVal = ERROR_FILESYSTEM;
+				}
+			}
+		}
+		if (FR_OK != f_close(&xLog))
+		{
+			retVal = ERROR_CLOSE;
+		}
+	}
+
+	/* Repaired Or Not Repairable, The Intent Is Not Checked Again */
+	(void)memset(g_au8DumpSector, 0, sizeof(g_au8DumpSector));
+	if ((FR_OK != f_lseek(&g_dumpFile, (FSIZE_t)DUMP_INTENT_SECTOR * DUMP_SECTOR_SIZE)) ||
+		(FR_OK != f_write(&g_dumpFile, g_au8DumpSector, DUMP_SECTOR_SIZE, &bytes)))
+	{
+		retVal = ERROR_FILESYSTEM;
+	}
+	(void)f_close(&g_dumpFile);
+	return retVal;
+#else
+	return ERROR_NONE;
+#endif /* (true == DUMP_ENABLED) */
+}
@@ -0,0 +1,166 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      latency.c
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    End-To-End Latency of Received Data (LPUART Arrival -> Written On The Card).
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           latency.c
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          End-To-End Latency of Received Data (LPUART Arrival -> Written On The Card).
+ * ****************************/
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "fsl_debug_console.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "ff.h"
+
+#include "latency.h"
+#include "parser.h"
+#include "trace.h"
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/**
+ * @brief 	Size of One Report Line.
+ */
+#define LATENCY_LINE_SIZE			64U
+
+/*******************************************************************************
+ * Global Variables
+ ******************************************************************************/
+/**
+ * @brief 	Upper Bounds of The Histogram Buckets In Milliseconds, The Last Bucket Is Open.
+ * @details Blocks Written At The Idle Flush Wait 'flush_timeout_ms' (3 s By Default), They Fall Into The 5 s Bucket.
+ */
+static const uint32_t g_au32LatencyBoundMs[LATENCY_BUCKETS] =
+{
+	10UL, 20UL, 50UL, 100UL, 200UL, 500UL, 1000UL, 2000UL, 5000UL, 10000UL, UINT32_MAX
+};
+
+/**
+ * @brief 	Histogram of The Session.
+ */
+static uint32_t g_au32LatencyHist[LATENCY_BUCKETS];
+
+/**
+ * @brief 	Number of Blocks, Maximal Latency And Number of Alerts In The Session.
+ */
+static uint32_t g_u32LatencyBlocks 	= 0UL;
+static uint32_t g_u32LatencyMaxMs 	= 0UL;
+static uint32_t g_u32LatencyAlerts 	= 0UL;
+
+/**
+ * @brief 	Blocks Were Recorded Since The Last Report, Otherwise The Report File Is Not Rewritten.
+ */
+static bool g_bLatencyChanged 		= false;
+
+/**
+ * @brief 	Report File.
+ */
+static FIL g_latencyFile;
+
+/*******************************************************************************
+ * Functions
+ ******************************************************************************/
+void LATENCY_Reset(void)
+{
+	(void)memset(g_au32LatencyHist, 0, sizeof(g_au32LatencyHist));
+	g_u32LatencyBlocks 	= 0UL;
+	g_u32LatencyMaxMs 	= 0UL;
+	g_u32LatencyAlerts 	= 0UL;
+	g_bLatencyChanged 	= false;
+}
+
+void LATENCY_Record(uint16_t u16OldestTick)
+{
+	uint16_t u16Ticks = (uint16_t)((uint16_t)xTaskGetTickCount() - u16OldestTick);
+	uint32_t u32Ms = (uint32_t)u16Ticks * portTICK_PERIOD_MS;
+	uint32_t u32TargetMs = PARSER_GetDurabilityMs();
+	uint32_t i = 0UL;
+
+	while (u32Ms > g_au32LatencyBoundMs[i])
+	{
+		i++;
+	}
+	g_au32LatencyHist[i]++;
+	g_u32LatencyBlocks++;
+	g_bLatencyChanged = true;
+
+	if (u32Ms > g_u32LatencyMaxMs)
+	{
+		g_u32LatencyMaxMs = u32Ms;
+	}
+
+	/* 0 Disables The Alert */
+	if ((0UL != u32TargetMs) && (u32Ms > u32TargetMs))
+	{
+		g_u32LatencyAlerts++;
+		PRINTF("ERR: Durability Target Exceeded, Data Waited %u ms (Target %u ms).\r\n", u32Ms, u32TargetMs);
+		TRACE_Trigger(TRACE_ID_F_WRITE);
+	}
+}
+
+void LATENCY_Report(const char *pcDirectory)
+{
+	char acLine[LATENCY_LINE_SIZE];
+	UINT bytesWritten;
+	bool bToFile;
+	uint32_t u32Lower = 0UL;
+
+	/* Nothing New, The File Already Holds The Histogram (Card Wear) */
+	if (!g_bLatencyChanged)
+	{
+		return;
+	}
+	g_bLatencyChanged = false;
+
+	(void)snprintf(acLine, sizeof(acLine), "%s/%s", pcDirectory, LATENCY_FILE);
+	bToFile = (FR_OK == f_open(&g_latencyFile, acLine, (FA_WRITE | FA_CREATE_ALWAYS)));
+
+	(void)snprintf(acLine, sizeof(acLine), "Blocks %u, Max %u ms, Alerts %u (Target %u ms)\r\n",
+				   g_u32LatencyBlocks, g_u32LatencyMaxMs, g_u32LatencyAlerts, PARSER_GetDurabilityMs());
+#if (true == INFO_ENABLED)
+	PRINTF("INFO: Latency %s", acLine);
+#endif /* (true == INFO_ENABLED) */
+	if (bToFile)
+	{
+		(void)f_write(&g_latencyFile, acLine, (UINT)strlen(acLine), &bytesWritten);
+	}
+
+	for (uint32_t i = 0UL; i < LATENCY_BUCKETS; i++)
+	{
+		if (UINT32_MAX == g_au32LatencyBoundMs[i])
+		{
+			(void)snprintf(acLine, sizeof(acLine), ">= %u ms: %u\r\n", u32Lower, g_au32LatencyHist[i]);
+		}
+		else
+		{
+			(void)snprintf(acLine, sizeof(acLine), "%u - %u ms: %u\r\n", u32Lower, g_au32LatencyBoundMs[i],
+						   g_au32LatencyHist[i]);
+		}
+		u32Lower = g_au32LatencyBoundMs[i];
+#if (true == INFO_ENABLED)
+		PRINTF("INFO: Latency %s", acLine);
+#endif /* (true == INFO_ENABLED) */
+		if (bToFile)
+		{
+			(void)f_write(&g_latencyFile, acLine, (UINT)strlen(acLine), &bytesWritten);
+		}
+	}
+
+	if (bToFile)
+	{
+		(void)f_close(&g_latencyFile);
+	}
+}
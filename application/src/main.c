@@ -34,6 +34,7 @@
 /* Application Includes */
 #include "app_init.h"
 #include "app_tasks.h"
+#include "mem.h"
 /*******************************************************************************
  * Definitions
  ******************************************************************************/
@@ -42,9 +43,9 @@
  * Global Variables
  ******************************************************************************/
 /**
- * @brief 	Buffer for Static Stack of Mass Storage Task.
+ * @brief 	Stacks of The Application Tasks Are Drawn From The SRAM Region (mem.c) Before The Tasks Are Created.
  */
-static StackType_t g_xMscTaskStack[MSC_STACK_SIZE];
+#define MAIN_STACK_BYTES(depth)		((uint32_t)(depth) * (uint32_t)sizeof(StackType_t))
 
 /**
  * @brief 	TCB (Task Control Block) - Meta Data of Mass Storage Task.
@@ -53,10 +54,12 @@ static StackType_t g_xMscTaskStack[MSC_STACK_SIZE];
  */
 static StaticTask_t g_xMscTaskTCB;
 
+#if (USB_DEVICE_MSC_USE_WRITE_TASK > 0U)
 /**
- * @brief  Buffer For Static Stack Of Record Task.
+ * @brief 	TCB (Task Control Block) - Meta Data of Mass Storage Write Task.
  */
-static StackType_t g_xRecordTaskStack[RECORD_STACK_SIZE];
+static StaticTask_t g_xMscWriteTaskTCB;
+#endif /* (USB_DEVICE_MSC_USE_WRITE_TASK > 0U) */
 
 /**
  * @brief  TCB (Task Control Block) - Meta Data of Record Task.
@@ -65,6 +68,12 @@ static StackType_t g_xRecordTaskStack[RECORD_STACK_SIZE];
  */
 static StaticTask_t g_xRecordTaskTCB;
 
+#if (true == PWRLOSS_DETECTION_ENABLED)
+/**
+ * @brief  TCB (Task Control Block) - Meta Data of Emergency Task.
+ */
+static StaticTask_t g_xEmergencyTaskTCB;
+#endif /* (true == PWRLOSS_DETECTION_ENABLED) */
 
  /**
  * MISRA Deviation: Rule 8.4 [Required]
@@ -84,6 +93,11 @@ usb_msc_struct_t g_msc;
  */
 TaskHandle_t g_xMscTaskHandle 	 = NULL;
 
+/**
+ * @brief USB Mass Storage Write Task Handle.
+ */
+TaskHandle_t g_xMscWriteTaskHandle = NULL;
+
 /**
  * @brief Semaphore For USB Mass Storage Task Management.
  */
@@ -94,6 +108,11 @@ SemaphoreHandle_t g_xSemMassStorage;
  */
 TaskHandle_t g_xRecordTaskHandle = NULL;
 
+/**
+ * @brief Emergency Task Handle, Notified By Power Loss Interrupt.
+ */
+TaskHandle_t g_xEmergencyTaskHandle = NULL;
+
 /**
  * @brief Semaphore For Record Task Management.
  */
@@ -108,6 +127,7 @@ SemaphoreHandle_t g_xSemRecord;
  */
 int main(void)
 {
+	StackType_t *pxStack = NULL;
 
 	g_xSemRecord = xSemaphoreCreateBinary();
 	g_xSemMassStorage = xSemaphoreCreateBinary();
@@ -126,13 +146,15 @@ int main(void)
     /* Initialize board hardware. */
 	APP_InitBoard();
 
+	pxStack = (StackType_t *)MEM_Alloc(MEM_REGION_SRAM, MEM_OWNER_COMMON, MAIN_STACK_BYTES(RECORD_STACK_SIZE),
+									   "record_task Stack");
 	g_xRecordTaskHandle = xTaskCreateStatic(
     			  record_task,       		/* Function That Implements The Task. 		*/
                   "record_task",          	/* Text Name For The Task. 					*/
-				  MSC_STACK_SIZE,      		/* Number of Indexes In The xStack Array. 	*/
+				  RECORD_STACK_SIZE,      	/* Number of Indexes In The xStack Array. 	*/
                   NULL,    					/* Parameter Passed Into The Task. 			*/
 				  TASK_PRIO,				/* Priority at Which The Task Is Created. 	*/
-				  &g_xRecordTaskStack[0],   /* Array To Use As The Task's Stack.		*/
+				  pxStack,   				/* Array To Use As The Task's Stack.		*/
                   &g_xRecordTaskTCB );
     if (NULL == g_xRecordTaskHandle)
     {
@@ -143,16 +165,38 @@ int main(void)
     	ERR_HandleError();
     }
 
+#if (true == PWRLOSS_DETECTION_ENABLED)
+    pxStack = (StackType_t *)MEM_Alloc(MEM_REGION_SRAM, MEM_OWNER_COMMON, MAIN_STACK_BYTES(EMERGENCY_STACK_SIZE),
+    								   "emergency_task Stack");
+    g_xEmergencyTaskHandle = xTaskCreateStatic(
+    			  emergency_task,       	/* Function That Implements The Task. 		*/
+                  "emergency_task",         /* Text Name For The Task. 					*/
+				  EMERGENCY_STACK_SIZE,     /* Number of Indexes In The xStack Array. 	*/
+                  NULL,    					/* Parameter Passed Into The Task. 			*/
+				  EMERGENCY_TASK_PRIO,		/* Priority at Which The Task Is Created. 	*/
+				  pxStack,					/* Array To Use As The Task's Stack.		*/
+                  &g_xEmergencyTaskTCB );
+    if (NULL == g_xEmergencyTaskHandle)
+    {
+    	PRINTF("ERR: Emergency Task Creation Failed!\r\n");
+#if (CONTROL_LED_ENABLED == true)
+		LED_SignalError();
+#endif /* (CONTROL_LED_ENABLED == true) */
+    	ERR_HandleError();
+    }
+#endif /* (true == PWRLOSS_DETECTION_ENABLED) */
 
 #if (true == MSC_ENABLED)
 
+    pxStack = (StackType_t *)MEM_Alloc(MEM_REGION_SRAM, MEM_OWNER_COMMON, MAIN_STACK_BYTES(MSC_STACK_SIZE),
+    								   "msc_task Stack");
     g_xMscTaskHandle = xTaskCreateStatic(
     			  msc_task,       			/* Function That Implements The Task. 		*/
                   "msc_task",          		/* Text Name For The Task. 					*/
 				  MSC_STACK_SIZE,      		/* Number of Indexes In The xStack Array. 	*/
                   NULL,    					/* Parameter Passed Into The Task. 			*/
 				  TASK_PRIO - 1,			/* Priority at Which The Task Is Created. 	*/
-				  &g_xMscTaskStack[0],      /* Array To Use As The Task's Stack.		*/
+				  pxStack,      			/* Array To Use As The Task's Stack.		*/
                   &g_xMscTaskTCB );
     if (NULL == g_xMscTaskHandle)
     {
@@ -163,6 +207,27 @@ int main(void)
     	ERR_HandleError();
     }
 
+#if (USB_DEVICE_MSC_USE_WRITE_TASK > 0U)
+    pxStack = (StackType_t *)MEM_Alloc(MEM_REGION_SRAM, MEM_OWNER_COMMON, MAIN_STACK_BYTES(MSC_WRITE_STACK_SIZE),
+    								   "msc_write_task Stack");
+    g_xMscWriteTaskHandle = xTaskCreateStatic(
+    			  msc_write_task,       	/* Function That Implements The Task. 		*/
+                  "msc_write_task",         /* Text Name For The Task. 					*/
+				  MSC_WRITE_STACK_SIZE,     /* Number of Indexes In The xStack Array. 	*/
+                  NULL,    					/* Parameter Passed Into The Task. 			*/
+				  TASK_PRIO,				/* Priority at Which The Task Is Created. 	*/
+				  pxStack, 					/* Array To Use As The Task's Stack.		*/
+                  &g_xMscWriteTaskTCB );
+    if (NULL == g_xMscWriteTaskHandle)
+    {
+    	PRINTF("ERR: MSC Write Task Creation Failed!\r\n");
+#if (CONTROL_LED_ENABLED == true)
+		LED_SignalError();
+#endif /* (CONTROL_LED_ENABLED == true) */
+    	ERR_HandleError();
+    }
+#endif /* (USB_DEVICE_MSC_USE_WRITE_TASK > 0U) */
+
 #endif /* (true == MSC_ENABLED) */
 
     vTaskStartScheduler();
@@ -20,14 +20,46 @@
  ******************************************************************************/
 #include "mass_storage.h"
 #include "task_switching.h"
+#include "defs.h"
+#include "task.h"
+#include "record.h"
+#include "diagnostics.h"
 
 /*******************************************************************************
  * Global Variables
  ******************************************************************************/
 
-extern SemaphoreHandle_t g_xSemRecord;
+/**
+ * @brief 	Handle of msc_task, Notified From USB1_HS ISR.
+ */
+extern TaskHandle_t g_xMscTaskHandle;
+
+#if (false == MSC_CONCURRENT_RECORD_ENABLED)
+/**
+ * @brief 	Handle of record_task, Woken Up On Attach So That It Leaves The Record Loop.
+ */
+extern TaskHandle_t g_xRecordTaskHandle;
+#endif /* (false == MSC_CONCURRENT_RECORD_ENABLED) */
 
-extern SemaphoreHandle_t g_xSemMassStorage;
+/**
+ * @brief 	USB State Seen In Previous USB1_HS Interrupt, msc_task Is Notified Only On Change.
+ */
+static usb_device_notification_t g_ePrevUsbState = kUSB_DeviceNotifyDetach;
+
+/**
+ * @brief 	Configuration Seen In Previous USB1_HS Interrupt.
+ */
+static uint8_t g_u8PrevConfiguration = 0U;
+
+/**
+ * @brief 	Read/Write Error Flag Seen In Previous USB1_HS Interrupt.
+ */
+static uint8_t g_u8PrevReadWriteError = 0U;
+
+/**
+ * @brief 	DWT Cycle Counter Value of The Last USB Detach.
+ */
+static volatile uint32_t g_u32DetachCycles = 0UL;
 
 /*******************************************************************************
  * Interrupt Service Routines (ISRs)
@@ -41,17 +73,55 @@ extern SemaphoreHandle_t g_xSemMassStorage;
 void USB1_HS_IRQHandler(void)
 {
 	BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+	usb_device_notification_t eState;
+	uint32_t u32Events = 0UL;
+#if (true == DIAG_ENABLED)
+	uint32_t u32DiagStart = DIAG_IsrEnter();
+#endif /* (true == DIAG_ENABLED) */
 
     USB_DeviceEhciIsrFunction(g_msc.deviceHandle);
 
-    if (USB_State(g_msc.deviceHandle) == kUSB_DeviceNotifyAttach)
-	{
-		(void)xSemaphoreGiveFromISR(g_xSemMassStorage, &xHigherPriorityTaskWoken);
-	}
-	else
-	{
-    	(void)xSemaphoreGiveFromISR(g_xSemRecord, &xHigherPriorityTaskWoken);
-	}
+    /* Notify msc_task Only On Attach/Detach Edge, Not On Every Transfer Interrupt */
+    eState = USB_State(g_msc.deviceHandle);
+    if (eState != g_ePrevUsbState)
+    {
+    	if (kUSB_DeviceNotifyDetach == eState)
+    	{
+#if (true == SWITCH_LATENCY_ENABLED)
+    		g_u32DetachCycles = DWT->CYCCNT;
+#endif /* (true == SWITCH_LATENCY_ENABLED) */
+    		u32Events |= MSC_EVENT_DETACH;
+    	}
+    	else
+    	{
+    		u32Events |= MSC_EVENT_ATTACH;
+    	}
+    	g_ePrevUsbState = eState;
+    }
+
+    if ((g_msc.currentConfiguration != g_u8PrevConfiguration) || (g_msc.read_write_error != g_u8PrevReadWriteError))
+    {
+    	g_u8PrevConfiguration 	= g_msc.currentConfiguration;
+    	g_u8PrevReadWriteError 	= g_msc.read_write_error;
+    	u32Events |= MSC_EVENT_CLASS;
+    }
+
+    if ((0UL != u32Events) && (NULL != g_xMscTaskHandle))
+    {
+    	(void)xTaskNotifyFromISR(g_xMscTaskHandle, u32Events, eSetBits, &xHigherPriorityTaskWoken);
+    }
+
+#if (false == MSC_CONCURRENT_RECORD_ENABLED)
+    /* record_task Sleeps Until Notified, Without This It Would Notice The Attach Only With The Next Data */
+    if ((0UL != (u32Events & MSC_EVENT_ATTACH)) && (NULL != g_xRecordTaskHandle))
+    {
+    	(void)xTaskNotifyFromISR(g_xRecordTaskHandle, RECORD_EVENT_USB, eSetBits, &xHigherPriorityTaskWoken);
+    }
+#endif /* (false == MSC_CONCURRENT_RECORD_ENABLED) */
+
+#if (true == DIAG_ENABLED)
+    DIAG_IsrExit(u32DiagStart);
+#endif /* (true == DIAG_ENABLED) */
 
     /**
      * Switch The Context From ISR To a Higher Priority Task,
@@ -72,6 +142,11 @@ void USB1_HS_IRQHandler(void)
 /*******************************************************************************
  * Code
  ******************************************************************************/
+uint32_t MSC_GetDetachCycles(void)
+{
+	return g_u32DetachCycles;
+}
+
 void MSC_DeviceMscApp(void)
 {
     /* USB Mass Storage Expansion Can Be Located Here */
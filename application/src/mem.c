@@ -0,0 +1,325 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      mem.c
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Region Arenas From Which The Subsystems Draw Their Buffers At Init, RAM Budget Report.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           mem.c
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Region Arenas From Which The Subsystems Draw Their Buffers At Init, RAM Budget Report.
+ * ****************************/
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stddef.h>
+#include "fsl_debug_console.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "ff.h"
+
+#include "mem.h"
+#include "disk.h"
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/**
+ * @brief 	Rounds The Size Up To Multiple of The Alignment.
+ */
+#define MEM_ALIGN_UP(size, align)	((((size) + (align) - 1UL) / (align)) * (align))
+
+/**
+ * @brief 	Alignment of The Blocks In Each Region.
+ * @details SD DMA Needs The Larger Alignment (USB Needs USB_DATA_ALIGN_SIZE), Stacks Need 8 B (AAPCS).
+ */
+#define MEM_DMA_ALIGN				BOARD_SDMMC_DATA_BUFFER_ALIGN_SIZE
+#define MEM_SRAM_ALIGN				8UL
+#define MEM_RETAINED_ALIGN			4UL
+
+/**
+ * @brief 	Needs of The Modes In The DMA Region.
+ */
+#define MEM_RECORD_DMA_NEED			MEM_ALIGN_UP(RECORD_ARENA_SIZE, MEM_DMA_ALIGN)
+#define MEM_MSC_DMA_NEED			((USB_DEVICE_MSC_READ_BUFFERS * MEM_ALIGN_UP(USB_DEVICE_MSC_READ_BUFF_SIZE, \
+																			MEM_DMA_ALIGN)) + \
+									 (USB_DEVICE_MSC_WRITE_BUFFERS * MEM_ALIGN_UP(USB_DEVICE_MSC_WRITE_BUFF_SIZE, \
+																			 MEM_DMA_ALIGN)))
+
+/**
+ * @brief 	Size of The DMA Region, The Modes Share It Unless They Run Concurrently.
+ */
+#if (true == MSC_CONCURRENT_RECORD_ENABLED)
+#define MEM_DMA_SIZE				(MEM_RECORD_DMA_NEED + MEM_MSC_DMA_NEED)
+#else
+#define MEM_DMA_SIZE				((MEM_RECORD_DMA_NEED > MEM_MSC_DMA_NEED) ? MEM_RECORD_DMA_NEED : MEM_MSC_DMA_NEED)
+#endif /* (true == MSC_CONCURRENT_RECORD_ENABLED) */
+
+/**
+ * @brief 	Stacks of The Application Tasks Created In main.c.
+ */
+#define MEM_STACK_NEED(depth)		MEM_ALIGN_UP((uint32_t)(depth) * (uint32_t)sizeof(StackType_t), MEM_SRAM_ALIGN)
+
+#if (true == PWRLOSS_DETECTION_ENABLED)
+#define MEM_EMERGENCY_STACK_NEED	MEM_STACK_NEED(EMERGENCY_STACK_SIZE)
+#else
+#define MEM_EMERGENCY_STACK_NEED	0UL
+#endif /* (true == PWRLOSS_DETECTION_ENABLED) */
+
+#if ((true == MSC_ENABLED) && (USB_DEVICE_MSC_USE_WRITE_TASK > 0U))
+#define MEM_MSC_WRITE_STACK_NEED	MEM_STACK_NEED(MSC_WRITE_STACK_SIZE)
+#else
+#define MEM_MSC_WRITE_STACK_NEED	0UL
+#endif /* ((true == MSC_ENABLED) && (USB_DEVICE_MSC_USE_WRITE_TASK > 0U)) */
+
+#if (true == MSC_ENABLED)
+#define MEM_MSC_STACK_NEED			MEM_STACK_NEED(MSC_STACK_SIZE)
+#else
+#define MEM_MSC_STACK_NEED			0UL
+#endif /* (true == MSC_ENABLED) */
+
+/**
+ * @brief 	Needs of The Modes In The SRAM Region: Work Buffer of f_mkfs And The MSC Sector Cache.
+ */
+#define MEM_RECORD_SRAM_NEED		MEM_ALIGN_UP(FF_MAX_SS, MEM_SRAM_ALIGN)
+#if (USB_DEVICE_MSC_SECTOR_CACHE > 0U)
+#define MEM_MSC_SRAM_NEED			MEM_ALIGN_UP(USB_DEVICE_MSC_CACHE_SECTORS * 512UL, MEM_SRAM_ALIGN)
+#else
+#define MEM_MSC_SRAM_NEED			0UL
+#endif /* (USB_DEVICE_MSC_SECTOR_CACHE > 0U) */
+
+#if (true == MSC_CONCURRENT_RECORD_ENABLED)
+#define MEM_SRAM_MODE_NEED			(MEM_RECORD_SRAM_NEED + MEM_MSC_SRAM_NEED)
+#else
+#define MEM_SRAM_MODE_NEED			((MEM_RECORD_SRAM_NEED > MEM_MSC_SRAM_NEED) ? MEM_RECORD_SRAM_NEED : MEM_MSC_SRAM_NEED)
+#endif /* (true == MSC_CONCURRENT_RECORD_ENABLED) */
+
+/**
+ * @brief 	Size of The SRAM Region: Task Stacks And The Buffers of The Modes.
+ */
+#define MEM_SRAM_SIZE				(MEM_STACK_NEED(RECORD_STACK_SIZE) + MEM_EMERGENCY_STACK_NEED + \
+									 MEM_MSC_STACK_NEED + MEM_MSC_WRITE_STACK_NEED + MEM_SRAM_MODE_NEED)
+
+/**
+ * @brief 	The Regions And The FreeRTOS Heap Must Leave Room For The Rest of The Static Data And The Main Stack.
+ */
+_Static_assert((MEM_DMA_SIZE + MEM_SRAM_SIZE + MEM_RETAINED_SIZE + configTOTAL_HEAP_SIZE) < MEM_SRAM_TOTAL,
+			   "RAM budget of the regions exceeds SRAM");
+_Static_assert(USB_DATA_ALIGN_SIZE <= MEM_DMA_ALIGN, "DMA region alignment does not satisfy USB");
+
+/**
+ * @brief 	One Region.
+ * @details Common Blocks Grow From The Bottom. Blocks of Each Mode Grow From The Top, The Modes Start At The Same
+ * 			Top, So Their Blocks Overlap.
+ */
+typedef struct
+{
+	uint8_t *pu8Base;						/*<! Start of The Arena							*/
+	uint32_t u32Size;						/*<! Size of The Arena							*/
+	uint32_t u32Align;						/*<! Alignment of Blocks						*/
+	uint32_t u32Low;						/*<! Used By Common Blocks						*/
+	uint32_t au32High[MEM_OWNER_COUNT];		/*<! Used By Blocks of Each Mode				*/
+	const char *pcName;						/*<! Name In The Report							*/
+} mem_arena_t;
+
+/**
+ * @brief 	One Block, Kept For The Report.
+ */
+typedef struct
+{
+	const char *pcName;						/*<! Name of The Consumer						*/
+	uint8_t *pu8Start;						/*<! Start of The Block							*/
+	uint32_t u32Size;						/*<! Size After Alignment						*/
+	uint8_t u8Region;						/*<! mem_region_t								*/
+	uint8_t u8Owner;						/*<! mem_owner_t								*/
+} mem_block_t;
+
+/**
+ * @brief 	Static Consumer Which Does Not Draw From The Regions.
+ */
+typedef struct
+{
+	const char *pcName;
+	uint32_t u32Size;
+} mem_static_t;
+
+/*******************************************************************************
+ * Global Variables
+ ******************************************************************************/
+/**
+ * @brief 	DMA Region.
+ * @details Placed Into .noinit: ResetISR Does Not Clear It, The Recorder Keeps Its Buffers Here Over Reset
+ * 			(RETENTION_ENABLED), And The Content of The MSC Buffers Does Not Matter At Boot.
+ */
+SDK_ALIGN(static uint8_t g_au8MemDma[MEM_DMA_SIZE], MEM_DMA_ALIGN) __attribute__((section(".noinit")));
+
+/**
+ * @brief 	SRAM Region.
+ */
+SDK_ALIGN(static uint8_t g_au8MemSram[MEM_SRAM_SIZE], MEM_SRAM_ALIGN);
+
+/**
+ * @brief 	Retained Region.
+ */
+SDK_ALIGN(static uint8_t g_au8MemRetained[MEM_RETAINED_SIZE], MEM_RETAINED_ALIGN) __attribute__((section(".noinit")));
+
+/**
+ * @brief 	Regions, In The Order of mem_region_t.
+ */
+static mem_arena_t g_axMemArena[MEM_REGION_COUNT] =
+{
+	{g_au8MemDma, 		MEM_DMA_SIZE, 		MEM_DMA_ALIGN, 		0UL, {0UL}, "DMA"},
+	{g_au8MemSram, 		MEM_SRAM_SIZE, 		MEM_SRAM_ALIGN, 	0UL, {0UL}, "SRAM"},
+	{g_au8MemRetained, 	MEM_RETAINED_SIZE, 	MEM_RETAINED_ALIGN, 0UL, {0UL}, "Retained"},
+};
+
+/**
+ * @brief 	Blocks Drawn So Far.
+ */
+static mem_block_t g_axMemBlock[MEM_MAX_BLOCKS];
+static uint32_t g_u32MemBlocks = 0UL;
+
+/**
+ * @brief 	Names of The Owners In The Report.
+ */
+static const char *const g_apcMemOwner[MEM_OWNER_COUNT] = {"Common", "Record", "MSC"};
+
+/**
+ * @brief 	Consumers Outside The Regions, Listed So The Report Covers The Large Static Buffers.
+ */
+static const mem_static_t g_axMemStatic[] =
+{
+	{"FreeRTOS Heap (heap_4)", 			(uint32_t)configTOTAL_HEAP_SIZE},
+	{"Idle + Timer Task Stacks", 		(uint32_t)(configMINIMAL_STACK_SIZE + configTIMER_TASK_STACK_DEPTH) *
+										(uint32_t)sizeof(StackType_t)},
+	{"FatFs LFN Buffer", 				(uint32_t)(FF_MAX_LFN + 1) * (uint32_t)sizeof(WCHAR)},
+};
+
+/**
+ * @brief 	Bounds of The SRAM Memory And End of The Static Data, Defined By The Managed Linker Script of MCUXpresso.
+ */
+extern uint8_t __base_SRAM[];
+extern uint8_t __top_SRAM[];
+extern uint8_t _pvHeapStart[];
+
+/*******************************************************************************
+ * Functions
+ ******************************************************************************/
+void *MEM_Alloc(mem_region_t eRegion, mem_owner_t eOwner, uint32_t u32Size, const char *pcName)
+{
+	mem_arena_t *pxArena;
+	uint32_t u32Need;
+	uint32_t u32High 	= 0UL;
+	uint32_t u32Offset;
+	mem_owner_t ePlace 	= eOwner;
+
+	if ((eRegion >= MEM_REGION_COUNT) || (eOwner >= MEM_OWNER_COUNT) || (g_u32MemBlocks >= MEM_MAX_BLOCKS))
+	{
+		PRINTF("ERR: %s Not Allocated.\r\n", pcName);
+		return NULL;
+	}
+	pxArena = &g_axMemArena[eRegion];
+	u32Need = MEM_ALIGN_UP(u32Size, pxArena->u32Align);
+
+#if (true == MSC_CONCURRENT_RECORD_ENABLED)
+	/* Both Modes Run At Once, Nothing Can Be Shared */
+	ePlace = MEM_OWNER_COMMON;
+#endif /* (true == MSC_CONCURRENT_RECORD_ENABLED) */
+
+	for (uint32_t i = 1UL; i < (uint32_t)MEM_OWNER_COUNT; i++)
+	{
+		u32High = (pxArena->au32High[i] > u32High) ? pxArena->au32High[i] : u32High;
+	}
+
+	if (MEM_OWNER_COMMON == ePlace)
+	{
+		if (u32Need > (pxArena->u32Size - u32High - pxArena->u32Low))
+		{
+			PRINTF("ERR: %s (%u B) Does Not Fit Into %s Region.\r\n", pcName, u32Size, pxArena->pcName);
+			return NULL;
+		}
+		u32Offset = pxArena->u32Low;
+		pxArena->u32Low += u32Need;
+	}
+	else
+	{
+		if (u32Need > (pxArena->u32Size - pxArena->au32High[ePlace] - pxArena->u32Low))
+		{
+			PRINTF("ERR: %s (%u B) Does Not Fit Into %s Region.\r\n", pcName, u32Size, pxArena->pcName);
+			return NULL;
+		}
+		pxArena->au32High[ePlace] += u32Need;
+		u32Offset = pxArena->u32Size - pxArena->au32High[ePlace];
+	}
+
+	g_axMemBlock[g_u32MemBlocks].pcName 	= pcName;
+	g_axMemBlock[g_u32MemBlocks].pu8Start 	= &pxArena->pu8Base[u32Offset];
+	g_axMemBlock[g_u32MemBlocks].u32Size 	= u32Need;
+	g_axMemBlock[g_u32MemBlocks].u8Region 	= (uint8_t)eRegion;
+	g_axMemBlock[g_u32MemBlocks].u8Owner 	= (uint8_t)eOwner;
+	g_u32MemBlocks++;
+
+	return &pxArena->pu8Base[u32Offset];
+}
+
+void MEM_Report(void)
+{
+	const mem_arena_t *pxArena;
+	uint32_t u32Used;
+	uint32_t u32Static = (uint32_t)(_pvHeapStart - __base_SRAM);
+	uint32_t u32Sram 	= (uint32_t)(__top_SRAM - __base_SRAM);
+	uint32_t u32Regions = 0UL;
+	uint32_t u32Others 	= 0UL;
+
+	PRINTF("INFO: RAM Budget, SRAM 0x%08X - 0x%08X, Static Data %u B, %u B Left For Main Stack (ISRs).\r\n",
+		   (uint32_t)(uintptr_t)__base_SRAM, (uint32_t)(uintptr_t)__top_SRAM, u32Static,
+		   (uint32_t)(__top_SRAM - _pvHeapStart));
+
+	for (uint32_t r = 0UL; r < (uint32_t)MEM_REGION_COUNT; r++)
+	{
+		pxArena = &g_axMemArena[r];
+		u32Used = pxArena->u32Low;
+		for (uint32_t i = 1UL; i < (uint32_t)MEM_OWNER_COUNT; i++)
+		{
+			u32Used = (pxArena->u32Low + pxArena->au32High[i] > u32Used) ? (pxArena->u32Low + pxArena->au32High[i]) :
+						u32Used;
+		}
+		PRINTF("INFO:   %-8s Region 0x%08X, %u of %u B Used.\r\n", pxArena->pcName,
+			   (uint32_t)(uintptr_t)pxArena->pu8Base, u32Used, pxArena->u32Size);
+		u32Regions += pxArena->u32Size;
+
+		for (uint32_t i = 0UL; i < g_u32MemBlocks; i++)
+		{
+			if (r == (uint32_t)g_axMemBlock[i].u8Region)
+			{
+				PRINTF("INFO:     0x%08X %6u B %-6s %s\r\n", (uint32_t)(uintptr_t)g_axMemBlock[i].pu8Start,
+					   g_axMemBlock[i].u32Size, g_apcMemOwner[g_axMemBlock[i].u8Owner], g_axMemBlock[i].pcName);
+			}
+		}
+
+		/* The Arena Must Lie In The SRAM Reported By The Linker (Not In SRAMX or The USB RAM) */
+		if ((pxArena->pu8Base < __base_SRAM) || (&pxArena->pu8Base[pxArena->u32Size] > __top_SRAM))
+		{
+			PRINTF("ERR: %s Region Lies Outside of SRAM.\r\n", pxArena->pcName);
+		}
+	}
+
+	for (uint32_t i = 0UL; i < (sizeof(g_axMemStatic) / sizeof(g_axMemStatic[0])); i++)
+	{
+		PRINTF("INFO:   Static   %6u B %s\r\n", g_axMemStatic[i].u32Size, g_axMemStatic[i].pcName);
+		u32Others += g_axMemStatic[i].u32Size;
+	}
+
+	/* Regions (MSC Sector Cache In The SRAM Region) Plus The FreeRTOS Heap, Checked Against The Whole SRAM */
+	PRINTF("INFO:   Budget   %6u B of %u B SRAM (Regions %u B, Static Consumers %u B).\r\n", u32Regions + u32Others,
+		   u32Sram, u32Regions, u32Others);
+	if ((u32Regions + u32Others) > u32Sram)
+	{
+		PRINTF("ERR: RAM Budget Exceeds SRAM By %u B.\r\n", (u32Regions + u32Others) - u32Sram);
+	}
+}
@@ -23,11 +23,47 @@
 /*******************************************************************************
  * Local Definitions
  ******************************************************************************/
-/*
- * @brief 	Time Interval Between LED Blinking.
- * @details	In Milliseconds.
+/**
+ * @brief 	Maximal Baud Rate of LPUART (Functional Clock / Minimal Oversampling).
+ */
+#define PARSER_MAX_BAUDRATE			6000000UL
+
+/**
+ * @brief 	Maximal File Size Which Can Be Rounded Up To Multiple of 512 B.
+ */
+#define PARSER_MAX_FILESIZE			0xFFFFFE00UL
+
+/**
+ * @brief 	Maximal Block Size (The Index Into The Back Buffer Is 16-Bit).
+ */
+#define PARSER_MAX_BLOCK_SIZE		32768UL
+
+/**
+ * @brief 	Maximal Idle Flush Timeout And LED Interval In Milliseconds.
+ */
+#define PARSER_MAX_INTERVAL_MS		600000UL
+
+/**
+ * @brief 	Maximal LPUART Rx Watermark, The FIFO Has 8 Entries.
  */
-#define RECORD_LED_TIME_INTERVAL 	(uint32_t)(10U)
+#define PARSER_MAX_RX_WATERMARK		7UL
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+static void PARSER_SetBaudrate(uint32_t u32Value);
+static void PARSER_SetFileSize(uint32_t u32Value);
+static void PARSER_SetStopBits(uint32_t u32Value);
+static void PARSER_SetDataBits(uint32_t u32Value);
+static void PARSER_SetParity(uint32_t u32Value);
+static void PARSER_SetFreeSpace(uint32_t u32Value);
+static void PARSER_SetDurability(uint32_t u32Value);
+static void PARSER_SetMode(uint32_t u32Value);
+static void PARSER_SetFifoSize(uint32_t u32Value);
+static void PARSER_SetBlockSize(uint32_t u32Value);
+static void PARSER_SetFlushTimeout(uint32_t u32Value);
+static void PARSER_SetLedInterval(uint32_t u32Value);
+static void PARSER_SetRxWatermark(uint32_t u32Value);
 
 /*******************************************************************************
  * Global Variables
@@ -37,338 +73,596 @@
  * 			Obtained From The Configuration File.
  */
 static REC_config_t g_config;
+
+/**
+ * @brief 	Names of The Enumerated Values.
+ */
+static const parser_name_t g_axStopBitsNames[] =
+{
+	{"1", (uint32_t)kLPUART_OneStopBit}, {"2", (uint32_t)kLPUART_TwoStopBit}, {NULL, 0UL}
+};
+
+static const parser_name_t g_axDataBitsNames[] =
+{
+	{"7", (uint32_t)kLPUART_SevenDataBits}, {"8", (uint32_t)kLPUART_EightDataBits}, {NULL, 0UL}
+};
+
+static const parser_name_t g_axParityNames[] =
+{
+	{"none", (uint32_t)kLPUART_ParityDisabled}, {"even", (uint32_t)kLPUART_ParityEven},
+	{"odd", (uint32_t)kLPUART_ParityOdd}, {NULL, 0UL}
+};
+
+static const parser_name_t g_axModeNames[] =
+{
+	{"text", (uint32_t)RECORD_MODE_TEXT},
+#if (true == BINARY_MODE_ENABLED)
+	{"binary", (uint32_t)RECORD_MODE_BINARY},
+#endif /* (true == BINARY_MODE_ENABLED) */
+	{NULL, 0UL}
+};
+
+/**
+ * @brief 	Key Descriptors, Defaults Are Applied In This Order (Baud Rate First, Other Values Derive From It).
+ */
+static const parser_key_t g_axKeys[] =
+{
+	{"baudrate", 		PARSER_TYPE_UINT, 1UL, PARSER_MAX_BAUDRATE, DEFAULT_BAUDRATE, NULL, PARSER_SetBaudrate},
+	{"file_size", 		PARSER_TYPE_UINT, 1UL, PARSER_MAX_FILESIZE, DEFAULT_MAX_FILESIZE, NULL, PARSER_SetFileSize},
+	{"stop_bits", 		PARSER_TYPE_ENUM, 0UL, 0UL, (uint32_t)DEFAULT_STOP_BITS, g_axStopBitsNames, PARSER_SetStopBits},
+	{"data_bits", 		PARSER_TYPE_ENUM, 0UL, 0UL, (uint32_t)DEFAULT_DATA_BITS, g_axDataBitsNames, PARSER_SetDataBits},
+	{"parity", 			PARSER_TYPE_ENUM, 0UL, 0UL, (uint32_t)DEFAULT_PARITY, g_axParityNames, PARSER_SetParity},
+	{"free_space", 		PARSER_TYPE_UINT, 0UL, UINT32_MAX, DEFAULT_FREE_SPACE, NULL, PARSER_SetFreeSpace},
+	{"durability_ms", 	PARSER_TYPE_UINT, 0UL, UINT32_MAX, DEFAULT_DURABILITY_MS, NULL, PARSER_SetDurability},
+	{"mode", 			PARSER_TYPE_ENUM, 0UL, 0UL, (uint32_t)DEFAULT_RECORD_MODE, g_axModeNames, PARSER_SetMode},
+	{"fifo_size", 		PARSER_TYPE_UINT, 1UL, RECORD_ARENA_SIZE, DEFAULT_FIFO_SIZE, NULL, PARSER_SetFifoSize},
+	{"block_size", 		PARSER_TYPE_UINT, 1UL, PARSER_MAX_BLOCK_SIZE, DEFAULT_BLOCK_SIZE, NULL, PARSER_SetBlockSize},
+	{"flush_timeout_ms",PARSER_TYPE_UINT, 10UL, PARSER_MAX_INTERVAL_MS, DEFAULT_FLUSH_TIMEOUT_MS, NULL,
+						PARSER_SetFlushTimeout},
+	{"led_interval_ms", PARSER_TYPE_UINT, 1UL, PARSER_MAX_INTERVAL_MS, DEFAULT_LED_INTERVAL_MS, NULL,
+						PARSER_SetLedInterval},
+	{"rx_watermark", 	PARSER_TYPE_UINT, 0UL, PARSER_MAX_RX_WATERMARK, DEFAULT_RX_WATERMARK, NULL,
+						PARSER_SetRxWatermark},
+};
+
+/**
+ * @brief 	Number of Keys.
+ */
+#define PARSER_KEY_COUNT			(sizeof(g_axKeys) / sizeof(g_axKeys[0]))
+
+/**
+ * @brief 	Line Being Collected By The Tokenizer.
+ */
+static char g_acLine[PARSER_LINE_SIZE + 1U];
+
+/**
+ * @brief 	Length of The Collected Line, Number of The Line And Number of Invalid Lines.
+ */
+static uint32_t g_u32LineLength 	= 0UL;
+static uint32_t g_u32LineNumber 	= 1UL;
+static uint32_t g_u32LineErrors 	= 0UL;
+
+/**
+ * @brief 	The Line Is Longer Than PARSER_LINE_SIZE or Contains a Control Character.
+ */
+static bool g_bLineTooLong 			= false;
+static bool g_bLineInvalidChar 		= false;
+
+/**
+ * @brief 	Keys Set By The File, One Bit Per Descriptor (Duplicates Are Reported).
+ */
+static uint32_t g_u32KeysSeen 		= 0UL;
+
 /*******************************************************************************
  * Interrupt Service Routines (ISRs)
  ******************************************************************************/
 
 
 /*******************************************************************************
- * Functions
+ * Static Functions
  ******************************************************************************/
-REC_config_t PARSER_GetConfig(void)
+/**
+ * @brief 	Derives The Bytes Between LED Blinking From The Baud Rate And The LED Interval.
+ */
+static void PARSER_UpdateMaxBytes(void)
 {
-	return g_config;
+	g_config.max_bytes = (g_config.baudrate / 1000UL) * g_config.led_interval_ms;
 }
 
-REC_version_t PARSER_GetVersion(void)
+/**
+ * @brief 	Sets The Baud Rate, The Recorded Board Version And The Bytes Between LED Blinking.
+ */
+static void PARSER_SetBaudrate(uint32_t u32Value)
 {
-	return g_config.version;
+    if (230400UL == u32Value)
+    {
+    	g_config.version = WCT_AUTOS2;
+    }
+    else if (115200UL == u32Value)
+    {
+    	g_config.version = WCT_AUTOS1;
+    }
+    else
+    {
+    	g_config.version = WCT_UNKOWN;
+    }
+
+    g_config.baudrate 	= u32Value;
+    PARSER_UpdateMaxBytes();
 }
 
-uint32_t PARSER_GetBaudrate(void)
+/**
+ * @brief 	Rounds The Size Up To Multiple of 512 B (Sector).
+ *
+ * @param 	pcKey Key For The Message.
+ * @param 	u32Value Size, At Most 0xFFFFFE00.
+ *
+ * @return 	Rounded Size.
+ */
+static uint32_t PARSER_RoundToSector(const char *pcKey, uint32_t u32Value)
 {
-	return g_config.baudrate;
+    if (0UL != (u32Value % 512UL))
+    {
+        uint32_t u32Rounded = ((u32Value + 511UL) / 512UL) * 512UL;
+#if (true == INFO_ENABLED)
+        PRINTF("INFO: %s %u is not multiple of 512. Rounding up to %u.\r\n", pcKey, u32Value, u32Rounded);
+#else
+        (void)pcKey;
+#endif /* (true == INFO_ENABLED) */
+        u32Value = u32Rounded;
+    }
+    return u32Value;
 }
 
-uint32_t PARSER_GetFileSize(void)
+/**
+ * @brief 	Sets The Maximal File Size, Rounded Up To Multiple of 512 B.
+ */
+static void PARSER_SetFileSize(uint32_t u32Value)
 {
-	return g_config.size;
+    g_config.size = PARSER_RoundToSector("file_size", u32Value);
 }
 
-lpuart_data_bits_t PARSER_GetDataBits(void)
+/**
+ * @brief 	Sets The Number of Stop Bits (lpuart_stop_bit_count_t).
+ */
+static void PARSER_SetStopBits(uint32_t u32Value)
 {
-	return g_config.data_bits;
+	g_config.stop_bits = (lpuart_stop_bit_count_t)u32Value;
 }
 
-lpuart_parity_mode_t PARSER_GetParity(void)
+/**
+ * @brief 	Sets The Number of Data Bits (lpuart_data_bits_t).
+ */
+static void PARSER_SetDataBits(uint32_t u32Value)
 {
-	return g_config.parity;
+	g_config.data_bits = (lpuart_data_bits_t)u32Value;
 }
 
-lpuart_stop_bit_count_t PARSER_GetStopBits(void)
+/**
+ * @brief 	Sets The Parity (lpuart_parity_mode_t).
+ */
+static void PARSER_SetParity(uint32_t u32Value)
 {
-	return g_config.stop_bits;
+	g_config.parity = (lpuart_parity_mode_t)u32Value;
 }
 
-uint32_t PARSER_GetFreeSpaceLimitMB(void)
+/**
+ * @brief 	Sets The Free Space Limit In MB, 0 Disables The Indication.
+ */
+static void PARSER_SetFreeSpace(uint32_t u32Value)
 {
-	return g_config.free_space_limit_mb;
+	g_config.free_space_limit_mb = u32Value;
 }
 
-uint32_t PARSER_GetMaxBytes(void)
+/**
+ * @brief 	Sets The Durability Target In Milliseconds, 0 Disables The Alerts.
+ */
+static void PARSER_SetDurability(uint32_t u32Value)
 {
-	return g_config.max_bytes;
+	g_config.durability_ms = u32Value;
 }
 
-void PARSER_ClearConfig(void)
+/**
+ * @brief 	Sets The Format of The Stored Data (REC_mode_t).
+ */
+static void PARSER_SetMode(uint32_t u32Value)
 {
-	g_config.baudrate  	= DEFAULT_BAUDRATE;
-	g_config.max_bytes = (uint32_t)((DEFAULT_BAUDRATE / 1000UL) * RECORD_LED_TIME_INTERVAL);
-	g_config.version 	= WCT_UNKOWN;
+	g_config.mode = (REC_mode_t)u32Value;
+}
 
-	g_config.parity 	= DEFAULT_PARITY;
-	g_config.stop_bits 	= DEFAULT_STOP_BITS;
-	g_config.data_bits 	= DEFAULT_DATA_BITS;
+/**
+ * @brief 	Sets The Size of The Software FIFO, Rounded Up To Multiple of 512 B (It Is Dumped In Sectors).
+ */
+static void PARSER_SetFifoSize(uint32_t u32Value)
+{
+	g_config.fifo_size = PARSER_RoundToSector("fifo_size", u32Value);
+}
 
-	g_config.free_space_limit_mb = DEFAULT_FREE_SPACE;
+/**
+ * @brief 	Sets The Size of One Block, Rounded Up To Multiple of 512 B.
+ */
+static void PARSER_SetBlockSize(uint32_t u32Value)
+{
+	g_config.block_size = PARSER_RoundToSector("block_size", u32Value);
 }
 
-error_t PARSER_ParseBaudrate(const char *chContent)
+/**
+ * @brief 	Sets The Idle Flush Timeout In Milliseconds.
+ */
+static void PARSER_SetFlushTimeout(uint32_t u32Value)
 {
-    const char *chKey = "baudrate=";
-    char *chFound = strstr(chContent, chKey);
-    if (NULL == chFound)
-    {
-        PRINTF("ERR: Key 'baudrate=' not found.\r\n");
-        return ERROR_READ;
-    }
+	g_config.flush_timeout_ms = u32Value;
+}
 
-    chFound += strlen(chKey);
-    /* MISRA Deviation Note:
-     * Rule: MISRA 2012 Rule 21.7 [Required]
-     * Suppress: Use Of Standard Library Function 'atoi'.
-     * Justification: Use of 'atoi' is Intentional in Controlled Context.
-     * The Input String 'chFound' Should Contain Only Numeric Characters - Baud Rate.
-     */
-    /*lint -e586 */
-    uint32_t u32Baudrate = (uint32_t)atoi(chFound);			// Convert Value To INT
-    /*lint +e586 */
-
-    if (0UL == u32Baudrate)
-    {
-        PRINTF("ERR: Invalid baudrate value.\r\n");
-        return ERROR_READ;
-    }
+/**
+ * @brief 	Sets The Time Interval Between LED Blinking In Milliseconds.
+ */
+static void PARSER_SetLedInterval(uint32_t u32Value)
+{
+	g_config.led_interval_ms = u32Value;
+	PARSER_UpdateMaxBytes();
+}
 
+/**
+ * @brief 	Sets The LPUART Rx FIFO Watermark.
+ */
+static void PARSER_SetRxWatermark(uint32_t u32Value)
+{
+	g_config.rx_watermark = (uint8_t)u32Value;
+}
 
-    if (230400UL == u32Baudrate)
-    {
-    	g_config.version = WCT_AUTOS2;
-    }
-    else if (115200UL == u32Baudrate)
-    {
-    	g_config.version = WCT_AUTOS1;
-    }
-    else
-    {
-    	g_config.version = WCT_UNKOWN;
-    }
+/**
+ * @brief 	Checks Whether The Character Is Space or Tab.
+ *
+ * @param 	cChar Character.
+ *
+ * @return 	True For Blank Character.
+ */
+static bool PARSER_IsBlank(char cChar)
+{
+	return (' ' == cChar) || ('\t' == cChar);
+}
 
-    g_config.baudrate = u32Baudrate;
+/**
+ * @brief 	Removes Leading And Trailing Blanks In Place.
+ *
+ * @param 	pcText Null-Terminated Text.
+ *
+ * @return 	Start of The Trimmed Text.
+ */
+static char *PARSER_Trim(char *pcText)
+{
+	size_t length;
 
-    return ERROR_NONE;
+	while (PARSER_IsBlank(*pcText))
+	{
+		pcText++;
+	}
+	length = strlen(pcText);
+	while ((length > 0U) && PARSER_IsBlank(pcText[length - 1U]))
+	{
+		length--;
+	}
+	pcText[length] = '\0';
+	return pcText;
 }
 
-error_t PARSER_ParseFileSize(const char *chContent)
+/**
+ * @brief 	Converts Decimal Number Without Sign, The Whole Text Must Be Digits.
+ *
+ * @param 	pcText Null-Terminated Text.
+ * @param 	pu32Value Converted Value.
+ *
+ * @return 	True If The Text Is a Number Which Fits Into 32 Bits.
+ */
+static bool PARSER_ToUint(const char *pcText, uint32_t *pu32Value)
 {
-    const char *chKey = "file_size=";
-    uint32_t u32Value = DEFAULT_MAX_FILESIZE;
+	uint32_t u32Value = 0UL;
 
-    char *chFound = strstr(chContent, chKey);
+	if ('\0' == *pcText)
+	{
+		return false;
+	}
 
-    if (NULL == chFound)
-    {
-        PRINTF("ERR: Key 'file_size=' not found.\r\n");
-        /* Continue With Default */
-    }
-    else
-    {
-		chFound += strlen(chKey);
-		/* MISRA Deviation Note:
-		 * Rule: MISRA 2012 Rule 21.7 [Required]
-		 * Suppress: Use Of Standard Library Function 'atoi'.
-		 * Justification: Use of 'atoi' is Intentional in Controlled Context.
-		 * The Input String 'chFound' Should Contain Only Numeric Characters - File Size.
-		 */
-		/*lint -e586 */
-		u32Value = (uint32_t)atoi(chFound);			// Convert Value To INT
-		/*lint +e586 */
-
-		if (0UL == u32Value)
+	for (; '\0' != *pcText; pcText++)
+	{
+		uint32_t u32Digit = (uint32_t)((uint8_t)*pcText) - (uint32_t)'0';
+		if (u32Digit > 9UL)
 		{
-			PRINTF("ERR: Invalid file size value.\r\n");
-			return ERROR_READ;
+			return false;
 		}
-    }
+		if (u32Value > ((UINT32_MAX - u32Digit) / 10UL))
+		{
+			return false;
+		}
+		u32Value = (u32Value * 10UL) + u32Digit;
+	}
 
-    if (0UL != (u32Value % 512UL))
-    {
-        uint32_t u32Rounded = ((u32Value + 511UL) / 512UL) * 512UL;
+	*pu32Value = u32Value;
+	return true;
+}
+
+/**
+ * @brief 	Reports Invalid Line of The Configuration File.
+ *
+ * @param 	pcReason Description of The Error.
+ * @param 	pcText Invalid Part of The Line.
+ */
+static void PARSER_LineError(const char *pcReason, const char *pcText)
+{
+	g_u32LineErrors++;
+	PRINTF("ERR: %s Line %u: %s '%s'.\r\n", CONFIG_FILE, g_u32LineNumber, pcReason, pcText);
+}
+
+/**
+ * @brief 	Parses One Line And Applies Its Value Through The Key Descriptor.
+ *
+ * @param 	pcLine Null-Terminated Line Without Line End.
+ */
+static void PARSER_ProcessLine(char *pcLine)
+{
+	char *pcKey;
+	char *pcValue;
+	char *pcSeparator;
+	uint32_t u32Value = 0UL;
+	uint32_t i;
+	bool bValid = false;
+
+	/* Comment Till The End of Line */
+	pcSeparator = strpbrk(pcLine, "#;");
+	if (NULL != pcSeparator)
+	{
+		*pcSeparator = '\0';
+	}
+
+	pcKey = PARSER_Trim(pcLine);
+	if ('\0' == *pcKey)
+	{
+		return;
+	}
+
+	pcSeparator = strchr(pcKey, '=');
+	if (NULL == pcSeparator)
+	{
+		PARSER_LineError("Expected 'key=value'", pcKey);
+		return;
+	}
+	*pcSeparator = '\0';
+	pcKey 	= PARSER_Trim(pcKey);
+	pcValue = PARSER_Trim(pcSeparator + 1);
+
+	for (i = 0UL; i < PARSER_KEY_COUNT; i++)
+	{
+		if (0 == strcmp(pcKey, g_axKeys[i].pcKey))
+		{
+			break;
+		}
+	}
+	if (PARSER_KEY_COUNT == i)
+	{
+		PARSER_LineError("Unknown Key", pcKey);
+		return;
+	}
+
+	if (PARSER_TYPE_UINT == g_axKeys[i].eType)
+	{
+		bValid = PARSER_ToUint(pcValue, &u32Value) &&
+				 (u32Value >= g_axKeys[i].u32Min) && (u32Value <= g_axKeys[i].u32Max);
+	}
+	else
+	{
+		for (const parser_name_t *pxName = g_axKeys[i].pxNames; NULL != pxName->pcName; pxName++)
+		{
+			if (0 == strcmp(pcValue, pxName->pcName))
+			{
+				u32Value = pxName->u32Value;
+				bValid = true;
+				break;
+			}
+		}
+	}
+
+	if (!bValid)
+	{
+		PARSER_LineError("Invalid Value", pcValue);
+		return;
+	}
+
+	if (0UL != (g_u32KeysSeen & (1UL << i)))
+	{
 #if (true == INFO_ENABLED)
-        PRINTF("INFO: File size %u is not multiple of 512. Rounding up to %u.\r\n", u32Value, u32Rounded);
+		PRINTF("INFO: %s Line %u: Key '%s' Repeated, The Last Value Is Used.\r\n", CONFIG_FILE, g_u32LineNumber,
+			   pcKey);
 #endif /* (true == INFO_ENABLED) */
-        u32Value = u32Rounded;
-    }
+	}
+	g_u32KeysSeen |= (1UL << i);
+
+	g_axKeys[i].pfSet(u32Value);
+}
 
-    g_config.size = u32Value;
-    g_config.max_bytes = (g_config.baudrate / 1000UL) * RECORD_LED_TIME_INTERVAL;
+/**
+ * @brief 	Finishes The Collected Line And Prepares The Next One.
+ */
+static void PARSER_EndLine(void)
+{
+	g_acLine[g_u32LineLength] = '\0';
 
-#if (true == DEBUG_ENABLED)
-    PRINTF("DEBUG: File size set to %u bytes.\r\n", g_config.size);
-#endif /* (true == DEBUG_ENABLED) */
+	if (g_bLineTooLong)
+	{
+		PARSER_LineError("Line Too Long", g_acLine);
+	}
+	else if (g_bLineInvalidChar)
+	{
+		PARSER_LineError("Invalid Character", g_acLine);
+	}
+	else
+	{
+		PARSER_ProcessLine(g_acLine);
+	}
 
-    return ERROR_NONE;
+	g_u32LineLength 	= 0UL;
+	g_bLineTooLong 		= false;
+	g_bLineInvalidChar 	= false;
+	g_u32LineNumber++;
 }
 
+/*******************************************************************************
+ * Functions
+ ******************************************************************************/
+REC_config_t PARSER_GetConfig(void)
+{
+	return g_config;
+}
 
-error_t PARSER_ParseParity(const char *chContent)
+REC_version_t PARSER_GetVersion(void)
 {
-    const char *chKeyParity = "parity=";
-    char *chFound = strstr(chContent, chKeyParity);
-    if (NULL == chFound)
-    {
-#if (true == INFO_ENABLED)
-        PRINTF("INFO: Key 'parity=' not found. Using default.\r\n");
-#endif /* (true == INFO_ENABLED) */
-        return ERROR_NONE;
-    }
+	return g_config.version;
+}
 
-    chFound += strlen(chKeyParity);
+uint32_t PARSER_GetBaudrate(void)
+{
+	return g_config.baudrate;
+}
 
-    if (0 == strncmp(chFound, "none", 4))
-    {
-        g_config.parity = kLPUART_ParityDisabled;
-    }
-    else if (0 == strncmp(chFound, "even", 4))
-    {
-        g_config.parity = kLPUART_ParityEven;
-    }
-    else if (0 == strncmp(chFound, "odd", 3))
-    {
-        g_config.parity = kLPUART_ParityOdd;
-    }
-    else
-    {
-        PRINTF("ERR: Invalid value for 'parity': %s\r\n", chFound);
-        return ERROR_READ;
-    }
+uint32_t PARSER_GetFileSize(void)
+{
+	return g_config.size;
+}
+
+lpuart_data_bits_t PARSER_GetDataBits(void)
+{
+	return g_config.data_bits;
+}
 
-    return ERROR_NONE;
+lpuart_parity_mode_t PARSER_GetParity(void)
+{
+	return g_config.parity;
 }
 
-error_t PARSER_ParseStopBits(const char *chContent)
+lpuart_stop_bit_count_t PARSER_GetStopBits(void)
 {
-    const char *chKeyStopBits = "stop_bits=";
-    char *chFound = strstr(chContent, chKeyStopBits);
-    if (NULL == chFound)
-    {
-#if (true == INFO_ENABLED)
-        PRINTF("INFO: Key 'stop_bits=' not found. Using default.\r\n");
-#endif /* (true == DEBUG_ENABLED) */
-        return ERROR_NONE;
-    }
+	return g_config.stop_bits;
+}
 
-    chFound += strlen(chKeyStopBits);
-    /* MISRA Deviation Note:
-     * Rule: MISRA 2012 Rule 21.7 [Required]
-     * Suppress: Use Of Standard Library Function 'atoi'.
-     * Justification: Use of 'atoi' is Intentional in Controlled Context.
-     * The Input String 'chFound' Should Contain Only Numeric Characters - Stop Bits.
-     */
-    /*lint -e586 */
-    uint32_t u32StopBits = (uint32_t)atoi(chFound);			// Convert Value To INT
-    /*lint +e586 */
-    if (1UL == u32StopBits)
-    {
-        g_config.stop_bits = kLPUART_OneStopBit;
-        return ERROR_NONE;
-    }
-    else if (2UL == u32StopBits)
-	{
-		g_config.stop_bits = kLPUART_TwoStopBit;
-		return ERROR_NONE;
-	}
-    else
-    {
-    	;	/* To avoid MISRA 2012 Rule 15.7 required rule */
-    		/* Selected 1 Stop Bit By Default */
-    }
+uint32_t PARSER_GetFreeSpaceLimitMB(void)
+{
+	return g_config.free_space_limit_mb;
+}
 
-    PRINTF("ERR: Invalid value for 'stop_bits': %u\r\n", u32StopBits);
-    return ERROR_READ;
+uint32_t PARSER_GetMaxBytes(void)
+{
+	return g_config.max_bytes;
 }
 
+uint32_t PARSER_GetDurabilityMs(void)
+{
+	return g_config.durability_ms;
+}
 
-error_t PARSER_ParseDataBits(const char *chContent)
+REC_mode_t PARSER_GetMode(void)
 {
-    const char *chKeyDataBits = "data_bits=";
-    char *chFound = strstr(chContent, chKeyDataBits);
-    if (NULL == chFound)
-    {
-#if (true == INFO_ENABLED)
-        PRINTF("INFO: Key 'data_bits=' not found. Using default.\r\n");
-#endif /* (true == INFO_ENABLED) */
-        return ERROR_NONE;
-    }
+	return g_config.mode;
+}
 
-    chFound += strlen(chKeyDataBits);
-    /* MISRA Deviation Note:
-     * Rule: MISRA 2012 Rule 21.7 [Required]
-     * Suppress: Use Of Standard Library Function 'atoi'.
-     * Justification: Use of 'atoi' is Intentional in Controlled Context.
-     * The Input String 'chFound' Should Contain Only Numeric Characters - Data Bits.
-     */
-    /*lint -e586 */
-    uint32_t u32DataBits = (uint32_t)atoi(chFound);			// Convert Value To INT
-    /*lint +e586 */
-    if (7UL == u32DataBits)
-    {
-        g_config.data_bits = kLPUART_SevenDataBits;
-        return ERROR_NONE;
-    }
-    else if (8UL == u32DataBits)
-    {
-        g_config.data_bits = kLPUART_EightDataBits;
-        return ERROR_NONE;
-    }
-    else
+uint32_t PARSER_GetFifoSize(void)
+{
+	return g_config.fifo_size;
+}
+
+uint32_t PARSER_GetBlockSize(void)
+{
+	return g_config.block_size;
+}
+
+uint32_t PARSER_GetFlushTimeoutMs(void)
+{
+	return g_config.flush_timeout_ms;
+}
+
+uint8_t PARSER_GetRxWatermark(void)
+{
+	return g_config.rx_watermark;
+}
+
+void PARSER_ClearConfig(void)
+{
+	for (uint32_t i = 0UL; i < PARSER_KEY_COUNT; i++)
 	{
-		; 	/* To avoid MISRA 2012 Rule 15.7 required rule */
-			/* Selected 8 Data Bits By Default */
+		g_axKeys[i].pfSet(g_axKeys[i].u32Default);
 	}
-
-    PRINTF("ERR: Invalid value for 'data_bits': %u\r\n", u32DataBits);
-    return ERROR_READ;
 }
 
-error_t PARSER_ParseFreeSpace(const char *chContent)
+void PARSER_SetConfig(const REC_config_t *pxConfig)
 {
-    const char *chKey = "free_space=";
-    char *chFound = strstr(chContent, chKey);
-    if (NULL == chFound)
-    {
-#if (true == INFO_ENABLED)
-        PRINTF("INFO: Key 'free_space=' not found. Using default.\r\n");
-#endif /* (true == INFO_ENABLED) */
-        g_config.free_space_limit_mb = DEFAULT_FREE_SPACE;
-        return ERROR_NONE;
-    }
+	g_config = *pxConfig;
+}
 
-    chFound += strlen(chKey);
+void PARSER_Begin(void)
+{
+	PARSER_ClearConfig();
+
+	g_u32LineLength 	= 0UL;
+	g_u32LineNumber 	= 1UL;
+	g_u32LineErrors 	= 0UL;
+	g_u32KeysSeen 		= 0UL;
+	g_bLineTooLong 		= false;
+	g_bLineInvalidChar 	= false;
+}
 
-    errno = 0;  // Reset errno Before Parsing
-    char *endptr = NULL;
+void PARSER_Feed(const char *pcData, uint32_t u32Length)
+{
+	for (uint32_t i = 0UL; i < u32Length; i++)
+	{
+		char cChar = pcData[i];
 
-    /**
-     * MISRA Deviation: Rule 21.6 [Required]
-     * Suppress: Use of Standard Library Function 'strtoul'.
-     * Justification: 'strtoul' is Used With Trusted Input For Converting a String to an Unsigned Long Value.
-     * The Usage is Controlled and Verified, Ensuring That The Input Cannot Cause Unexpected Behavior.
-     */
-    /*lint -e586 */
-    unsigned long ulParsedValue = strtoul(chFound, &endptr, 10);
-    /*lint +e586 */
-    int s32LocalErrno = errno;
+		if ('\n' == cChar)
+		{
+			PARSER_EndLine();
+		}
+		else if ('\r' == cChar)
+		{
+			;	/* CRLF Line Ends */
+		}
+		else if (g_u32LineLength >= PARSER_LINE_SIZE)
+		{
+			g_bLineTooLong = true;
+		}
+		else
+		{
+			/* Control Characters (Null Included) Except Tab Are Not Valid In a Line */
+			if (((uint8_t)cChar < (uint8_t)' ') && ('\t' != cChar))
+			{
+				g_bLineInvalidChar = true;
+				cChar = '?';
+			}
+			g_acLine[g_u32LineLength++] = cChar;
+		}
+	}
+}
 
-    /* Conversion Errors Check (Only 32bit Number) */
-    if ((endptr == chFound) || (0 != s32LocalErrno))
-    {
-        PRINTF("ERR: Invalid or out-of-range value for 'free_space=': %s\r\n", chFound);
-        return ERROR_READ;
-    }
+error_t PARSER_End(void)
+{
+	/* Last Line Without Line End */
+	if ((g_u32LineLength > 0UL) || g_bLineTooLong)
+	{
+		PARSER_EndLine();
+	}
 
-    g_config.free_space_limit_mb = (uint32_t)ulParsedValue;
+	if (0UL != g_u32LineErrors)
+	{
+		PRINTF("ERR: %u Invalid Line(s) In %s, Their Keys Keep Default Values.\r\n", g_u32LineErrors, CONFIG_FILE);
+		return ERROR_CONFIG;
+	}
 
 #if (true == INFO_ENABLED)
-    if (0UL == g_config.free_space_limit_mb)
-    {
-        PRINTF("INFO: 'free_space=' set to 0 MB, threshold disabled.\r\n");
-    }
-    else
-    {
-        PRINTF("INFO: Free space LED threshold set to %lu MB.\r\n", ulParsedValue);
-    }
+	PRINTF("INFO: Configuration Loaded: baudrate %u, file_size %u, free_space %u MB, durability %u ms.\r\n",
+		   g_config.baudrate, g_config.size, g_config.free_space_limit_mb, g_config.durability_ms);
 #endif /* (true == INFO_ENABLED) */
+	return ERROR_NONE;
+}
 
-    return ERROR_NONE;
+const parser_key_t *PARSER_GetKeys(uint32_t *pu32Count)
+{
+	*pu32Count = (uint32_t)PARSER_KEY_COUNT;
+	return g_axKeys;
 }
@@ -21,6 +21,8 @@
 #include "pwrloss_det.h"
 
 #include "record.h"
+#include "trace.h"
+#include "app_tasks.h"
 /*******************************************************************************
  * Local Definitions
  ******************************************************************************/
@@ -39,6 +41,15 @@
 /*******************************************************************************
  * Global Variables
  ******************************************************************************/
+/**
+ * @brief 	DWT Cycle Counter At The Comparator Trip.
+ */
+static volatile uint32_t g_u32PwrlossTripCycles = 0UL;
+
+/**
+ * @brief 	Worst Measured Time From The Comparator Trip Till The Data Are Safe On The Card [us].
+ */
+static uint32_t g_u32PwrlossWorstUs 			= 0UL;
 
 /*******************************************************************************
  * Interrupt Service Routines (ISRs)
@@ -98,17 +109,27 @@ void CTIMER4_IRQHandler(void)
  */
 void HSCMP1_IRQHandler(void)
 {
+	BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+	g_u32PwrlossTripCycles = DWT->CYCCNT;
+	TRACE_BEGIN(TRACE_ID_PWRLOSS);
 	LPCMP_ClearStatusFlags(LPCMP_BASE, (uint32_t)kLPCMP_OutputFallingEventFlag);
 
 
 	UART_Disable();						/* Disable Character Reception			*/
-	(void)CONSOLELOG_PowerLossFlush();	/* Flush Data From Buffer To SDHC Card 	*/
+
+	/* FatFs And SD Driver Must Not Run Here, The Emergency Task Flushes Data From Buffer To SDHC Card */
+	if (NULL != g_xEmergencyTaskHandle)
+	{
+		vTaskNotifyGiveFromISR(g_xEmergencyTaskHandle, &xHigherPriorityTaskWoken);
+	}
 
 #if (true == PWRLOSS_TEST_GPIOS)
 	LED_SetHigh(GPIO0, 23);				/* Signal Power Loss 					*/
 	LED_SetLow(GPIO0, 15);
 #endif /* (true == PWRLOSS_TEST_GPIOS) */
 
+	portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
 	SDK_ISR_EXIT_BARRIER;
 
 }
@@ -188,3 +209,26 @@ void PWRLOSS_DetectionInit(void)
 
 	return;
 }
+
+void PWRLOSS_ReportTripToSafe(void)
+{
+	uint32_t u32Us = (DWT->CYCCNT - g_u32PwrlossTripCycles) / (SystemCoreClock / 1000000UL);
+
+	TRACE_END(TRACE_ID_PWRLOSS);
+
+	if (u32Us > g_u32PwrlossWorstUs)
+	{
+		g_u32PwrlossWorstUs = u32Us;
+	}
+
+#if (true == INFO_ENABLED)
+	PRINTF("INFO: Power Loss Trip-To-Safe %u us (Worst %u us, Hold-Up Budget %u us).\r\n",
+		   u32Us, g_u32PwrlossWorstUs, PWRLOSS_HOLDUP_BUDGET_US);
+#endif /* (true == INFO_ENABLED) */
+
+	if (g_u32PwrlossWorstUs > PWRLOSS_HOLDUP_BUDGET_US)
+	{
+		PRINTF("ERR: Power Loss Flush Exceeds The Hold-Up Budget (%u us > %u us).\r\n",
+			   g_u32PwrlossWorstUs, PWRLOSS_HOLDUP_BUDGET_US);
+	}
+}
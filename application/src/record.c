@@ -20,20 +20,76 @@
  ******************************************************************************/
 #include <record.h>
 #include "fsl_irtc.h"
+#include "timers.h"
+#include "semphr.h"
+#include "usb_device_cdc_acm.h"
+#include "usb_disk_adapter.h"
+#include "diagnostics.h"
+#include "trace.h"
+#include "latency.h"
+#include "dump.h"
+#include "mem.h"
 
 #include <limits.h>
+#include <stddef.h>
 /*******************************************************************************
  * Definitions
  ******************************************************************************/
 /**
- * @brief 	Software FIFO Size.
+ * @brief 	Number of Recording Blocks: Back And Front Buffer, Plus Spare Blocks Streamed To The USB CDC Host.
  */
-#define CIRCULAR_BUFFER_SIZE 		1024U
+#if (USB_DEVICE_CONFIG_CDC_ACM > 0U)
+#define RECORD_BLOCK_COUNT 			(2U + USB_DEVICE_CDC_STREAM_QUEUE_LENGTH)
+#else
+#define RECORD_BLOCK_COUNT 			2U
+#endif /* (USB_DEVICE_CONFIG_CDC_ACM > 0U) */
+
+/**
+ * @brief 	Sizes of The FIFO And Blocks Are Multiples of The Sector (Card Writes, Dump Regions).
+ */
+#define RECORD_SECTOR_SIZE 			512U
+
+/**
+ * @brief 	Size of The Arena Part For One FIFO Byte (Data And Its Arrival Tick).
+ */
+#define RECORD_FIFO_BYTE_COST 		(sizeof(uint8_t) + sizeof(uint16_t))
+
+/**
+ * @brief 	Maximal Block Size, The Index Into The Back Buffer Is 16-Bit.
+ */
+#define RECORD_MAX_BLOCK_SIZE 		32768UL
+
+#if (true == RETENTION_ENABLED)
+/**
+ * @brief 	Places a Variable Into Retention RAM (Section .noinit).
+ * @details The Managed Linker Script of MCUXpresso Places .noinit As NOLOAD Behind .bss, ResetISR (data_init, bss_init)
+ * 			Neither Copies Nor Zeroes It. The Content Survives a Reset Without Power Loss (Brownout, Watchdog, Fault).
+ */
+#define RECORD_RETAINED 			__attribute__((section(".noinit")))
+#else
+#define RECORD_RETAINED
+#endif /* (true == RETENTION_ENABLED) */
+
+/**
+ * @brief 	Magic Number ("RETN") of The Retention Header.
+ */
+#define RECORD_RETAIN_MAGIC 		0x4E544552UL
+
+#if (true == BINARY_MODE_ENABLED)
+/**
+ * @brief 	LPUART Receiver Error Flags Reported In The Block Header.
+ */
+#define RECORD_RX_ERROR_FLAGS 		((uint32_t)kLPUART_RxOverrunFlag | (uint32_t)kLPUART_NoiseErrorFlag | \
+									 (uint32_t)kLPUART_FramingErrorFlag | (uint32_t)kLPUART_ParityErrorFlag)
+#endif /* (true == BINARY_MODE_ENABLED) */
 
+#if (true == CONFIG_RELOAD_ENABLED)
 /**
- * @brief 	Block Size For Write To SDHC Card Operation (In Bytes).
+ * @brief 	Size of The Marker Line Written Into The Log When a Changed Configuration Is Applied.
+ * @details Shorter Than The Smallest Block, So The Marker Needs At Most One Swap.
  */
-#define BLOCK_SIZE 					512U
+#define RECORD_MARKER_SIZE 			160U
+#endif /* (true == CONFIG_RELOAD_ENABLED) */
 
 /**
  * @brief Convert Time In Seconds To Number of Ticks.
@@ -44,6 +100,38 @@
 #define GET_WAIT_INTERVAL(seconds)  ((seconds) * 1000 / configTICK_RATE_HZ)
 
 #define GET_CURRENT_TIME_MS()  (xTaskGetTickCount() * portTICK_PERIOD_MS)
+
+/**
+ * @brief 	Header of The Recorder State In Retention RAM.
+ * @details The CRC Covers The Header Only, It Changes Once Per Log File. The FIFO And Buffer Indexes Change With
+ * 			Every Byte, They Are Checked For Range At Boot Instead. The Sizes Select The Layout of The Arena.
+ */
+typedef struct
+{
+	uint32_t u32Magic;								/*<! RECORD_RETAIN_MAGIC					*/
+	uint32_t u32FifoSize;							/*<! Size of The FIFO						*/
+	uint32_t u32BlockSize;							/*<! Size of One Block						*/
+	uint32_t u32Mode;								/*<! Format of The Blocks (REC_mode_t)		*/
+	char acPath[DUMP_PATH_SIZE];					/*<! Current Log File, Empty If None		*/
+	uint32_t u32Crc;								/*<! CRC-32 of The Fields Above				*/
+} record_retention_t;
+
+_Static_assert(sizeof(record_retention_t) <= MEM_RETAINED_SIZE, "Retention header does not fit the retained region");
+
+/**
+ * @brief 	Identity of The Applied Configuration File.
+ * @details The Directory Entry (Size, Modification Time) Is Compared First, The CRC Only When It Differs: Some Hosts
+ * 			Rewrite The File Unchanged, Others Keep Its Time Stamp.
+ */
+typedef struct
+{
+	bool bValid;									/*<! A File Was Read						*/
+	uint32_t u32Size;								/*<! Size of The File						*/
+	uint16_t u16Date;								/*<! Modification Date (FAT Format)			*/
+	uint16_t u16Time;								/*<! Modification Time (FAT Format)			*/
+	uint32_t u32Crc;								/*<! CRC-32 of The Content					*/
+} record_config_stamp_t;
+
 /*******************************************************************************
  * Prototypes
  ******************************************************************************/
@@ -75,47 +163,103 @@ static FIL g_fileObject;
  */
 static char g_u8CurrentDirectory[32];
 
+/**
+ * @brief	Retention Header With The Path of The Current Log File, Drawn From The Retained Region (mem.c).
+ * @details Data Left In The Retained FIFO And Buffers By a Reset Are Appended To This File On The Next Boot,
+ * 			The Power Loss Dump Is Appended To It As Well.
+ */
+static record_retention_t *g_pxRetention = NULL;
+
+/**
+ * @brief 	Identity of The Configuration File Read Last, Checked When USB Detaches.
+ */
+static record_config_stamp_t g_xConfigStamp;
+
+/**
+ * @brief 	Retention RAM Was Checked Since Reset (Kept In .bss, So Cleared By ResetISR).
+ */
+static bool g_bRetentionChecked = false;
+
 
 /**
- * @brief 	Buffer For Multi-Buffering - In Particular Dual-Buffering,
- * 			One Is Always Filled, The Other Is Processed.
- * @details Must Be Aligned on Multiple of 512B, Since SDHC/SDXC Card Uses 512-Byte Fixed
- * 			Block Length. The Address of The R/W Buffer Should Be Also Align To The Specific DMA
- * 			Data Buffer Address Align Value. At The Same Time Buffer Address/Size Should Be Aligned To The Cache
- * 			Line Size.
+ * @brief 	Arena From Which The Recording Blocks And The FIFO Are Carved At Boot, Sizes Come From The Configuration.
+ * @details Drawn From The DMA Region (mem.c), Which Is Not Cleared At Reset. Blocks Lie First: The Arena Is Aligned
+ * 			For SD DMA And Block Sizes Are Multiples of 512 B, So Each Block Keeps The Alignment Needed By SDHC/SDXC
+ * 			Cards (512-Byte Fixed Block Length) And The DMA. In Mass Storage Mode The MSC Buffers May Reuse It.
  */
-SDK_ALIGN(static uint8_t g_au8DmaBuffer1[BLOCK_SIZE], BOARD_SDMMC_DATA_BUFFER_ALIGN_SIZE);
+static uint8_t *g_pu8RecordArena = NULL;
 
 /**
- * @brief 	Buffer For Multi-Buffering - In Particular Dual-Buffering,
- * 			One Is Always Filled, The Other Is Processed.
- * @details Must Be Aligned on Multiple of 512B, Since SDHC/SDXC Card Uses 512-Byte Fixed
- * 			Block Length. The Address of The R/W Buffer Should Be Also Align To The Specific DMA
- * 			Data Buffer Address Align Value. At The Same Time Buffer Address/Size Should Be Aligned To The Cache
- * 			Line Size.
+ * @brief 	Work Buffer of f_mkfs, Drawn From The SRAM Region (It Was On The Stack of record_task).
  */
-SDK_ALIGN(static uint8_t g_au8DmaBuffer2[BLOCK_SIZE], BOARD_SDMMC_DATA_BUFFER_ALIGN_SIZE);
+static BYTE *g_pu8MkfsWork = NULL;
+
+/**
+ * @brief 	Blocks For Multi-Buffering, One Is Always Filled, The Other Is Processed.
+ * @details Full Blocks Are Also Streamed To The USB CDC Host Straight From Memory. A Block Queued For The Host Is Not
+ * 			Refilled Until Sent, One Of The Spare Blocks Is Collected Meanwhile.
+ */
+static uint8_t *g_apu8Blocks[RECORD_BLOCK_COUNT];
+
+/**
+ * @brief 	Size of One Block (Key 'block_size'), Written To The Card In One f_write.
+ */
+static uint32_t g_u32BlockSize 			= 0UL;
 
 /**
  * @brief 	Back Buffer Which Serves For Data Collection From Circular Buffer
  * 			And Is Used For Data-Processing (Time Stamps Are Inserted To This Buffer).
+ * @details Retained Like The Rest of The Recorder State, Set Up By The First CONSOLELOG_Init After Reset.
  */
-static uint8_t* g_pu8BackDmaBuffer 		= g_au8DmaBuffer1;
+static uint8_t* g_pu8BackDmaBuffer RECORD_RETAINED;
 
 /**
  * @brief 	Front Buffer Which Serves For Storing Data Into SD Card.
  */
-static uint8_t* g_pu8FrontDmaBuffer 	= NULL;
+static uint8_t* g_pu8FrontDmaBuffer RECORD_RETAINED;
 
 /**
  * @brief 	Pointer on Current Back DMA Buffer Into Which The Time Stamps Are Inserted.
  */
-static uint16_t g_u16BackDmaBufferIdx	= 0;
+static uint16_t g_u16BackDmaBufferIdx RECORD_RETAINED;
 
 /**
  * @brief 	Indicates That Collection Buffer (Back Buffer) Is Full and Ready To Swap.
  */
-static bool g_bBackDmaBufferReady		= false;
+static bool g_bBackDmaBufferReady RECORD_RETAINED;
+
+/**
+ * @brief 	Arrival Tick of The Oldest Byte In The Back And Front Buffer, See g_pu16ArrivalTick.
+ */
+static uint16_t g_u16BackOldestTick 	= 0U;
+static uint16_t g_u16FrontOldestTick 	= 0U;
+
+/**
+ * @brief 	Back Buffer Already Holds a Received Byte, So g_u16BackOldestTick Is Valid.
+ */
+static bool g_bBackTagged 				= false;
+
+/**
+ * @brief 	Format of The Blocks, Applied By CONSOLELOG_Configure With Empty Buffers Only.
+ */
+static REC_mode_t g_eRecordMode 		= RECORD_MODE_TEXT;
+
+#if (true == BINARY_MODE_ENABLED)
+/**
+ * @brief 	Stream Offset of The Next Byte Stored In Binary Mode, Counted From The Session Start.
+ */
+static uint64_t g_u64BinOffset 			= 0ULL;
+
+/**
+ * @brief 	RECORD_BIN_FLAG_x Collected By LPUART ISR, Not Yet Taken Into a Block Header.
+ */
+static volatile uint16_t g_u16RxErrors 	= 0U;
+
+/**
+ * @brief 	FIFO Index of The First Byte Received After The Oldest Error In g_u16RxErrors.
+ */
+static volatile uint32_t g_u32RxErrorIndex = 0UL;
+#endif /* (true == BINARY_MODE_ENABLED) */
 
 /**
  * @brief 	Value of Ticks When Last Character Was Received Thru LPUART.
@@ -134,7 +278,7 @@ static uint16_t g_u32FileCounter 		= 1;
 
 /**
  * @brief 	Flush Completed Flag.
- * @details If No Data of The LPUART Periphery Are Received Within The `FLUSH_TIMEOUT_TICKS`
+ * @details If No Data of The LPUART Periphery Are Received Within The `flush_timeout_ms`
  * 			Interval, The Data Collected So Far In The Buffer Are Flushed To The File.
  */
 static bool g_bFlushCompleted 			= false;
@@ -144,6 +288,16 @@ static bool g_bFlushCompleted 			= false;
  */
 static uint32_t g_u32BytesTransfered	= 0U;
 
+/**
+ * @brief	Full Blocks Overwritten By a Swap Before They Were Written, Must Stay 0 (See CONSOLELOG_SwapBuffers).
+ */
+static uint32_t g_u32DroppedBlocks		= 0UL;
+
+/**
+ * @brief	Received Bytes Dropped By The LPUART ISR Because The FIFO Was Full (Both Modes).
+ */
+static volatile uint32_t g_u32FifoFullBytes = 0UL;
+
 /** @} */ // End of Recording Buffers and Recording Management
 
 /**
@@ -155,22 +309,108 @@ static uint32_t g_u32BytesTransfered	= 0U;
 
 /**
  * @brief 	Circular Buffer For Reception of Data From UART Interrupt Service Routine.
- * @details Filled in LP_FLEXCOMM3_IRQHandler Interrupt Service Routine.
+ * @details Filled in LP_FLEXCOMM3_IRQHandler Interrupt Service Routine, Carved From g_pu8RecordArena.
+ */
+static volatile uint8_t *g_pu8CircBuffer 	= NULL;
+
+/**
+ * @brief 	Arrival Time of Each Byte In FIFO (Low 16 Bits of Tick Count, Wraps After 327 s).
+ * @details The Block Is Tagged With The Arrival of Its Oldest Byte For The End-To-End Latency (latency.c).
+ */
+static uint16_t *g_pu16ArrivalTick 			= NULL;
+
+/**
+ * @brief 	Size of The FIFO (Key 'fifo_size').
+ */
+static uint32_t g_u32FifoSize 				= 0UL;
+
+/**
+ * @brief 	Amount of Data In FIFO (In Bytes) At Which LPUART ISR Wakes Up record_task Even Without Line End.
  */
-SDK_ALIGN(static volatile uint8_t g_au8CircBuffer[CIRCULAR_BUFFER_SIZE], BOARD_SDMMC_DATA_BUFFER_ALIGN_SIZE);
+static uint32_t g_u32NotifyThreshold 		= 0UL;
 
 /**
  * @brief	Index For Writing Into FIFO.
  */
-static volatile uint32_t g_u32WriteIndex = 0;
+static volatile uint32_t g_u32WriteIndex RECORD_RETAINED;
 
 /**
  * @brief 	Index For Reading From FIFO.
  */
-static volatile uint32_t g_u32ReadIndex = 0;
+static volatile uint32_t g_u32ReadIndex RECORD_RETAINED;
+
+/**
+ * @brief 	Handle of record_task, Notified From LPUART ISR And Flush Timer.
+ */
+extern TaskHandle_t g_xRecordTaskHandle;
 
 /** @} */ // End of UART Management Group
 
+/**
+ * @defgroup 	Flush Deadline
+ * @brief 		Group Contains The Timer Which Wakes Up record_task When No Data Arrived For flush_timeout_ms.
+ * @{
+ */
+
+/**
+ * @brief 	Idle Time After Which The Collected Data Are Flushed (Key 'flush_timeout_ms').
+ */
+static TickType_t g_xFlushTimeoutTicks = pdMS_TO_TICKS(DEFAULT_FLUSH_TIMEOUT_MS);
+
+/**
+ * @brief 	One-Shot Flush Timer, Armed By record_task On Received Data.
+ */
+static TimerHandle_t g_xFlushTimer = NULL;
+
+/**
+ * @brief 	Memory of The Static Flush Timer.
+ */
+static StaticTimer_t g_xFlushTimerBuffer;
+
+/**
+ * @brief 	Flush Timer Is Armed, Till Then LPUART ISR In Binary Mode Wakes record_task On Every Byte (No Line Ends).
+ */
+static volatile bool g_bFlushArmed = false;
+
+/**
+ * @brief 	Guards The Record Buffers And The Record File Between record_task And The Power Loss Flush.
+ * @details Mutex With Priority Inheritance, When The Emergency Task Waits For It The Holder Runs At The
+ * 			Emergency Priority Till It Finishes Its Pass (Including The In-Flight f_write).
+ */
+static SemaphoreHandle_t g_xRecordMutex = NULL;
+
+/**
+ * @brief 	Memory of The Static Record Mutex.
+ */
+static StaticSemaphore_t g_xRecordMutexBuffer;
+
+/** @} */ // End of Flush Deadline Group
+
+#if (true == SWITCH_LATENCY_ENABLED)
+/**
+ * @defgroup 	Mode-Switch Latency Measurement
+ * @brief 		Group Contains Variables For Measurement of Time From USB Detach To First Recorded Byte.
+ * @{
+ */
+
+/**
+ * @brief	DWT Cycle Counter Value At USB Detach.
+ */
+static volatile uint32_t g_u32SwitchStartCycles 	= 0UL;
+
+/**
+ * @brief	Measured Latency In DWT Cycles, Zero If Not Yet Measured or Already Reported.
+ */
+static volatile uint32_t g_u32SwitchLatencyCycles 	= 0UL;
+
+/**
+ * @brief	Indicates That The First Byte After Mode Switch Is Awaited In LPUART ISR.
+ */
+static volatile bool g_bSwitchMeasuring 			= false;
+
+/** @} */ // End of Mode-Switch Latency Measurement Group
+#endif /* (true == SWITCH_LATENCY_ENABLED) */
+
 
 /*******************************************************************************
  * Interrupt Service Routines (ISRs)
@@ -190,28 +430,95 @@ void LP_FLEXCOMM3_IRQHandler(void)
     uint8_t u8Data;
     uint32_t u32Stat;
     uint32_t u32NextWriteIndex;
+    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+#if (true == DIAG_ENABLED)
+    uint32_t u32DiagStart = DIAG_IsrEnter();
+#endif /* (true == DIAG_ENABLED) */
+
+    TRACE_BEGIN(TRACE_ID_UART_ISR);
 
     /* Check For New Data */
     u32Stat = LPUART_GetStatusFlags(LPUART3);
+#if (true == BINARY_MODE_ENABLED)
+    /* Receiver Errors Go Into The Block Header, Cleared Here (A Pending Overrun Stops The Receiver) */
+    if (0U != (RECORD_RX_ERROR_FLAGS & u32Stat))
+    {
+    	if (0U == g_u16RxErrors)
+    	{
+    		g_u32RxErrorIndex = g_u32WriteIndex;
+    	}
+    	g_u16RxErrors |= (uint16_t)(((0U != ((uint32_t)kLPUART_RxOverrunFlag & u32Stat)) ? RECORD_BIN_FLAG_OVERRUN : 0U) |
+    								((0U != ((uint32_t)kLPUART_NoiseErrorFlag & u32Stat)) ? RECORD_BIN_FLAG_NOISE : 0U) |
+    								((0U != ((uint32_t)kLPUART_FramingErrorFlag & u32Stat)) ? RECORD_BIN_FLAG_FRAMING : 0U) |
+    								((0U != ((uint32_t)kLPUART_ParityErrorFlag & u32Stat)) ? RECORD_BIN_FLAG_PARITY : 0U));
+    	(void)LPUART_ClearStatusFlags(LPUART3, RECORD_RX_ERROR_FLAGS & u32Stat);
+    }
+#endif /* (true == BINARY_MODE_ENABLED) */
     if (0U != ((uint32_t)kLPUART_RxDataRegFullFlag & u32Stat))
     {
     	u8Data = LPUART_ReadByte(LPUART3);
         /* Add Data To FIFO */
-    	u32NextWriteIndex = ((g_u32WriteIndex + 1UL) % CIRCULAR_BUFFER_SIZE);
+    	/* Compare Instead of Modulo, The Size Is Not a Constant */
+    	u32NextWriteIndex = g_u32WriteIndex + 1UL;
+    	if (u32NextWriteIndex >= g_u32FifoSize)
+    	{
+    		u32NextWriteIndex = 0UL;
+    	}
         if (u32NextWriteIndex != g_u32ReadIndex) // Check if FIFO is not full
         {
-        	g_au8CircBuffer[g_u32WriteIndex] = u8Data;
-            g_u32WriteIndex = u32NextWriteIndex;
+        	g_pu8CircBuffer[g_u32WriteIndex] = u8Data;
 
             /* Update Time Of Last Receiving */
-            g_lastDataTick = xTaskGetTickCount();
+            g_lastDataTick = xTaskGetTickCountFromISR();
+            g_pu16ArrivalTick[g_u32WriteIndex] = (uint16_t)g_lastDataTick;
+            g_u32WriteIndex = u32NextWriteIndex;
             g_bFlushCompleted = false;
+
+            /* Wake Up record_task On Line End (Binary Mode: Till It Arms The Flush Timer) or When FIFO Fill Reaches
+             * The Threshold, Not On Every Byte */
+            if (((RECORD_MODE_BINARY == g_eRecordMode) ? !g_bFlushArmed : ((uint8_t)'\n' == u8Data)) ||
+            	(g_u32NotifyThreshold == ((g_u32WriteIndex + g_u32FifoSize - g_u32ReadIndex) % g_u32FifoSize)))
+            {
+            	(void)xTaskNotifyFromISR(g_xRecordTaskHandle, RECORD_EVENT_DATA, eSetBits, &xHigherPriorityTaskWoken);
+            }
+
+#if (true == SWITCH_LATENCY_ENABLED)
+            if (g_bSwitchMeasuring)
+            {
+            	g_u32SwitchLatencyCycles = DWT->CYCCNT - g_u32SwitchStartCycles;
+            	g_bSwitchMeasuring = false;
+            }
+#endif /* (true == SWITCH_LATENCY_ENABLED) */
+        }
+        else
+        {
+        	g_u32FifoFullBytes++;
+#if (true == BINARY_MODE_ENABLED)
+        	if (0U == g_u16RxErrors)
+        	{
+        		g_u32RxErrorIndex = g_u32WriteIndex;
+        	}
+        	g_u16RxErrors |= (uint16_t)RECORD_BIN_FLAG_DROPPED;
+#endif /* (true == BINARY_MODE_ENABLED) */
         }
         g_u32BytesTransfered++;
     }
 
     /* Clear Interrupt Flag */
     (void)LPUART_ClearStatusFlags(LPUART3, (uint32_t)kLPUART_RxDataRegFullFlag);
+
+#if (true == DIAG_ENABLED)
+    DIAG_IsrExit(u32DiagStart);
+#endif /* (true == DIAG_ENABLED) */
+    TRACE_END(TRACE_ID_UART_ISR);
+
+    /*
+     * MISRA Deviation: Rule 10.3, Rule 14.4, Rule 11.4
+     * Justification: `portYIELD_FROM_ISR()` Expects `BaseType_t` as Per FreeRTOS Convention.
+     */
+    /*lint -e9036 -e9048 -e9078 */
+    portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+    /*lint +e9036 +e9048 +e9078 */
     SDK_ISR_EXIT_BARRIER;
 }
 /*lint +e957 */
@@ -219,6 +526,438 @@ void LP_FLEXCOMM3_IRQHandler(void)
 /*******************************************************************************
  * Code
  ******************************************************************************/
+/**
+ * @brief 	Selects The Block To Be Collected After The Front Buffer.
+ *
+ * @param 	pu8Front Block Just Handed Over For Storing.
+ * @return 	Block That Is Neither Stored Nor Streamed To The USB CDC Host.
+ */
+static uint8_t* CONSOLELOG_NextBackBuffer(const uint8_t* pu8Front)
+{
+#if (USB_DEVICE_CONFIG_CDC_ACM > 0U)
+	uint32_t i;
+
+	/* At Most Queue Length Blocks Are Streamed, So One Of Them Is Always Free */
+	for (i = 0U; i < RECORD_BLOCK_COUNT; i++)
+	{
+		if ((pu8Front != g_apu8Blocks[i]) && !USB_DeviceCdcAcmIsQueued(g_apu8Blocks[i]))
+		{
+			return g_apu8Blocks[i];
+		}
+	}
+#endif /* (USB_DEVICE_CONFIG_CDC_ACM > 0U) */
+	return (pu8Front == g_apu8Blocks[0]) ? g_apu8Blocks[1] : g_apu8Blocks[0];
+}
+
+/**
+ * @brief 	Hands The Collected Back Buffer Over For Storing And Starts Collection Into The Next One.
+ *
+ * @param 	u16ValidBytes Number of Recorded Bytes In The Back Buffer (Without Flush Padding).
+ */
+static void CONSOLELOG_SwapBuffers(uint16_t u16ValidBytes)
+{
+	/* The Front Block Is Still Pending, Callers Stop Collecting Before That, So This Only Counts Their Bugs */
+	if (g_bBackDmaBufferReady)
+	{
+		g_u32DroppedBlocks++;
+	}
+
+	g_pu8FrontDmaBuffer 	= g_pu8BackDmaBuffer;
+	g_bBackDmaBufferReady 	= true;
+	g_u16FrontOldestTick 	= g_u16BackOldestTick;
+	g_bBackTagged 			= false;
+
+#if (USB_DEVICE_CONFIG_CDC_ACM > 0U)
+	/* Live View For The USB CDC Host, Sent Without Copy, Dropped If The Host Does Not Keep Up */
+	(void)USB_DeviceCdcAcmStream(g_pu8FrontDmaBuffer, u16ValidBytes);
+#else
+	(void)u16ValidBytes;
+#endif /* (USB_DEVICE_CONFIG_CDC_ACM > 0U) */
+
+	g_pu8BackDmaBuffer 		= CONSOLELOG_NextBackBuffer(g_pu8FrontDmaBuffer);
+	g_u16BackDmaBufferIdx 	= 0;
+}
+
+#if (true == BINARY_MODE_ENABLED)
+/**
+ * @brief 	Converts IRTC Date And Time To Seconds Since 1970-01-01 (Years 1970 - 2099).
+ *
+ * @param 	pxTime Date And Time Read From IRTC.
+ *
+ * @return 	Unix Time In Seconds.
+ */
+static uint32_t CONSOLELOG_UnixSeconds(const irtc_datetime_t *pxTime)
+{
+	static const uint16_t au16DaysBefore[12U] = {0U, 31U, 59U, 90U, 120U, 151U, 181U, 212U, 243U, 273U, 304U, 334U};
+	uint32_t u32Year 	= (uint32_t)pxTime->year;
+	uint32_t u32Month 	= ((pxTime->month >= 1U) && (pxTime->month <= 12U)) ? (uint32_t)pxTime->month : 1UL;
+	uint32_t u32Days;
+
+	/* Every Fourth Year Is a Leap Year Within The Range, Its Leap Day Counts From March */
+	u32Days = (365UL * (u32Year - 1970UL)) + ((u32Year - 1969UL) / 4UL) + au16DaysBefore[u32Month - 1UL] +
+			  (uint32_t)pxTime->day - 1UL;
+	if ((0UL == (u32Year % 4UL)) && (u32Month > 2UL))
+	{
+		u32Days++;
+	}
+	return (u32Days * 86400UL) + ((uint32_t)pxTime->hour * 3600UL) + ((uint32_t)pxTime->minute * 60UL) +
+		   (uint32_t)pxTime->second;
+}
+
+/**
+ * @brief 	Opens a Block In Binary Mode, Its Header Takes The Start of The Back Buffer.
+ *
+ * @param 	u16Tick Arrival Tick of The First Byte (Lower 16 Bits, See g_pu16ArrivalTick).
+ */
+static void CONSOLELOG_OpenBinaryBlock(uint16_t u16Tick)
+{
+	record_bin_header_t xHeader;
+	irtc_datetime_t datetimeGet;
+	TickType_t xNow = xTaskGetTickCount();
+
+	IRTC_GetDatetime(RTC, &datetimeGet);
+
+	xHeader.u32Magic 		= RECORD_BIN_MAGIC;
+	xHeader.u16Length 		= 0U;
+	xHeader.u16Flags 		= 0U;
+	xHeader.u64Offset 		= g_u64BinOffset;
+	/* Full Tick From Its Lower 16 Bits, The Byte Arrived Less Than 2^16 Ticks Ago */
+	xHeader.u32TickMs 		= (uint32_t)((xNow - (TickType_t)(uint16_t)((uint16_t)xNow - u16Tick)) *
+										 portTICK_PERIOD_MS);
+	xHeader.u32RtcSeconds 	= CONSOLELOG_UnixSeconds(&datetimeGet);
+
+	/* The Blocks Are Not 8-Byte Aligned For The 64-Bit Field */
+	(void)memcpy(g_pu8BackDmaBuffer, &xHeader, sizeof(xHeader));
+	g_u16BackDmaBufferIdx 	= (uint16_t)sizeof(xHeader);
+	g_u16BackOldestTick 	= u16Tick;
+	g_bBackTagged 			= true;
+}
+
+/**
+ * @brief 	Writes The Payload Length Into The Header of The Back Buffer.
+ * @details Called Before The Back Buffer Is Handed Over (Full, Padded By a Flush, Dumped or Recovered).
+ * 			Does Nothing In Text Mode or With No Block Open.
+ */
+static void CONSOLELOG_SealBinaryBlock(void)
+{
+	uint16_t u16Length;
+
+	if ((RECORD_MODE_BINARY != g_eRecordMode) || (g_u16BackDmaBufferIdx < (uint16_t)sizeof(record_bin_header_t)))
+	{
+		return;
+	}
+
+	u16Length = g_u16BackDmaBufferIdx - (uint16_t)sizeof(record_bin_header_t);
+	(void)memcpy(&g_pu8BackDmaBuffer[offsetof(record_bin_header_t, u16Length)], &u16Length, sizeof(u16Length));
+}
+
+/**
+ * @brief 	Copies Received Bytes Verbatim From The FIFO Into The Back Buffer.
+ * @details Contiguous Runs of The FIFO Are Copied At Once. Stops After One Full Block, So The Block Is Written
+ * 			Before The Next One Is Collected.
+ *
+ * @param 	u32LocalWriteIndex Write Index of The FIFO Taken At The Start of The Pass.
+ *
+ * @return 	Read Index Where The Collection Stopped.
+ */
+static uint32_t CONSOLELOG_CollectBinary(uint32_t u32LocalWriteIndex)
+{
+	uint32_t u32Run;
+	uint32_t u32Room;
+	uint16_t u16Flags;
+
+	while ((g_u32ReadIndex != u32LocalWriteIndex) && !g_bBackDmaBufferReady)
+	{
+		if (0U == g_u16BackDmaBufferIdx)
+		{
+			CONSOLELOG_OpenBinaryBlock(g_pu16ArrivalTick[g_u32ReadIndex]);
+		}
+
+		u32Run 	= (u32LocalWriteIndex > g_u32ReadIndex) ? (u32LocalWriteIndex - g_u32ReadIndex) :
+														  (g_u32FifoSize - g_u32ReadIndex);
+		u32Room = g_u32BlockSize - (uint32_t)g_u16BackDmaBufferIdx;
+		if (u32Run > u32Room)
+		{
+			u32Run = u32Room;
+		}
+
+		/* Receiver Errors Go Into The Block Holding The First Byte Received After Them, The Run Does Not Wrap */
+		if ((0U != g_u16RxErrors) && ((g_u32RxErrorIndex - g_u32ReadIndex) < u32Run))
+		{
+			(void)memcpy(&u16Flags, &g_pu8BackDmaBuffer[offsetof(record_bin_header_t, u16Flags)], sizeof(u16Flags));
+			/*lint -e40 */
+			u16Flags |= __atomic_exchange_n(&g_u16RxErrors, 0U, __ATOMIC_RELAXED);
+			/*lint +e40 */
+			(void)memcpy(&g_pu8BackDmaBuffer[offsetof(record_bin_header_t, u16Flags)], &u16Flags, sizeof(u16Flags));
+		}
+
+		(void)memcpy(&g_pu8BackDmaBuffer[g_u16BackDmaBufferIdx],
+					 (const uint8_t *)(uintptr_t)&g_pu8CircBuffer[g_u32ReadIndex], u32Run);
+		g_u16BackDmaBufferIdx 	+= (uint16_t)u32Run;
+		g_u64BinOffset 			+= u32Run;
+		g_u32ReadIndex 			= ((g_u32ReadIndex + u32Run) < g_u32FifoSize) ? (g_u32ReadIndex + u32Run) : 0UL;
+
+		if (g_u32BlockSize == g_u16BackDmaBufferIdx)
+		{
+			CONSOLELOG_SealBinaryBlock();
+			CONSOLELOG_SwapBuffers(g_u16BackDmaBufferIdx);
+			break;
+		}
+	}
+	return g_u32ReadIndex;
+}
+#endif /* (true == BINARY_MODE_ENABLED) */
+
+/**
+ * @brief 	Computes How Much of The Arena a Layout Needs.
+ *
+ * @param 	u32FifoSize Size of The FIFO.
+ * @param 	u32BlockSize Size of One Block.
+ *
+ * @return 	Needed Bytes, UINT32_MAX If The Sizes Are Not Valid.
+ */
+static uint32_t CONSOLELOG_ArenaNeed(uint32_t u32FifoSize, uint32_t u32BlockSize)
+{
+	/* Each Size Alone Must Fit, So The Sum Below Does Not Overflow */
+	if ((0UL == u32FifoSize) || (0UL == u32BlockSize) || (u32FifoSize > RECORD_ARENA_SIZE) ||
+		(u32BlockSize > RECORD_MAX_BLOCK_SIZE) || (0UL != (u32FifoSize % RECORD_SECTOR_SIZE)) ||
+		(0UL != (u32BlockSize % RECORD_SECTOR_SIZE)))
+	{
+		return UINT32_MAX;
+	}
+	return (RECORD_BLOCK_COUNT * u32BlockSize) + (u32FifoSize * RECORD_FIFO_BYTE_COST);
+}
+
+/**
+ * @brief 	Carves The Blocks, The FIFO And The Arrival Ticks From The Arena.
+ * @details Must Not Be Called While The UART Is Enabled.
+ *
+ * @param 	u32FifoSize Size of The FIFO, Multiple of RECORD_SECTOR_SIZE.
+ * @param 	u32BlockSize Size of One Block, Multiple of RECORD_SECTOR_SIZE.
+ *
+ * @return 	True If The Layout Fits Into The Arena, Otherwise The Current Layout Is Kept.
+ */
+static bool CONSOLELOG_CarveArena(uint32_t u32FifoSize, uint32_t u32BlockSize)
+{
+	uint32_t u32Offset = 0UL;
+
+	if (CONSOLELOG_ArenaNeed(u32FifoSize, u32BlockSize) > RECORD_ARENA_SIZE)
+	{
+		return false;
+	}
+
+	for (uint32_t i = 0U; i < RECORD_BLOCK_COUNT; i++)
+	{
+		g_apu8Blocks[i] = &g_pu8RecordArena[u32Offset];
+		u32Offset += u32BlockSize;
+	}
+	g_pu8CircBuffer 	= &g_pu8RecordArena[u32Offset];
+	u32Offset += u32FifoSize;
+	g_pu16ArrivalTick 	= (uint16_t *)(void *)&g_pu8RecordArena[u32Offset];
+
+	g_u32FifoSize 			= u32FifoSize;
+	g_u32BlockSize 			= u32BlockSize;
+	g_u32NotifyThreshold 	= u32FifoSize / 4U;
+	return true;
+}
+
+/**
+ * @brief 	Checks Whether The FIFO And All Blocks Are Empty.
+ *
+ * @return 	True If No Recorded Data Are Held In RAM.
+ */
+static bool CONSOLELOG_IsEmpty(void)
+{
+	return (!g_bBackDmaBufferReady) && (0U == g_u16BackDmaBufferIdx) && (g_u32ReadIndex == g_u32WriteIndex);
+}
+
+/**
+ * @brief 	Computes The CRC of The Retention Header And Marks It Valid.
+ */
+static void CONSOLELOG_SealRetention(void)
+{
+	g_pxRetention->u32Magic 		= RECORD_RETAIN_MAGIC;
+	g_pxRetention->u32FifoSize 	= g_u32FifoSize;
+	g_pxRetention->u32BlockSize 	= g_u32BlockSize;
+	g_pxRetention->u32Mode 		= (uint32_t)g_eRecordMode;
+	g_pxRetention->u32Crc 	= DUMP_Crc32(0UL, (const uint8_t *)g_pxRetention, offsetof(record_retention_t, u32Crc));
+}
+
+/**
+ * @brief 	Starts With Empty FIFO And Buffers, Without Log File In The Retention Header.
+ */
+static void CONSOLELOG_ResetRetention(void)
+{
+	g_pu8BackDmaBuffer 		= g_apu8Blocks[0];
+	g_pu8FrontDmaBuffer 	= NULL;
+	g_u16BackDmaBufferIdx 	= 0U;
+	g_bBackDmaBufferReady 	= false;
+	g_u32ReadIndex 			= 0UL;
+	g_u32WriteIndex 		= 0UL;
+	(void)memset(g_pxRetention, 0, sizeof(*g_pxRetention));
+	CONSOLELOG_SealRetention();
+}
+
+#if (true == RETENTION_ENABLED)
+/**
+ * @brief 	Checks Whether The Pointer Is One of The Recording Blocks.
+ *
+ * @param 	pu8Buffer Pointer Found In Retention RAM.
+ *
+ * @return 	True If It Points To The Start of a Block.
+ */
+static bool CONSOLELOG_IsRecordBuffer(const uint8_t *pu8Buffer)
+{
+	bool bFound = false;
+
+	for (uint32_t i = 0U; i < RECORD_BLOCK_COUNT; i++)
+	{
+		bFound = bFound || (pu8Buffer == g_apu8Blocks[i]);
+	}
+	return bFound;
+}
+
+/**
+ * @brief 	Checks The Retention Header And The Range of The Retained Recorder State.
+ * @details After Power-On The RAM Holds Random Content, The Magic And CRC Fail Then. A Valid Header Carves The Arena
+ * 			With The Sizes of The Last Session, So The Retained Pointers And Indexes Refer To The Same Layout.
+ *
+ * @return 	True If The Retained State Was Left By This Firmware.
+ */
+static bool CONSOLELOG_IsRetentionValid(void)
+{
+	if ((RECORD_RETAIN_MAGIC != g_pxRetention->u32Magic) ||
+		(g_pxRetention->u32Crc != DUMP_Crc32(0UL, (const uint8_t *)g_pxRetention,
+										   offsetof(record_retention_t, u32Crc))) ||
+		!CONSOLELOG_CarveArena(g_pxRetention->u32FifoSize, g_pxRetention->u32BlockSize) ||
+		(g_pxRetention->u32Mode > (uint32_t)RECORD_MODE_BINARY))
+	{
+		return false;
+	}
+	/* The Back Buffer Is Sealed In The Format It Was Collected In */
+	g_eRecordMode = (REC_mode_t)g_pxRetention->u32Mode;
+
+	return ('\0' == g_pxRetention->acPath[sizeof(g_pxRetention->acPath) - 1U]) &&
+		   (g_u32ReadIndex < g_u32FifoSize) && (g_u32WriteIndex < g_u32FifoSize) &&
+		   (g_u16BackDmaBufferIdx <= g_u32BlockSize) && CONSOLELOG_IsRecordBuffer(g_pu8BackDmaBuffer) &&
+		   (!g_bBackDmaBufferReady || CONSOLELOG_IsRecordBuffer(g_pu8FrontDmaBuffer));
+}
+#endif /* (true == RETENTION_ENABLED) */
+
+/**
+ * @brief 	Appends Data Left In Retention RAM By The Reset To The Log File They Belong To.
+ * @details Called By The First CONSOLELOG_Init After Reset, Before The UART Is Enabled. Pieces Go In Order of
+ * 			Arrival: Full Block Not Yet Written, Back Buffer, Unprocessed FIFO. Data of a Session Without Log File
+ * 			Go Into DUMP_RECOVERED_FILE. If They Cannot Be Written, They Stay And Go Into The New Session.
+ *
+ * @return 	ERROR_NONE If There Were No Data Or They Were Appended.
+ */
+static error_t CONSOLELOG_RecoverRetained(void)
+{
+#if (true == RETENTION_ENABLED)
+	const char *pcTarget;
+	UINT bytesWritten;
+	uint32_t u32Read;
+	uint32_t u32Write;
+	FRESULT status = FR_OK;
+
+	if (!CONSOLELOG_IsRetentionValid())
+	{
+		CONSOLELOG_ResetRetention();
+		return ERROR_NONE;
+	}
+
+	if (CONSOLELOG_IsEmpty())
+	{
+		CONSOLELOG_ResetRetention();
+		return ERROR_NONE;
+	}
+	u32Read  = g_u32ReadIndex;
+	u32Write = g_u32WriteIndex;
+
+	/* No File Is Open Yet, The Log File Was Repaired By DUMP_RepairIntent If The Reset Left It Open */
+	pcTarget = ('\0' != g_pxRetention->acPath[0]) ? g_pxRetention->acPath : DUMP_RECOVERED_FILE;
+	if (FR_OK != f_open(&g_fileObject, pcTarget, (FA_WRITE | FA_OPEN_APPEND)))
+	{
+		PRINTF("ERR: Failed to Open %s For Retained Data.\r\n", pcTarget);
+		return ERROR_OPEN;
+	}
+
+	if (g_bBackDmaBufferReady)
+	{
+		status = f_write(&g_fileObject, g_pu8FrontDmaBuffer, g_u32BlockSize, &bytesWritten);
+	}
+	if ((FR_OK == status) && (g_u16BackDmaBufferIdx > 0U))
+	{
+#if (true == BINARY_MODE_ENABLED)
+		CONSOLELOG_SealBinaryBlock();
+#endif /* (true == BINARY_MODE_ENABLED) */
+		status = f_write(&g_fileObject, g_pu8BackDmaBuffer, g_u16BackDmaBufferIdx, &bytesWritten);
+	}
+	/* Raw Bytes Without Time Marks, The FIFO May Wrap */
+	if ((FR_OK == status) && (u32Read > u32Write))
+	{
+		status = f_write(&g_fileObject, (const uint8_t *)(uintptr_t)&g_pu8CircBuffer[u32Read],
+						 g_u32FifoSize - u32Read, &bytesWritten);
+		u32Read = 0UL;
+	}
+	if ((FR_OK == status) && (u32Read < u32Write))
+	{
+		status = f_write(&g_fileObject, (const uint8_t *)(uintptr_t)&g_pu8CircBuffer[u32Read],
+						 u32Write - u32Read, &bytesWritten);
+	}
+
+	if (FR_OK != f_close(&g_fileObject))
+	{
+		status = FR_DISK_ERR;
+	}
+	g_fileObject.obj.fs = NULL;
+
+	if (FR_OK != status)
+	{
+		PRINTF("ERR: Failed to Append Retained Data To %s. Error=%d\r\n", pcTarget, (uint16_t)status);
+		return ERROR_RECORD;
+	}
+
+#if (true == INFO_ENABLED)
+	PRINTF("INFO: Data Retained Over Reset Appended To %s.\r\n", pcTarget);
+#endif /* (true == INFO_ENABLED) */
+#endif /* (true == RETENTION_ENABLED) */
+
+	CONSOLELOG_ResetRetention();
+	return ERROR_NONE;
+}
+
+/**
+ * @brief 	Flush Timer Callback, Runs In Timer Service Task.
+ * @details The Timer Is Armed Once Per Burst, Not Re-Started On Every Byte. When It Expires Before The
+ * 			Deadline (Data Kept Coming), It Is Re-Armed For The Rest of The Timeout.
+ *
+ * @param 	xTimer Flush Timer.
+ */
+static void CONSOLELOG_FlushTimerCallback(TimerHandle_t xTimer)
+{
+	TickType_t xIdleTicks = xTaskGetTickCount() - g_lastDataTick;
+
+	if (xIdleTicks > g_xFlushTimeoutTicks)
+	{
+		g_bFlushArmed = false;
+		(void)xTaskNotify(g_xRecordTaskHandle, RECORD_EVENT_FLUSH, eSetBits);
+	}
+	else
+	{
+		(void)xTimerChangePeriod(xTimer, (g_xFlushTimeoutTicks - xIdleTicks) + 1U, 0U);
+	}
+}
+
+uint32_t CONSOLELOG_WaitForEvent(void)
+{
+	uint32_t u32Events = 0UL;
+
+	(void)xTaskNotifyWait(0UL, RECORD_EVENT_ALL, &u32Events, portMAX_DELAY);
+	return u32Events;
+}
+
 DWORD get_fattime(void)
 {
     irtc_datetime_t datetime = { 0U };
@@ -280,10 +1019,10 @@ error_t CONSOLELOG_CreateFile(void)
      * Justification: 'Snprintf' Is Deprecated But There Is No Better Equivalent For Safe String Formatting.
      */
     /*lint -e586*/
-    (void)snprintf(u8FileName, sizeof(u8FileName), "%s/%04d%02d%02d_%02d%02d%02d_%u.txt",
+    (void)snprintf(u8FileName, sizeof(u8FileName), "%s/%04d%02d%02d_%02d%02d%02d_%u.%s",
     		g_u8CurrentDirectory, datetimeGet.year, datetimeGet.month, datetimeGet.day,
              datetimeGet.hour, datetimeGet.minute, datetimeGet.second,
-             g_u32FileCounter++);
+             g_u32FileCounter++, (RECORD_MODE_BINARY == g_eRecordMode) ? "bin" : "txt");
     /*lint +e586 */
 
     /* Open New File */
@@ -328,6 +1067,9 @@ error_t CONSOLELOG_CreateFile(void)
     }
 
     g_u32CurrentFileSize = 0; // Reset file size
+    (void)strncpy(g_pxRetention->acPath, u8FileName, sizeof(g_pxRetention->acPath) - 1U);
+    g_pxRetention->acPath[sizeof(g_pxRetention->acPath) - 1U] = '\0';
+    CONSOLELOG_SealRetention();
 #if (true == INFO_ENABLED)
     PRINTF("INFO: Created Log %s.\r\n", u8FileName);
 #endif /* (true == INFO_ENABLED) */
@@ -382,6 +1124,15 @@ error_t CONSOLELOG_CreateDirectory(void)
     return ERROR_NONE;
 }
 
+#if (true == SWITCH_LATENCY_ENABLED)
+void CONSOLELOG_StartSwitchMeasure(uint32_t u32StartCycles)
+{
+	g_u32SwitchStartCycles 		= u32StartCycles;
+	g_u32SwitchLatencyCycles 	= 0UL;
+	g_bSwitchMeasuring 			= true;
+}
+#endif /* (true == SWITCH_LATENCY_ENABLED) */
+
 uint32_t CONSOLELOG_GetTransferedBytes(void)
 {
 	return g_u32BytesTransfered;
@@ -397,6 +1148,21 @@ void CONSOLELOG_ClearTransferedBytes(void)
 	g_u32BytesTransfered = 0;
 }
 
+uint32_t CONSOLELOG_GetDroppedBlocks(void)
+{
+	return g_u32DroppedBlocks;
+}
+
+uint32_t CONSOLELOG_GetFifoFullBytes(void)
+{
+	return g_u32FifoFullBytes;
+}
+
+bool CONSOLELOG_IsFifoEmpty(void)
+{
+	return (g_u32ReadIndex == g_u32WriteIndex);
+}
+
 FRESULT CONSOLELOG_CheckFileSystem(void)
 {
     DIR sDir;
@@ -415,9 +1181,39 @@ error_t CONSOLELOG_Init(void)
 
 	PARSER_ClearConfig();
 
+	/* Flush Deadline, Armed On Received Data */
+	if (NULL == g_xFlushTimer)
+	{
+		g_xFlushTimer = xTimerCreateStatic("flush", g_xFlushTimeoutTicks + 1U, pdFALSE, NULL,
+										   CONSOLELOG_FlushTimerCallback, &g_xFlushTimerBuffer);
+		if (NULL == g_xFlushTimer)
+		{
+			PRINTF("ERR: Flush Timer Creation Failed.\r\n");
+			return ERROR_RECORD;
+		}
+	}
+
+	if (NULL == g_xRecordMutex)
+	{
+		g_xRecordMutex = xSemaphoreCreateMutexStatic(&g_xRecordMutexBuffer);
+	}
+
+	/* Buffers Are Drawn Once, In The Same Order On Every Boot, So The Retained Ones Keep Their Address */
+	if (NULL == g_pu8RecordArena)
+	{
+		g_pu8RecordArena 	= (uint8_t *)MEM_Alloc(MEM_REGION_DMA, MEM_OWNER_RECORD, RECORD_ARENA_SIZE,
+												   "Recorder Arena");
+		g_pxRetention 		= (record_retention_t *)MEM_Alloc(MEM_REGION_RETAINED, MEM_OWNER_COMMON,
+															  sizeof(record_retention_t), "Recorder Retention");
+		g_pu8MkfsWork 		= (BYTE *)MEM_Alloc(MEM_REGION_SRAM, MEM_OWNER_RECORD, FF_MAX_SS, "f_mkfs Work Buffer");
+		if ((NULL == g_pu8RecordArena) || (NULL == g_pxRetention) || (NULL == g_pu8MkfsWork))
+		{
+			return ERROR_RECORD;
+		}
+	}
+
 	/* Logic Disk */
 	const TCHAR sLogicDisk[3U] = {SDDISK + '0', ':', '/'};
-	BYTE work[FF_MAX_SS];
 
 	/* Mount File System */
 	if (FR_OK != f_mount(&g_fileSystem, sLogicDisk, 0U))
@@ -449,7 +1245,7 @@ error_t CONSOLELOG_Init(void)
 #endif /* (true == DEBUG_ENABLED) */
 
         /* Make File System */
-        if (FR_OK != f_mkfs(sLogicDisk, NULL, work, sizeof work))
+        if (FR_OK != f_mkfs(sLogicDisk, NULL, g_pu8MkfsWork, FF_MAX_SS))
         {
             PRINTF("ERR: Init File System Failed.\r\n");
             return ERROR_FILESYSTEM;
@@ -459,15 +1255,120 @@ error_t CONSOLELOG_Init(void)
 	#error "ERR: f_mkfs() Function Is Disabled."
 #endif 	/* FF_USE_MKFS */
 
+    /* Log File Left Open By The Last Session Gets Its Size Back, Only That File Is Checked */
+    if (ERROR_NONE != DUMP_RepairIntent())
+    {
+    	PRINTF("ERR: Open Log of The Last Session Not Repaired.\r\n");
+    }
+
+    /* Data Dumped On The Last Power Loss Go Into Their Log File Before a New Session Starts */
+    if (ERROR_NONE != DUMP_Reconcile())
+    {
+    	PRINTF("ERR: Power Loss Dump Not Recovered.\r\n");
+    }
+
+    /* First Entry After Reset: Data Which The Reset Left In Retention RAM Go Into Their Log File As Well */
+    if (!g_bRetentionChecked)
+    {
+    	g_bRetentionChecked = true;
+
+    	/* Default Layout Till CONSOLELOG_Configure, a Valid Retention Header Carves The Layout of The Last Session */
+    	(void)CONSOLELOG_CarveArena(DEFAULT_FIFO_SIZE, DEFAULT_BLOCK_SIZE);
+    	if (ERROR_NONE != CONSOLELOG_RecoverRetained())
+    	{
+    		PRINTF("ERR: Retained Data Not Recovered, They Go Into The New Session.\r\n");
+    	}
+    }
+
     if (ERROR_NONE != CONSOLELOG_CreateDirectory())
     {
         PRINTF("ERR: Failed to create directory for logs.\r\n");
         return ERROR_FILESYSTEM;
     }
 
+    /* New Session, New Latency Histogram */
+    LATENCY_Reset();
+    g_u32DroppedBlocks = 0UL;
+    g_u32FifoFullBytes = 0UL;
+#if (true == BINARY_MODE_ENABLED)
+    g_u64BinOffset = 0ULL;
+#endif /* (true == BINARY_MODE_ENABLED) */
+
     return ERROR_NONE;
 }
 
+error_t CONSOLELOG_Configure(void)
+{
+	uint32_t u32FifoSize 	= PARSER_GetFifoSize();
+	uint32_t u32BlockSize 	= PARSER_GetBlockSize();
+	uint32_t u32Need 		= CONSOLELOG_ArenaNeed(u32FifoSize, u32BlockSize);
+	error_t retVal 			= ERROR_NONE;
+
+	g_xFlushTimeoutTicks = pdMS_TO_TICKS(PARSER_GetFlushTimeoutMs());
+
+	if ((u32FifoSize != g_u32FifoSize) || (u32BlockSize != g_u32BlockSize))
+	{
+		if (!CONSOLELOG_IsEmpty())
+		{
+			/* Data Retained Over Reset Which Could Not Be Recovered Go Into This Session First */
+			PRINTF("ERR: Recorder Buffers Hold Data, Layout Kept Till The Next Session.\r\n");
+			retVal = ERROR_CONFIG;
+		}
+		else if (!CONSOLELOG_CarveArena(u32FifoSize, u32BlockSize))
+		{
+			PRINTF("ERR: fifo_size %u And block_size %u Need %u B, Arena Has %u B. Defaults Are Used.\r\n",
+				   u32FifoSize, u32BlockSize, u32Need, RECORD_ARENA_SIZE);
+			(void)CONSOLELOG_CarveArena(DEFAULT_FIFO_SIZE, DEFAULT_BLOCK_SIZE);
+			retVal = ERROR_CONFIG;
+		}
+		else
+		{
+			;	/* Carved With The Configured Sizes */
+		}
+
+		if (CONSOLELOG_IsEmpty())
+		{
+			CONSOLELOG_ResetRetention();
+		}
+	}
+
+	if (PARSER_GetMode() != g_eRecordMode)
+	{
+		if (!CONSOLELOG_IsEmpty())
+		{
+			PRINTF("ERR: Recorder Buffers Hold Data, Mode Kept Till The Next Session.\r\n");
+			retVal = ERROR_CONFIG;
+		}
+		else
+		{
+			/* Text And Binary Blocks Do Not Share a Log File */
+			if (NULL != g_fileObject.obj.fs)
+			{
+				(void)f_close(&g_fileObject);
+				g_fileObject.obj.fs = NULL;
+				DUMP_ClearIntent();
+			}
+			g_eRecordMode = PARSER_GetMode();
+			CONSOLELOG_SealRetention();
+		}
+	}
+
+#if (true == INFO_ENABLED)
+	PRINTF("INFO: Memory Map: Arena 0x%08X, %u of %u B Used.\r\n", (uint32_t)(uintptr_t)g_pu8RecordArena,
+		   CONSOLELOG_ArenaNeed(g_u32FifoSize, g_u32BlockSize), RECORD_ARENA_SIZE);
+	PRINTF("INFO:   Blocks 0x%08X, %u x %u B.\r\n", (uint32_t)(uintptr_t)g_apu8Blocks[0], RECORD_BLOCK_COUNT,
+		   g_u32BlockSize);
+	PRINTF("INFO:   FIFO   0x%08X, %u B (Wake-Up At %u B).\r\n", (uint32_t)(uintptr_t)g_pu8CircBuffer, g_u32FifoSize,
+		   g_u32NotifyThreshold);
+	PRINTF("INFO:   Ticks  0x%08X, %u B.\r\n", (uint32_t)(uintptr_t)g_pu16ArrivalTick,
+		   g_u32FifoSize * (uint32_t)sizeof(uint16_t));
+	PRINTF("INFO:   Flush After %u ms Idle, UART Rx Watermark %u, %s Mode.\r\n", PARSER_GetFlushTimeoutMs(),
+		   PARSER_GetRxWatermark(), (RECORD_MODE_BINARY == g_eRecordMode) ? "Binary" : "Text");
+#endif /* (true == INFO_ENABLED) */
+
+	return retVal;
+}
+
 error_t CONSOLELOG_Recording(uint32_t file_size)
 {
     UINT bytesWritten;               //<! Bytes Written Into SD Card
@@ -479,11 +1380,46 @@ error_t CONSOLELOG_Recording(uint32_t file_size)
 
     uint32_t u32LocalWriteIndex = g_u32WriteIndex;
 
-    while (g_u32ReadIndex != u32LocalWriteIndex)
+    TRACE_BEGIN(TRACE_ID_RECORDING);
+
+#if (true == SWITCH_LATENCY_ENABLED)
+    if (0UL != g_u32SwitchLatencyCycles)
+    {
+#if (true == INFO_ENABLED)
+    	PRINTF("INFO: Mode Switch Latency (USB Detach -> First Recorded Byte): %u us\r\n",
+    			g_u32SwitchLatencyCycles / (SystemCoreClock / 1000000UL));
+#endif /* (true == INFO_ENABLED) */
+    	g_u32SwitchLatencyCycles = 0UL;
+    }
+#endif /* (true == SWITCH_LATENCY_ENABLED) */
+
+    /* New Data Arrived, Flush Deadline Is Counted From The Last Byte By The Timer Callback */
+    if ((g_u32ReadIndex != u32LocalWriteIndex) && (pdFALSE == xTimerIsTimerActive(g_xFlushTimer)))
+    {
+    	(void)xTimerChangePeriod(g_xFlushTimer, g_xFlushTimeoutTicks + 1U, 0U);
+    	g_bFlushArmed = true;
+    }
+
+#if (true == BINARY_MODE_ENABLED)
+    if (RECORD_MODE_BINARY == g_eRecordMode)
+    {
+    	/* Verbatim Copy Instead of The Text Loop Below, Which Then Finds Nothing To Do */
+    	u32LocalWriteIndex = CONSOLELOG_CollectBinary(u32LocalWriteIndex);
+    }
+#endif /* (true == BINARY_MODE_ENABLED) */
+
+    /* Stops After a Swap, The Next Block Is Collected Once The Full One Is Written (At Most One Swap Per Char) */
+    while ((g_u32ReadIndex != u32LocalWriteIndex) && !g_bBackDmaBufferReady)
     {
         /* Loads One Char From FIFO And Stores The Char Into Active DMA Buffer */
-        uint8_t currentChar = g_au8CircBuffer[g_u32ReadIndex];
-        g_u32ReadIndex = (g_u32ReadIndex + 1UL) % CIRCULAR_BUFFER_SIZE;
+        uint8_t currentChar = g_pu8CircBuffer[g_u32ReadIndex];
+        if (!g_bBackTagged)
+        {
+        	/* First Received Byte of The Block Is Its Oldest */
+        	g_u16BackOldestTick = g_pu16ArrivalTick[g_u32ReadIndex];
+        	g_bBackTagged = true;
+        }
+        g_u32ReadIndex = (g_u32ReadIndex + 1UL) % g_u32FifoSize;
 
         g_pu8BackDmaBuffer[g_u16BackDmaBufferIdx++] = currentChar;
 
@@ -493,6 +1429,7 @@ error_t CONSOLELOG_Recording(uint32_t file_size)
              (g_pu8BackDmaBuffer[g_u16BackDmaBufferIdx - 2U] == (uint8_t)'\r') &&
              (g_pu8BackDmaBuffer[g_u16BackDmaBufferIdx - 1U] == (uint8_t)'\n')))
         {
+        	TRACE_BEGIN(TRACE_ID_TIMESTAMP);
 
         	IRTC_GetDatetime(RTC, &datetimeGet);
             /* @note snprintf() Is Depricated But There Is No Better Equivalent */
@@ -503,36 +1440,29 @@ error_t CONSOLELOG_Recording(uint32_t file_size)
             /* Addition of Time Mark To The DMA Buffer */
             for (uint8_t i = 0; i < u8TimeLength; i++)
             {
-                if (BLOCK_SIZE > g_u16BackDmaBufferIdx)	// If DMA Buffer is Not Full
+                if (g_u32BlockSize > g_u16BackDmaBufferIdx)	// If DMA Buffer is Not Full
                 {
                 	g_pu8BackDmaBuffer[g_u16BackDmaBufferIdx++] = (uint8_t)timeString[i];
                 }
                 else
                 {
                     /* Switch To New DMA Buffer */
-                	g_pu8FrontDmaBuffer = g_pu8BackDmaBuffer;
-                	g_bBackDmaBufferReady = true;
-
-                	g_pu8BackDmaBuffer = (g_pu8BackDmaBuffer == g_au8DmaBuffer1) ? g_au8DmaBuffer2 : g_au8DmaBuffer1;
-                    g_u16BackDmaBufferIdx = 0;
+                	CONSOLELOG_SwapBuffers(g_u16BackDmaBufferIdx);
 
                     /* Continue in Addition of Time Mark */
                     g_pu8BackDmaBuffer[g_u16BackDmaBufferIdx++] = (uint8_t)timeString[i];
                 }
             }
+            TRACE_END(TRACE_ID_TIMESTAMP);
         }
 
         u8LastChar = currentChar; // Current Last Character For Next Buffer
 
         /* Check If DMA Buffer Is Full */
-        if (BLOCK_SIZE == g_u16BackDmaBufferIdx)
+        if (g_u32BlockSize == g_u16BackDmaBufferIdx)
         {
-        	g_pu8FrontDmaBuffer = g_pu8BackDmaBuffer;
-        	g_bBackDmaBufferReady = true;
-
             /* Switch on Next DMA Buffer */
-        	g_pu8BackDmaBuffer = (g_pu8BackDmaBuffer == g_au8DmaBuffer1) ? g_au8DmaBuffer2 : g_au8DmaBuffer1;
-            g_u16BackDmaBufferIdx = 0;
+        	CONSOLELOG_SwapBuffers(g_u16BackDmaBufferIdx);
         }
     }
 
@@ -544,6 +1474,7 @@ error_t CONSOLELOG_Recording(uint32_t file_size)
             if (ERROR_NONE != CONSOLELOG_CreateFile())
             {
                 PRINTF("ERR: Failed to create new file.\r\n");
+                TRACE_END(TRACE_ID_RECORDING);
                 return ERROR_OPEN;
             }
         }
@@ -559,13 +1490,27 @@ error_t CONSOLELOG_Recording(uint32_t file_size)
         uint32_t stat_reg = g_sd.host->hostController.base->ADMA_ERR_STATUS;
         if (0x0U != (stat_reg & (uint32_t)0xC))
         {
-            PRINTF("ERR: Failed to Write Data To File. Error=%d\r\n", ERROR_ADMA);
-            (void)f_close(&g_fileObject);
-            g_fileObject.obj.fs = NULL;
-            return ERROR_ADMA;
+            PRINTF("ERR: Failed to Write Data To File. Error=%d\r\n", ERROR_ADMA);
+            (void)f_close(&g_fileObject);
+            g_fileObject.obj.fs = NULL;
+            TRACE_END(TRACE_ID_RECORDING);
+            return ERROR_ADMA;
+        }
+        TRACE_BEGIN(TRACE_ID_F_WRITE);
+        if (FR_OK == f_write(&g_fileObject, g_pu8FrontDmaBuffer, g_u32BlockSize, &bytesWritten))
+        {
+        	/* Full Aligned Sector Goes To The Card Directly, Not Through The FatFs Window */
+        	LATENCY_Record(g_u16FrontOldestTick);
+        }
+        TRACE_END(TRACE_ID_F_WRITE);
+        g_u32CurrentFileSize += g_u32BlockSize;
+
+        /* First Block: The Entry Gets Its Start Cluster, The Boot Check Repairs The File From It If It Is Not Closed */
+        if ((g_u32BlockSize == g_u32CurrentFileSize) && (FR_OK == f_sync(&g_fileObject)))
+        {
+        	DUMP_SetIntent(g_pxRetention->acPath);
         }
-        (void)f_write(&g_fileObject, g_pu8FrontDmaBuffer, BLOCK_SIZE, &bytesWritten);
-        g_u32CurrentFileSize += BLOCK_SIZE;
+
         if (g_u32CurrentFileSize >= file_size)
         {
 #if (true == INFO_ENABLED)
@@ -573,12 +1518,20 @@ error_t CONSOLELOG_Recording(uint32_t file_size)
 #endif /* (true == INFO_ENABLED */
             (void)f_close(&g_fileObject);
             g_fileObject.obj.fs = NULL;
+            DUMP_ClearIntent();
         }
 
         g_bBackDmaBufferReady = false;   // Reset Flag of ADMA Buffer
         g_pu8FrontDmaBuffer = NULL;    	// Clear g_pu8FrontDmaBuffer
     }
 
+    /* One Block Is Collected Per Pass, The Next Pass Takes The Rest of The FIFO */
+    if (g_u32ReadIndex != g_u32WriteIndex)
+    {
+    	(void)xTaskNotify(g_xRecordTaskHandle, RECORD_EVENT_DATA, eSetBits);
+    }
+
+    TRACE_END(TRACE_ID_RECORDING);
     return ERROR_NONE;
 }
 
@@ -586,6 +1539,7 @@ error_t CONSOLELOG_Flush(void)
 {
 	FRESULT error;
 	UINT bytesWritten;
+	uint16_t u16ValidBytes;
 	TickType_t LastTick 	= 0;
 	TickType_t CurrentTick 	= xTaskGetTickCount();
 
@@ -605,7 +1559,7 @@ error_t CONSOLELOG_Flush(void)
 	/*lint +e40 */
 
 	if ((CurrentTick > LastTick) &&
-	    ((CurrentTick - LastTick) > FLUSH_TIMEOUT_TICKS) &&
+	    ((CurrentTick - LastTick) > g_xFlushTimeoutTicks) &&
 	    (g_u16BackDmaBufferIdx > 0U))
 	{
 #if (true == INFO_ENABLED)
@@ -615,18 +1569,21 @@ error_t CONSOLELOG_Flush(void)
 #elif (true == DEBUG_ENABLED)
 		PRINTF("DEBUG: Flush Triggered.\r\n");
 #endif /* (true == INFO_ENABLED) */
-
-		while (g_u16BackDmaBufferIdx < BLOCK_SIZE)			/* Fill Buffer With ' ' */
+#if ((true == INFO_ENABLED) && (USB_DEVICE_CONFIG_CDC_ACM > 0U))
+		PRINTF("INFO: USB CDC Stream Dropped Blocks = %u.\r\n", USB_DeviceCdcAcmGetDropped());
+#endif /* ((true == INFO_ENABLED) && (USB_DEVICE_CONFIG_CDC_ACM > 0U)) */
+
+#if (true == BINARY_MODE_ENABLED)
+		CONSOLELOG_SealBinaryBlock();
+#endif /* (true == BINARY_MODE_ENABLED) */
+		u16ValidBytes = g_u16BackDmaBufferIdx;
+		while (g_u16BackDmaBufferIdx < g_u32BlockSize)			/* Fill Buffer With ' ' */
 		{
 			g_pu8BackDmaBuffer[g_u16BackDmaBufferIdx++] = (uint8_t)' ';
 		}
 
-		g_pu8FrontDmaBuffer 	= g_pu8BackDmaBuffer;
-		g_bBackDmaBufferReady 	= true;
-
 		// Switch To Second Buffer
-		g_pu8BackDmaBuffer 	= (g_pu8BackDmaBuffer == g_au8DmaBuffer1) ? g_au8DmaBuffer2 : g_au8DmaBuffer1;
-		g_u16BackDmaBufferIdx	= 0;
+		CONSOLELOG_SwapBuffers(u16ValidBytes);
 
 		if (NULL == g_fileObject.obj.fs)
 		{
@@ -659,12 +1616,15 @@ error_t CONSOLELOG_Flush(void)
 			g_fileObject.obj.fs = NULL;
 			return ERROR_ADMA;
 		}
-		error = f_write(&g_fileObject, g_pu8FrontDmaBuffer, BLOCK_SIZE, &bytesWritten);
+		TRACE_BEGIN(TRACE_ID_F_WRITE);
+		error = f_write(&g_fileObject, g_pu8FrontDmaBuffer, g_u32BlockSize, &bytesWritten);
+		TRACE_END(TRACE_ID_F_WRITE);
 		if (FR_OK != error)
 		{
 			return (error_t)error;
 		}
-		g_u32CurrentFileSize += BLOCK_SIZE;
+		LATENCY_Record(g_u16FrontOldestTick);
+		g_u32CurrentFileSize += g_u32BlockSize;
 
 #if	(true == INFO_ENABLED)
 		PRINTF("INFO: Closing File\r\n");
@@ -672,15 +1632,21 @@ error_t CONSOLELOG_Flush(void)
 
 		(void)f_close(&g_fileObject);
 		g_fileObject.obj.fs 	= NULL;
+		DUMP_ClearIntent();
 		g_bBackDmaBufferReady 	= false;
 		g_pu8FrontDmaBuffer 	= NULL;
 		g_bFlushCompleted 		= true;
 
+#if (true == LOW_POWER_ENABLED)
+		/* Nothing Is Written Till The Next Burst, Card Idles In Stand-By State */
+		USB_Disk_EnterStandby();
+#endif /* (true == LOW_POWER_ENABLED) */
+
 		UART_Disable();
 		UART_Enable();
 	}
 	else if ((CurrentTick > LastTick) &&
-	    ((CurrentTick - LastTick) > FLUSH_TIMEOUT_TICKS))
+	    ((CurrentTick - LastTick) > g_xFlushTimeoutTicks))
 	{
 		UART_Disable();
 		UART_Enable();
@@ -692,36 +1658,46 @@ error_t CONSOLELOG_Flush(void)
 	return ERROR_NONE;
 }
 
+void CONSOLELOG_Lock(void)
+{
+	if (NULL != g_xRecordMutex)
+	{
+		(void)xSemaphoreTake(g_xRecordMutex, portMAX_DELAY);
+	}
+}
+
+void CONSOLELOG_Unlock(void)
+{
+	if (NULL != g_xRecordMutex)
+	{
+		(void)xSemaphoreGive(g_xRecordMutex);
+	}
+}
+
 error_t CONSOLELOG_PowerLossFlush(void)
 {
 	UINT bytesWritten;
+	uint16_t u16ValidBytes;
+	error_t retVal = ERROR_NONE;
 
 	/* Finish The Receiving of New Data */
 	UART_Disable();
 
-	if (g_u16BackDmaBufferIdx > 0U)
+	/* record_task Finishes Its Pass First, So The Buffers Are Consistent And No Block Is Half Written */
+	CONSOLELOG_Lock();
+
+	if ((g_u16BackDmaBufferIdx > 0U) || g_bBackDmaBufferReady || (g_u32ReadIndex != g_u32WriteIndex))
 	{
 #if (true == INFO_ENABLED)
 		PRINTF("INFO: Pwrloss Flush Triggered.\r\n");
 #endif /* (true == INFO_ENABLED) */
 
-		while (g_u16BackDmaBufferIdx < BLOCK_SIZE)			/* Fill Buffer With ' ' */
-		{
-			g_pu8BackDmaBuffer[g_u16BackDmaBufferIdx++] = (uint8_t)' ';
-		}
-
-		g_pu8FrontDmaBuffer 		= g_pu8BackDmaBuffer;
-		g_bBackDmaBufferReady 	= true;
-
-		// Switch To Second Buffer
-		g_pu8BackDmaBuffer 	= (g_pu8BackDmaBuffer == g_au8DmaBuffer1) ? g_au8DmaBuffer2 : g_au8DmaBuffer1;
-		g_u16BackDmaBufferIdx	= 0;
-
 		if (NULL == g_fileObject.obj.fs)
 		{
 			if (ERROR_NONE != CONSOLELOG_CreateFile())
 			{
 				PRINTF("ERR: Failed to Create New File During Flush.\r\n");
+				CONSOLELOG_Unlock();
 				return ERROR_RECORD;
 			}
 		}
@@ -746,24 +1722,211 @@ error_t CONSOLELOG_PowerLossFlush(void)
 			PRINTF("ERR: Failed to Write Data To File During Flush. Error=%d\r\n", ERROR_ADMA);
 			(void)f_close(&g_fileObject);
 			g_fileObject.obj.fs = NULL;
+			CONSOLELOG_Unlock();
 			return ERROR_ADMA;
 		}
-		(void)f_write(&g_fileObject, g_pu8FrontDmaBuffer, BLOCK_SIZE, &bytesWritten);
-		g_u32CurrentFileSize += BLOCK_SIZE;
+
+		/* Full Block Which record_task Did Not Reach (File Not Opened or ADMA Error), a Failed f_write Is Not Retried */
+		if (g_bBackDmaBufferReady && (NULL != g_pu8FrontDmaBuffer))
+		{
+			TRACE_BEGIN(TRACE_ID_F_WRITE);
+			(void)f_write(&g_fileObject, g_pu8FrontDmaBuffer, g_u32BlockSize, &bytesWritten);
+			TRACE_END(TRACE_ID_F_WRITE);
+			g_u32CurrentFileSize += g_u32BlockSize;
+			g_bBackDmaBufferReady = false;
+		}
+
+#if (true == BINARY_MODE_ENABLED)
+		/* The Block Ends With Its Payload, The FIFO Bytes Follow Without Header */
+		CONSOLELOG_SealBinaryBlock();
+#endif /* (true == BINARY_MODE_ENABLED) */
+
+		/* Bytes Still In FIFO Follow Raw, Without Time Marks (As In The Dump), Full Blocks Are Written On The Way */
+		while (g_u32ReadIndex != g_u32WriteIndex)
+		{
+			g_pu8BackDmaBuffer[g_u16BackDmaBufferIdx++] = g_pu8CircBuffer[g_u32ReadIndex];
+			g_u32ReadIndex = (g_u32ReadIndex + 1UL) % g_u32FifoSize;
+			if (g_u32BlockSize == g_u16BackDmaBufferIdx)
+			{
+				CONSOLELOG_SwapBuffers(g_u16BackDmaBufferIdx);
+
+				TRACE_BEGIN(TRACE_ID_F_WRITE);
+				(void)f_write(&g_fileObject, g_pu8FrontDmaBuffer, g_u32BlockSize, &bytesWritten);
+				TRACE_END(TRACE_ID_F_WRITE);
+				g_u32CurrentFileSize += g_u32BlockSize;
+				g_bBackDmaBufferReady = false;
+			}
+		}
+
+		if (g_u16BackDmaBufferIdx > 0U)
+		{
+			u16ValidBytes = g_u16BackDmaBufferIdx;
+			while (g_u16BackDmaBufferIdx < g_u32BlockSize)			/* Fill Buffer With ' ' */
+			{
+				g_pu8BackDmaBuffer[g_u16BackDmaBufferIdx++] = (uint8_t)' ';
+			}
+
+			// Switch To Second Buffer
+			CONSOLELOG_SwapBuffers(u16ValidBytes);
+
+			TRACE_BEGIN(TRACE_ID_F_WRITE);
+			(void)f_write(&g_fileObject, g_pu8FrontDmaBuffer, g_u32BlockSize, &bytesWritten);
+			TRACE_END(TRACE_ID_F_WRITE);
+			g_u32CurrentFileSize += g_u32BlockSize;
+		}
 
 #if	(true == INFO_ENABLED)
 		PRINTF("INFO: Closing File\r\n");
 #endif /* (true == INFO_ENABLED) */
 
-		(void)f_close(&g_fileObject);
+		if (FR_OK != f_close(&g_fileObject))
+		{
+			retVal = ERROR_CLOSE;
+		}
 		g_fileObject.obj.fs 	= NULL;
+		DUMP_ClearIntent();
 		g_bBackDmaBufferReady 	= false;
 		g_pu8FrontDmaBuffer 	= NULL;
 		g_bFlushCompleted 		= true;
 	}
-	return ERROR_NONE;
+
+	CONSOLELOG_Unlock();
+	return retVal;
+}
+
+
+void CONSOLELOG_ReportLatency(void)
+{
+	CONSOLELOG_Lock();
+	/* No Session Directory Before The First Session */
+	if ('\0' != g_u8CurrentDirectory[0])
+	{
+		LATENCY_Report(g_u8CurrentDirectory);
+	}
+	CONSOLELOG_Unlock();
+}
+
+void CONSOLELOG_ReleaseBuffers(void)
+{
+	CONSOLELOG_Lock();
+	if (!CONSOLELOG_IsEmpty())
+	{
+		PRINTF("ERR: Recorder Buffers Not Flushed, Their Data Are Dropped.\r\n");
+	}
+	CONSOLELOG_ResetRetention();
+	CONSOLELOG_Unlock();
 }
 
+error_t CONSOLELOG_PowerLossDump(void)
+{
+	dump_region_t axRegions[3U];
+	dump_piece_t axPieces[4U];
+	uint16_t u16Regions = 0U;
+	uint16_t u16Pieces 	= 0U;
+	uint32_t u32Read;
+	uint32_t u32Write;
+	error_t retVal;
+
+	/* Finish The Receiving of New Data */
+	UART_Disable();
+
+	/* record_task Finishes Its Pass First, So The Buffers Are Consistent */
+	CONSOLELOG_Lock();
+
+	if (!DUMP_IsReady())
+	{
+		CONSOLELOG_Unlock();
+		return CONSOLELOG_PowerLossFlush();
+	}
+
+	/* Pieces In Order of Arrival: Full Block Not Written By record_task, Back Buffer, Unprocessed FIFO */
+	if (g_bBackDmaBufferReady && (NULL != g_pu8FrontDmaBuffer))
+	{
+		axRegions[u16Regions].pu8Data 		= g_pu8FrontDmaBuffer;
+		axRegions[u16Regions].u16Sectors 	= (uint16_t)(g_u32BlockSize / RECORD_SECTOR_SIZE);
+		axPieces[u16Pieces].u8Region 		= (uint8_t)u16Regions;
+		axPieces[u16Pieces].u16Offset 		= 0U;
+		axPieces[u16Pieces].u16Bytes 		= (uint16_t)g_u32BlockSize;
+		u16Regions++;
+		u16Pieces++;
+	}
+
+	if (g_u16BackDmaBufferIdx > 0U)
+	{
+#if (true == BINARY_MODE_ENABLED)
+		/* The Block Ends With Its Payload, The FIFO Bytes Follow Without Header */
+		CONSOLELOG_SealBinaryBlock();
+#endif /* (true == BINARY_MODE_ENABLED) */
+		axRegions[u16Regions].pu8Data 		= g_pu8BackDmaBuffer;
+		axRegions[u16Regions].u16Sectors 	= (uint16_t)((g_u16BackDmaBufferIdx + RECORD_SECTOR_SIZE - 1U) /
+														 RECORD_SECTOR_SIZE);
+		axPieces[u16Pieces].u8Region 		= (uint8_t)u16Regions;
+		axPieces[u16Pieces].u16Offset 		= 0U;
+		axPieces[u16Pieces].u16Bytes 		= g_u16BackDmaBufferIdx;
+		u16Regions++;
+		u16Pieces++;
+	}
+
+	u32Read  = g_u32ReadIndex;
+	u32Write = g_u32WriteIndex;
+	if (u32Read != u32Write)
+	{
+		/* Raw Bytes Without Time Marks, The Ring Is Dumped Whole And May Wrap */
+		axRegions[u16Regions].pu8Data 		= (const uint8_t *)(uintptr_t)g_pu8CircBuffer;
+		axRegions[u16Regions].u16Sectors 	= (uint16_t)(g_u32FifoSize / RECORD_SECTOR_SIZE);
+		axPieces[u16Pieces].u8Region 		= (uint8_t)u16Regions;
+		axPieces[u16Pieces].u16Offset 		= (uint16_t)u32Read;
+		axPieces[u16Pieces].u16Bytes 		= (uint16_t)((u32Read < u32Write) ? (u32Write - u32Read) :
+																			(g_u32FifoSize - u32Read));
+		u16Pieces++;
+		if ((u32Read > u32Write) && (0UL != u32Write))
+		{
+			axPieces[u16Pieces].u8Region 	= (uint8_t)u16Regions;
+			axPieces[u16Pieces].u16Offset 	= 0U;
+			axPieces[u16Pieces].u16Bytes 	= (uint16_t)u32Write;
+			u16Pieces++;
+		}
+		u16Regions++;
+	}
+
+	if (0U == u16Pieces)
+	{
+		CONSOLELOG_Unlock();
+		return ERROR_NONE;
+	}
+
+#if (true == INFO_ENABLED)
+	PRINTF("INFO: Pwrloss Dump Triggered.\r\n");
+#endif /* (true == INFO_ENABLED) */
+
+	retVal = DUMP_Write((NULL != g_fileObject.obj.fs) ? g_pxRetention->acPath : NULL, axRegions, u16Regions,
+						axPieces, u16Pieces);
+	if (ERROR_NONE != retVal)
+	{
+		PRINTF("ERR: Pwrloss Dump Failed, Flushing Through File System.\r\n");
+		CONSOLELOG_Unlock();
+		return CONSOLELOG_PowerLossFlush();
+	}
+
+	/* Dumped Data Are Owned By The Dump Now, They Must Not Be Written Again */
+	g_bBackDmaBufferReady 	= false;
+	g_pu8FrontDmaBuffer 	= NULL;
+	g_u16BackDmaBufferIdx 	= 0U;
+	g_bBackTagged 			= false;
+	g_u32ReadIndex 			= u32Write;
+
+	/* Data Are Safe, The Rest of The Hold-Up Commits The Directory Entry (No Cluster Is Allocated) */
+	if (NULL != g_fileObject.obj.fs)
+	{
+		(void)f_close(&g_fileObject);
+		g_fileObject.obj.fs = NULL;
+		DUMP_ClearIntent();
+	}
+	g_bFlushCompleted = true;
+
+	CONSOLELOG_Unlock();
+	return ERROR_NONE;
+}
 
 error_t CONSOLELOG_Deinit(void)
 {
@@ -781,6 +1944,7 @@ error_t CONSOLELOG_Deinit(void)
             PRINTF("ERR: Failed to Close File. ERR=%d\r\n", error);
             return ERROR_CLOSE;
         }
+        DUMP_ClearIntent();
     }
 
 
@@ -799,146 +1963,356 @@ error_t CONSOLELOG_Deinit(void)
 	return ERROR_NONE;
 }
 
-error_t CONSOLELOG_ReadConfig(void)
+/**
+ * @brief 	Remembers The Directory Entry And The CRC of The Configuration File Just Read.
+ *
+ * @param 	u32Crc CRC-32 of The Content.
+ */
+static void CONSOLELOG_StampConfig(uint32_t u32Crc)
 {
-    FRESULT error;
-    DIR dir;           					//<! Opened Directory
-    FILINFO fno;       					//<! Information About File
-    FIL configFile;    					//<! Opened File
-    UINT bytesRead;    					//<! Number of Read Bytes
+	FILINFO fno;
 
-    error = f_opendir(&dir, "/");
-    if (FR_OK != error)
-    {
-#if (CONTROL_LED_ENABLED == true)
-    	LED_SignalError();
-#endif /* (CONTROL_LED_ENABLED == true) */
+	g_xConfigStamp.bValid = (FR_OK == f_stat(CONFIG_FILE, &fno));
+	if (g_xConfigStamp.bValid)
+	{
+		g_xConfigStamp.u32Size = (uint32_t)fno.fsize;
+		g_xConfigStamp.u16Date = fno.fdate;
+		g_xConfigStamp.u16Time = fno.ftime;
+		g_xConfigStamp.u32Crc  = u32Crc;
+	}
+}
 
-    	PRINTF("ERR: Failed to Open Root Dir. ERR=%d\r\n", error);
-        return ERROR_OPEN;
-    }
+#if (true == CONFIG_RELOAD_ENABLED)
+/**
+ * @brief 	Checks Whether The Configuration File Differs From The One Read Last.
+ * @details An Unchanged Directory Entry Costs One f_stat, The Content Is Read Only When The Entry Changed.
+ * 			A Removed File Is Not a Change, The Current Configuration Is Kept.
+ *
+ * @return 	True If The File Has To Be Read Again.
+ */
+static bool CONSOLELOG_IsConfigChanged(void)
+{
+	FILINFO fno;
+	FIL configFile;
+	UINT bytesRead;
+	char acChunk[PARSER_CHUNK_SIZE];
+	uint32_t u32Crc = 0UL;
+
+	if (FR_OK != f_stat(CONFIG_FILE, &fno))
+	{
+		return false;
+	}
+	if (!g_xConfigStamp.bValid)
+	{
+		return true;
+	}
+	if ((g_xConfigStamp.u32Size == (uint32_t)fno.fsize) && (g_xConfigStamp.u16Date == fno.fdate) &&
+		(g_xConfigStamp.u16Time == fno.ftime))
+	{
+		return false;
+	}
 
-    while (true)
+	if (FR_OK != f_open(&configFile, CONFIG_FILE, FA_READ))
 	{
-    	error = f_readdir(&dir, &fno);
-    	if (FR_OK != error || 0UL == (uint32_t)fno.fname[0])
+		return false;
+	}
+	do
+	{
+		if (FR_OK != f_read(&configFile, acChunk, sizeof(acChunk), &bytesRead))
 		{
-			break; 	// End of Directory or Error
+			(void)f_close(&configFile);
+			return false;
 		}
+		u32Crc = DUMP_Crc32(u32Crc, (const uint8_t *)acChunk, (uint32_t)bytesRead);
+	} while (sizeof(acChunk) == bytesRead);
+	(void)f_close(&configFile);
 
-    	if ((fno.fattrib & (BYTE)AM_DIR) == 0U)	// If Not Directory
-    	{
-    		if (ERROR_NONE == (uint32_t)strcmp(fno.fname, CONFIG_FILE))	// If config File
+	if (u32Crc == g_xConfigStamp.u32Crc)
+	{
+		/* Rewritten With The Same Content, Only The Entry Is Taken Over */
+		CONSOLELOG_StampConfig(u32Crc);
+		return false;
+	}
+	return true;
+}
+
+/**
+ * @brief 	Returns The Name of an Enumerated Value of a Key.
+ *
+ * @param 	pcKey Key.
+ * @param 	u32Value Value.
+ *
+ * @return 	Name From The Key Table, NULL If The Key Is Not Enumerated.
+ */
+static const char *CONSOLELOG_ValueName(const char *pcKey, uint32_t u32Value)
+{
+	uint32_t u32Count = 0UL;
+	const parser_key_t *pxKeys = PARSER_GetKeys(&u32Count);
+
+	for (uint32_t i = 0UL; i < u32Count; i++)
+	{
+		if ((0 == strcmp(pxKeys[i].pcKey, pcKey)) && (PARSER_TYPE_ENUM == pxKeys[i].eType))
+		{
+			for (const parser_name_t *pxName = pxKeys[i].pxNames; NULL != pxName->pcName; pxName++)
 			{
-#if (true == DEBUG_ENABLED)
-    			PRINTF("DEBUG: Found .config File: %s\r\n", fno.fname);
-#endif /* (true == DEBUG_ENABLED) */
-    			error = f_open(&configFile, CONFIG_FILE, FA_READ);
-    			if (FR_OK != error)
+				if (u32Value == pxName->u32Value)
 				{
-#if (CONTROL_LED_ENABLED == true)
-    				LED_SignalError();
-#endif /* (CONTROL_LED_ENABLED == true) */
-
-    				PRINTF("ERR: Failed To Open .config File. ERR=%d\r\n", error);
-    				(void)f_closedir(&dir); 	// Close Root Directory
-					return ERROR_OPEN;
+					return pxName->pcName;
 				}
-    			(void)memset(g_au8DmaBuffer1, 0, sizeof(g_au8DmaBuffer1));
-    			error = f_read(&configFile, g_au8DmaBuffer1, sizeof(g_au8DmaBuffer1) - 1UL, &bytesRead);
-				if (FR_OK != error)
-				{
-#if (CONTROL_LED_ENABLED == true)
-					LED_SignalError();
-#endif /* (CONTROL_LED_ENABLED == true) */
+			}
+		}
+	}
+	return NULL;
+}
 
-					PRINTF("ERR: Failed To Read .config File. ERR=%d\r\n", error);
-					(void)f_close(&configFile);
-					(void)f_closedir(&dir);
-					return ERROR_READ;
-				}
+/**
+ * @brief 	Appends a Changed Key To The Marker Line.
+ *
+ * @param 	pcLine Marker Line, RECORD_MARKER_SIZE Bytes.
+ * @param 	u32Length Current Length of The Line.
+ * @param 	pcKey Key.
+ * @param 	u32Old Value Before The Reload.
+ * @param 	u32New Value After The Reload.
+ *
+ * @return 	New Length of The Line, Keys Which Do Not Fit Are Left Out.
+ */
+static uint32_t CONSOLELOG_MarkChange(char *pcLine, uint32_t u32Length, const char *pcKey, uint32_t u32Old,
+									  uint32_t u32New)
+{
+	const char *pcOld = CONSOLELOG_ValueName(pcKey, u32Old);
+	const char *pcNew = CONSOLELOG_ValueName(pcKey, u32New);
+	/* Room For The Line End */
+	uint32_t u32Room = RECORD_MARKER_SIZE - 2U - u32Length;
+	int written;
 
-				if (ERROR_NONE != CONSOLELOG_ProccessConfigFile((const char *)g_au8DmaBuffer1))
-				{
-#if (CONTROL_LED_ENABLED == true)
-					LED_SignalError();
-#endif /* (CONTROL_LED_ENABLED == true) */
+	if (u32Old == u32New)
+	{
+		return u32Length;
+	}
 
-					PRINTF("ERR: Failed To Read .config File. ERR=%d\r\n", error);
-					(void)f_close(&configFile);
-					(void)f_closedir(&dir);
-					return ERROR_READ;
-				}
+	/*lint -e586 */
+	if ((NULL != pcOld) && (NULL != pcNew))
+	{
+		written = snprintf(&pcLine[u32Length], u32Room, " %s %s -> %s;", pcKey, pcOld, pcNew);
+	}
+	else
+	{
+		written = snprintf(&pcLine[u32Length], u32Room, " %s %u -> %u;", pcKey, u32Old, u32New);
+	}
+	/*lint +e586 */
+
+	if ((written < 0) || ((uint32_t)written >= u32Room))
+	{
+		pcLine[u32Length] = '\0';
+		return u32Length;
+	}
+	return u32Length + (uint32_t)written;
+}
 
-				// Processed Configuration File
-				(void)f_close(&configFile);
-				(void)f_closedir(&dir);
-				return ERROR_NONE;
+/**
+ * @brief 	Inserts a Line Into The Recorded Stream, It Reaches The Card With The Next Block or The Idle Flush.
+ * @details Called With The Record Lock Held And The UART Disabled.
+ *
+ * @param 	pcLine Line.
+ * @param 	u32Length Length of The Line.
+ */
+static void CONSOLELOG_InsertMarker(const char *pcLine, uint32_t u32Length)
+{
+	for (uint32_t i = 0UL; i < u32Length; i++)
+	{
+		if (g_u32BlockSize == g_u16BackDmaBufferIdx)
+		{
+			if (g_bBackDmaBufferReady)
+			{
+				PRINTF("ERR: No Free Block, Configuration Marker Truncated.\r\n");
+				break;
 			}
-    	}
+			CONSOLELOG_SwapBuffers(g_u16BackDmaBufferIdx);
+		}
+		if (!g_bBackTagged)
+		{
+			g_u16BackOldestTick = (uint16_t)xTaskGetTickCount();
+			g_bBackTagged = true;
+		}
+		g_pu8BackDmaBuffer[g_u16BackDmaBufferIdx++] = (uint8_t)pcLine[i];
+	}
+
+	/* No Data May Follow, The Idle Flush Writes The Marker */
+	if (pdFALSE == xTimerIsTimerActive(g_xFlushTimer))
+	{
+		(void)xTimerChangePeriod(g_xFlushTimer, g_xFlushTimeoutTicks + 1U, 0U);
+		g_bFlushArmed = true;
 	}
-    PRINTF("ERR: .config file not found in root directory.\r\n");
-    (void)f_closedir(&dir);
-	return ERROR_OPEN;
 }
+#endif /* (true == CONFIG_RELOAD_ENABLED) */
 
-error_t CONSOLELOG_ProccessConfigFile(const char *content)
+error_t CONSOLELOG_ReadConfig(void)
 {
-    error_t error;
+    FRESULT error;
+    FIL configFile;    					//<! Opened File
+    UINT bytesRead;    					//<! Number of Read Bytes
+    char acChunk[PARSER_CHUNK_SIZE];	//<! Chunk of The File, The Size of The File Is Not Limited
+    uint32_t u32Crc = 0UL;				//<! CRC of The Content, Compared When USB Detaches
+    error_t retVal;
 
-    error = PARSER_ParseBaudrate(content);
-    if (error != ERROR_NONE)
+    error = f_open(&configFile, CONFIG_FILE, FA_READ);
+    if (FR_NO_FILE == error)
     {
-#if (CONTROL_LED_ENABLED == true)
-        LED_SignalError();
-#endif
-        return error;
+    	PRINTF("ERR: .config file not found in root directory.\r\n");
+    	return ERROR_OPEN;
     }
-
-    error = PARSER_ParseFileSize(content);
-    if (error != ERROR_NONE)
-    {
+    if (FR_OK != error)
+	{
 #if (CONTROL_LED_ENABLED == true)
-        LED_SignalError();
-#endif
-        return error;
-    }
+		LED_SignalError();
+#endif /* (CONTROL_LED_ENABLED == true) */
 
-    error = PARSER_ParseStopBits(content);
-    if (error != ERROR_NONE)
-    {
-#if (CONTROL_LED_ENABLED == true)
-        LED_SignalError();
-#endif
-        return error;
-    }
+		PRINTF("ERR: Failed To Open .config File. ERR=%d\r\n", error);
+		return ERROR_OPEN;
+	}
+
+#if (true == DEBUG_ENABLED)
+    PRINTF("DEBUG: Found .config File: %s\r\n", CONFIG_FILE);
+#endif /* (true == DEBUG_ENABLED) */
 
-    error = PARSER_ParseDataBits(content);
-    if (error != ERROR_NONE)
+    PARSER_Begin();
+    do
     {
+    	error = f_read(&configFile, acChunk, sizeof(acChunk), &bytesRead);
+		if (FR_OK != error)
+		{
 #if (CONTROL_LED_ENABLED == true)
-        LED_SignalError();
-#endif
-        return error;
-    }
+			LED_SignalError();
+#endif /* (CONTROL_LED_ENABLED == true) */
 
-    error = PARSER_ParseParity(content);
-    if (error != ERROR_NONE)
-    {
+			PRINTF("ERR: Failed To Read .config File. ERR=%d\r\n", error);
+			(void)f_close(&configFile);
+			PARSER_ClearConfig();		/* No Half-Applied Configuration */
+			return ERROR_READ;
+		}
+		PARSER_Feed(acChunk, (uint32_t)bytesRead);
+		u32Crc = DUMP_Crc32(u32Crc, (const uint8_t *)acChunk, (uint32_t)bytesRead);
+    } while (sizeof(acChunk) == bytesRead);
+
+    (void)f_close(&configFile);
+    CONSOLELOG_StampConfig(u32Crc);
+
+    /* Invalid Lines Are Reported One By One, The Valid Ones Are Applied */
+    retVal = PARSER_End();
 #if (CONTROL_LED_ENABLED == true)
-        LED_SignalError();
-#endif
-        return error;
+    if (ERROR_NONE != retVal)
+    {
+    	LED_SignalError();
     }
+#endif /* (CONTROL_LED_ENABLED == true) */
+    return retVal;
+}
+
+#if (true == CONFIG_RELOAD_ENABLED)
+error_t CONSOLELOG_ReloadConfig(void)
+{
+	REC_config_t xOld;
+	REC_config_t xNew;
+	irtc_datetime_t datetimeGet;
+	char acMarker[RECORD_MARKER_SIZE];
+	uint32_t u32Length;
+	uint32_t u32Prefix;
+	error_t retVal;
+
+	if (!CONSOLELOG_IsConfigChanged())
+	{
+		return ERROR_NONE;
+	}
 
-    error = PARSER_ParseFreeSpace(content);
-	if (error != ERROR_NONE)
+	xOld = PARSER_GetConfig();
+	retVal = CONSOLELOG_ReadConfig();
+	if (ERROR_NONE != retVal)
 	{
-#if (CONTROL_LED_ENABLED == true)
-		LED_SignalError();
-#endif
-		return error;
+		/* Parsing Starts From Defaults, a Failed Read or an Invalid Line Must Not Apply Them Over The Running Setup */
+		PARSER_SetConfig(&xOld);
+		PRINTF("ERR: Configuration Not Reloaded, The Previous One Is Kept.\r\n");
+		return retVal;
 	}
-    return ERROR_NONE;
+	xNew = PARSER_GetConfig();
+
+	/* Layout, Flush Timeout And Mode, The Buffers Are Empty After The Mass Storage Session So They Can Be Re-Carved */
+	if ((xNew.fifo_size != xOld.fifo_size) || (xNew.block_size != xOld.block_size) ||
+		(xNew.flush_timeout_ms != xOld.flush_timeout_ms) || (xNew.mode != xOld.mode))
+	{
+		CONSOLELOG_Lock();
+		if (ERROR_NONE != CONSOLELOG_Configure())
+		{
+			retVal = ERROR_CONFIG;
+		}
+		CONSOLELOG_Unlock();
+	}
+
+	IRTC_GetDatetime(RTC, &datetimeGet);
+	/*lint -e586 */
+	u32Prefix = (uint32_t)snprintf(acMarker, sizeof(acMarker), "(%02d:%02d:%02d) [config]", datetimeGet.hour,
+								   datetimeGet.minute, datetimeGet.second);
+	/*lint +e586 */
+	u32Length = u32Prefix;
+	u32Length = CONSOLELOG_MarkChange(acMarker, u32Length, "baudrate", xOld.baudrate, xNew.baudrate);
+	u32Length = CONSOLELOG_MarkChange(acMarker, u32Length, "data_bits", (uint32_t)xOld.data_bits,
+									  (uint32_t)xNew.data_bits);
+	u32Length = CONSOLELOG_MarkChange(acMarker, u32Length, "parity", (uint32_t)xOld.parity, (uint32_t)xNew.parity);
+	u32Length = CONSOLELOG_MarkChange(acMarker, u32Length, "stop_bits", (uint32_t)xOld.stop_bits,
+									  (uint32_t)xNew.stop_bits);
+	u32Length = CONSOLELOG_MarkChange(acMarker, u32Length, "rx_watermark", xOld.rx_watermark, xNew.rx_watermark);
+	u32Length = CONSOLELOG_MarkChange(acMarker, u32Length, "mode", (uint32_t)xOld.mode, (uint32_t)xNew.mode);
+	u32Length = CONSOLELOG_MarkChange(acMarker, u32Length, "file_size", xOld.size, xNew.size);
+	u32Length = CONSOLELOG_MarkChange(acMarker, u32Length, "fifo_size", xOld.fifo_size, xNew.fifo_size);
+	u32Length = CONSOLELOG_MarkChange(acMarker, u32Length, "block_size", xOld.block_size, xNew.block_size);
+	u32Length = CONSOLELOG_MarkChange(acMarker, u32Length, "flush_timeout_ms", xOld.flush_timeout_ms,
+									  xNew.flush_timeout_ms);
+	u32Length = CONSOLELOG_MarkChange(acMarker, u32Length, "led_interval_ms", xOld.led_interval_ms,
+									  xNew.led_interval_ms);
+	u32Length = CONSOLELOG_MarkChange(acMarker, u32Length, "free_space", xOld.free_space_limit_mb,
+									  xNew.free_space_limit_mb);
+	u32Length = CONSOLELOG_MarkChange(acMarker, u32Length, "durability_ms", xOld.durability_ms,
+									  xNew.durability_ms);
+
+	if (u32Prefix == u32Length)
+	{
+#if (true == INFO_ENABLED)
+		PRINTF("INFO: Configuration File Changed, No Key Changed.\r\n");
+#endif /* (true == INFO_ENABLED) */
+		return retVal;
+	}
+
+	acMarker[u32Length++] = '\r';
+	acMarker[u32Length++] = '\n';
+	acMarker[u32Length] 	= '\0';
+#if (true == INFO_ENABLED)
+	PRINTF("INFO: Configuration Applied:%s", &acMarker[u32Prefix]);
+#endif /* (true == INFO_ENABLED) */
+
+	CONSOLELOG_Lock();
+
+	/* Lowered Limit: The Log Is Rotated Now, So The Marker Opens The Log Recorded With The New Configuration */
+	if ((NULL != g_fileObject.obj.fs) && (g_u32CurrentFileSize >= xNew.size))
+	{
+		(void)f_close(&g_fileObject);
+		g_fileObject.obj.fs = NULL;
+		DUMP_ClearIntent();
+	}
+
+	/* The Binary Log Holds Received Bytes Only, There The Change Is Reported On The Console Above */
+	if (RECORD_MODE_BINARY != g_eRecordMode)
+	{
+		CONSOLELOG_InsertMarker(acMarker, u32Length);
+	}
+	CONSOLELOG_Unlock();
+
+	return retVal;
+}
+#endif /* (true == CONFIG_RELOAD_ENABLED) */
+
+error_t CONSOLELOG_ProccessConfigFile(const char *content)
+{
+	PARSER_Begin();
+	PARSER_Feed(content, (uint32_t)strlen(content));
+	return PARSER_End();
 }
 
@@ -0,0 +1,278 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      trace.c
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    DWT Cycle Counter Tracer of The Hot Paths (Begin/End Events In RAM Ring).
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           trace.c
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          DWT Cycle Counter Tracer of The Hot Paths (Begin/End Events In RAM Ring).
+ * ****************************/
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "fsl_common.h"
+#include "fsl_debug_console.h"
+#include "ff.h"
+
+#include "trace.h"
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/**
+ * @brief 	Mask of The Ring Index.
+ */
+#define TRACE_RING_MASK				(TRACE_RING_EVENTS - 1U)
+
+/*******************************************************************************
+ * Global Variables
+ ******************************************************************************/
+#if (true == TRACE_ENABLED)
+/**
+ * @brief 	Spike Thresholds of The Traced Paths In Microseconds, 0 Never Triggers.
+ * @details Set Above The Usual Duration Measured On The Board, So Only Real Outliers Freeze The Ring.
+ */
+static const uint32_t g_au32TraceSpikeUs[TRACE_ID_COUNT] =
+{
+	[TRACE_ID_UART_ISR] 	= 20UL,
+	[TRACE_ID_RECORDING] 	= 5000UL,
+	[TRACE_ID_TIMESTAMP] 	= 100UL,
+	[TRACE_ID_F_WRITE] 		= 20000UL,
+	[TRACE_ID_SD_WRITE] 	= 20000UL,
+	[TRACE_ID_MSC_CMD] 		= 50000UL,
+	[TRACE_ID_PWRLOSS] 		= 0UL,
+};
+
+/**
+ * @brief 	Spike Thresholds In DWT Cycles.
+ */
+static uint32_t g_au32TraceSpikeCycles[TRACE_ID_COUNT];
+
+/**
+ * @brief 	Cycles of The Last Begin Event of Each Path.
+ */
+static uint32_t g_au32TraceBegin[TRACE_ID_COUNT];
+
+/**
+ * @brief 	Event Ring.
+ */
+static trace_event_t g_axTraceRing[TRACE_RING_EVENTS];
+
+/**
+ * @brief 	Number of Events Written Since The Tracer Was Armed.
+ */
+static uint32_t g_u32TraceHead = 0UL;
+
+/**
+ * @brief 	Events Left To Record Before Freezing, Valid While g_bTraceTriggered.
+ */
+static uint32_t g_u32TracePostEvents = 0UL;
+
+/**
+ * @brief 	Trigger And Freeze State.
+ */
+static volatile bool g_bTraceArmed 		= false;
+static volatile bool g_bTraceTriggered 	= false;
+
+/**
+ * @brief 	Cause of The Trigger, Stored In The Dump Header.
+ */
+static uint32_t g_u32TraceTriggerId 	= 0UL;
+static uint32_t g_u32TraceTriggerCycles = 0UL;
+
+/**
+ * @brief 	Dump File.
+ */
+static FIL g_traceFile;
+#endif /* (true == TRACE_ENABLED) */
+
+/*******************************************************************************
+ * Static Functions
+ ******************************************************************************/
+#if (true == TRACE_ENABLED)
+/**
+ * @brief 	Marks The Trigger, Must Be Called With Interrupts Disabled.
+ *
+ * @param 	u32Id Path Causing The Trigger.
+ * @param 	u32Cycles Duration of The Spike.
+ */
+static void TRACE_SetTrigger(uint32_t u32Id, uint32_t u32Cycles)
+{
+	if (!g_bTraceTriggered)
+	{
+		g_bTraceTriggered 		= true;
+		g_u32TracePostEvents 	= TRACE_POST_TRIGGER_EVENTS;
+		g_u32TraceTriggerId 	= u32Id;
+		g_u32TraceTriggerCycles = u32Cycles;
+	}
+}
+#endif /* (true == TRACE_ENABLED) */
+
+/*******************************************************************************
+ * Functions
+ ******************************************************************************/
+void TRACE_Init(void)
+{
+#if (true == TRACE_ENABLED)
+	uint32_t u32CyclesPerUs = SystemCoreClock / 1000000UL;
+
+	for (uint32_t i = 0UL; i < (uint32_t)TRACE_ID_COUNT; i++)
+	{
+		g_au32TraceSpikeCycles[i] = g_au32TraceSpikeUs[i] * u32CyclesPerUs;
+	}
+	g_u32TraceHead 		= 0UL;
+	g_bTraceTriggered 	= false;
+	g_bTraceArmed 		= true;
+#endif /* (true == TRACE_ENABLED) */
+}
+
+void TRACE_Event(trace_id_t eId, uint8_t u8Type, uint16_t u16Arg)
+{
+#if (true == TRACE_ENABLED)
+	uint32_t u32Mask;
+	uint32_t u32Cycles;
+	uint32_t u32Duration;
+	trace_event_t *pxEvent;
+
+	if (!g_bTraceArmed)
+	{
+		return;
+	}
+
+	u32Mask = DisableGlobalIRQ();
+	u32Cycles = DWT->CYCCNT;
+
+	pxEvent = &g_axTraceRing[g_u32TraceHead & TRACE_RING_MASK];
+	pxEvent->u32Cycles 	= u32Cycles;
+	pxEvent->u8Id 		= (uint8_t)eId;
+	pxEvent->u8Type 	= u8Type;
+	pxEvent->u16Arg 	= u16Arg;
+	g_u32TraceHead++;
+
+	if (TRACE_TYPE_BEGIN == u8Type)
+	{
+		g_au32TraceBegin[eId] = u32Cycles;
+	}
+	else
+	{
+		u32Duration = u32Cycles - g_au32TraceBegin[eId];
+		if ((0UL != g_au32TraceSpikeCycles[eId]) && (u32Duration > g_au32TraceSpikeCycles[eId]))
+		{
+			TRACE_SetTrigger((uint32_t)eId, u32Duration);
+		}
+	}
+
+	/* Freeze The Ring When The Context After The Spike Is Recorded */
+	if (g_bTraceTriggered)
+	{
+		if (0UL == g_u32TracePostEvents)
+		{
+			g_bTraceArmed = false;
+		}
+		else
+		{
+			g_u32TracePostEvents--;
+		}
+	}
+	EnableGlobalIRQ(u32Mask);
+#else
+	(void)eId;
+	(void)u8Type;
+	(void)u16Arg;
+#endif /* (true == TRACE_ENABLED) */
+}
+
+void TRACE_Trigger(trace_id_t eId)
+{
+#if (true == TRACE_ENABLED)
+	uint32_t u32Mask = DisableGlobalIRQ();
+
+	if (g_bTraceArmed)
+	{
+		TRACE_SetTrigger((uint32_t)eId, 0UL);
+	}
+	EnableGlobalIRQ(u32Mask);
+#else
+	(void)eId;
+#endif /* (true == TRACE_ENABLED) */
+}
+
+bool TRACE_IsTriggered(void)
+{
+#if (true == TRACE_ENABLED)
+	return g_bTraceTriggered;
+#else
+	return false;
+#endif /* (true == TRACE_ENABLED) */
+}
+
+error_t TRACE_Dump(void)
+{
+#if (true == TRACE_ENABLED)
+	trace_file_header_t xHeader;
+	uint32_t u32Events;
+	uint32_t u32First;
+	uint32_t u32Chunk;
+	UINT bytesWritten;
+	FRESULT res;
+
+	if (!g_bTraceTriggered)
+	{
+		return ERROR_NONE;
+	}
+
+	/* Stop Recording, The Dump Itself Goes Through f_write And SD_WriteBlocks */
+	g_bTraceArmed = false;
+
+	u32Events = (g_u32TraceHead > TRACE_RING_EVENTS) ? TRACE_RING_EVENTS : g_u32TraceHead;
+	u32First  = (g_u32TraceHead - u32Events) & TRACE_RING_MASK;
+
+	xHeader.u32Magic 			= TRACE_FILE_MAGIC;
+	xHeader.u16Version 			= TRACE_FILE_VERSION;
+	xHeader.u16EventSize 		= (uint16_t)sizeof(trace_event_t);
+	xHeader.u32CoreClockHz 		= SystemCoreClock;
+	xHeader.u32Events 			= u32Events;
+	xHeader.u32TriggerId 		= g_u32TraceTriggerId;
+	xHeader.u32TriggerCycles 	= g_u32TraceTriggerCycles;
+
+	if (FR_OK != f_open(&g_traceFile, TRACE_FILE, (FA_WRITE | FA_CREATE_ALWAYS)))
+	{
+		PRINTF("ERR: Failed to Open %s.\r\n", TRACE_FILE);
+		TRACE_Init();
+		return ERROR_OPEN;
+	}
+
+	res = f_write(&g_traceFile, &xHeader, sizeof(xHeader), &bytesWritten);
+
+	/* The Ring Wraps At Most Once, So The Events Are Written In Two Chunks */
+	u32Chunk = ((u32First + u32Events) > TRACE_RING_EVENTS) ? (TRACE_RING_EVENTS - u32First) : u32Events;
+	if (FR_OK == res)
+	{
+		res = f_write(&g_traceFile, &g_axTraceRing[u32First], u32Chunk * sizeof(trace_event_t), &bytesWritten);
+	}
+	if ((FR_OK == res) && (u32Chunk < u32Events))
+	{
+		res = f_write(&g_traceFile, &g_axTraceRing[0], (u32Events - u32Chunk) * sizeof(trace_event_t),
+					  &bytesWritten);
+	}
+	(void)f_close(&g_traceFile);
+
+#if (true == INFO_ENABLED)
+	PRINTF("INFO: Trace of Spike (Path %u, %u us) Dumped Into %s.\r\n", g_u32TraceTriggerId,
+		   g_u32TraceTriggerCycles / (SystemCoreClock / 1000000UL), TRACE_FILE);
+#endif /* (true == INFO_ENABLED) */
+
+	/* Re-Arm For The Next Spike */
+	TRACE_Init();
+	return (FR_OK == res) ? ERROR_NONE : ERROR_FILESYSTEM;
+#else
+	return ERROR_NONE;
+#endif /* (true == TRACE_ENABLED) */
+}
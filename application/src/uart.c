@@ -69,7 +69,7 @@ void UART_Init(uint32_t baudrate)
     config.enableRx      = true;
 
 #if (true == UART_FIFO_ENABLED)
-    config.rxFifoWatermark = UART_FIFO_LENGHT;
+    config.rxFifoWatermark = PARSER_GetRxWatermark();
 
 #else
 	config.rxFifoWatermark = 0;
@@ -0,0 +1,323 @@
+#
+#   Project:        NXP MCXN947 Datalogger
+#   Author:         Tomas Dolak
+#   File:           load_test.py
+#   Description:    Load Generator With Sequence Numbered, CRC Checked Lines And Verifier of The Recorded Session
+#                   (Lost, Duplicated And Corrupted Lines, Time Marks, Throughput). Certifies The Maximal Lossless
+#                   Baud Rate of a Firmware Build.
+#
+#   Usage:          python load_test.py send COM12 921600 --seconds 60 --length uniform:20:200 --manifest run.json
+#                   python load_test.py make -o load.utr --baud 230400 --lines 5000 --burst 500 --burst-gap-ms 200
+#                   python load_test.py verify --dir E:/20261019_1 --manifest run.json --build v1.4 --report cert.csv
+#                   python load_test.py summary cert.csv
+#
+#   Line:           "SSSSSSSS PAYLOAD CCCCCCCC\r\n", Sequence Number And CRC-32 of "SSSSSSSS PAYLOAD" In Hex.
+#                   The Payload Is Alphanumeric, So a Lost CR/LF or Byte Always Breaks The CRC.
+#
+
+# Libraries
+import argparse
+import csv
+import json
+import os
+import random
+import re
+import string
+import sys
+import time
+import zlib
+
+import uart_trace
+
+# Sequence Number, Two Spaces, CRC And CRLF
+LINE_OVERHEAD = 8 + 1 + 1 + 8 + 2
+MIN_LINE = LINE_OVERHEAD + 1
+MAX_LINE = 4096
+
+PAYLOAD_CHARS = string.ascii_letters + string.digits
+LINE = re.compile(rb"^([0-9A-F]{8}) ([A-Za-z0-9]+) ([0-9A-F]{8})$")
+
+# Throughput Is Only Judged Over a Span The Second Resolution of The Marks Can Measure
+MIN_THROUGHPUT_SPAN = 10
+
+REPORT_FIELDS = ["build", "baud", "lines", "lost", "duplicated", "corrupted", "out_of_order", "marks_ok",
+                 "throughput", "offered", "result"]
+
+
+class LengthDistribution:
+    """ fixed:N, uniform:MIN:MAX, exp:MEAN or choice:A,B,C (Whole Line With CRLF, Clipped To MIN_LINE..MAX_LINE). """
+
+    def __init__(self, spec, rng):
+        self.rng = rng
+        kind, _, params = spec.partition(":")
+        try:
+            if kind == "fixed":
+                value = int(params)
+                self.draw = lambda: value
+            elif kind == "uniform":
+                low, high = (int(x) for x in params.split(":"))
+                self.draw = lambda: rng.randint(low, high)
+            elif kind == "exp":
+                mean = float(params)
+                self.draw = lambda: int(rng.expovariate(1.0 / mean))
+            elif kind == "choice":
+                values = [int(x) for x in params.split(",")]
+                self.draw = lambda: rng.choice(values)
+            else:
+                raise ValueError
+        except ValueError:
+            raise ValueError(f"ERR: Invalid Length Distribution '{spec}'")
+
+    def next(self):
+        return min(MAX_LINE, max(MIN_LINE, self.draw()))
+
+
+def make_line(seq, length, rng):
+    payload = "".join(rng.choice(PAYLOAD_CHARS) for _ in range(length - LINE_OVERHEAD))
+    body = f"{seq & 0xFFFFFFFF:08X} {payload}".encode("ascii")
+    return body + f" {zlib.crc32(body):08X}\r\n".encode("ascii")
+
+
+def generate(args):
+    """ Lines With The Idle Time (ms) Before The Next One. """
+    rng = random.Random(args.seed)
+    lengths = LengthDistribution(args.length, rng)
+    seq = args.start_seq
+    count = 0
+    while args.lines <= 0 or count < args.lines:
+        count += 1
+        if args.burst and count % args.burst == 0:
+            gap = args.burst_gap_ms
+        else:
+            gap = args.line_gap_ms
+        yield make_line(seq, lengths.next(), rng), gap
+        seq += 1
+
+
+def write_manifest(path, args, lines, size, seconds):
+    manifest = {"baud": args.baud, "start_seq": args.start_seq, "lines": lines, "bytes": size,
+                "seconds": round(seconds, 3), "length": args.length, "seed": args.seed}
+    with open(path, "w") as f:
+        json.dump(manifest, f, indent=2)
+    print(f"INFO: Manifest Written Into {path}")
+
+
+def cmd_send(args):
+    import serial
+
+    if args.lines <= 0 and args.seconds <= 0:
+        raise ValueError("ERR: Give --lines or --seconds")
+
+    lines = 0
+    size = 0
+    with serial.Serial(args.port, args.baud, timeout=0) as ser:
+        start = time.perf_counter()
+        try:
+            for line, gap in generate(args):
+                if args.seconds > 0 and time.perf_counter() - start >= args.seconds:
+                    break
+                ser.write(line)
+                lines += 1
+                size += len(line)
+                if gap > 0:
+                    # The Idle Time Starts When The Line Left The Port
+                    ser.flush()
+                    time.sleep(gap / 1000.0)
+        except KeyboardInterrupt:
+            pass
+        ser.flush()
+        seconds = time.perf_counter() - start
+
+    print(f"INFO: {lines} Lines, {size} Bytes Sent In {seconds:.3f} s ({size / seconds:.0f} B/s, "
+          f"Line Rate {args.baud / uart_trace.FRAME_BITS:.0f} B/s)")
+    if args.manifest:
+        write_manifest(args.manifest, args, lines, size, seconds)
+
+
+def cmd_make(args):
+    if args.lines <= 0:
+        raise ValueError("ERR: Give --lines")
+
+    trace = uart_trace.Trace(args.baud)
+    frame = trace.frame_us()
+    at = 0.0
+    size = 0
+    for line, gap in generate(args):
+        uart_trace.add_line(trace, int(at), line)
+        at += len(line) * frame + gap * 1000.0
+        size += len(line)
+    trace.save(args.output)
+
+    print(f"INFO: {args.lines} Lines, {size} Bytes, {at / 1e6:.3f} s Written Into {args.output}")
+    if args.manifest:
+        write_manifest(args.manifest, args, args.lines, size, at / 1e6)
+
+
+def check_marks(marks):
+    """ Marks Never Go Back, Except Over Midnight. Returns (Ok, Span In Seconds). """
+    day = 0
+    previous = None
+    backwards = 0
+    for _, second in marks:
+        if previous is not None and second + day < previous - uart_trace.SECONDS_PER_DAY / 2:
+            day += uart_trace.SECONDS_PER_DAY
+        if previous is not None and second + day < previous:
+            backwards += 1
+            continue
+        previous = second + day
+
+    if not marks:
+        print("INFO: No Time Marks")
+        return True, 0
+    span = previous - marks[0][1]
+    if backwards:
+        print(f"FAIL: Time Marks, {backwards} of {len(marks)} Go Back")
+        return False, span
+    print(f"PASS: Time Marks, {len(marks)} Monotonic Over {span} s")
+    return True, span
+
+
+def cmd_verify(args):
+    files = uart_trace.read_session(args)
+    data, marks, _, _ = uart_trace.strip_session(files, b"", args.file_size)
+    manifest = None
+    if args.manifest:
+        with open(args.manifest, "r") as f:
+            manifest = json.load(f)
+
+    seen = {}
+    corrupted = []
+    out_of_order = 0
+    valid_bytes = 0
+    highest = None
+    for number, line in enumerate(data.split(b"\r\n")):
+        if not line:
+            continue
+        match = LINE.match(line)
+        if not match or int(match.group(3), 16) != zlib.crc32(line[:-9]):
+            corrupted.append((number, line[:32]))
+            continue
+        seq = int(match.group(1), 16)
+        seen[seq] = seen.get(seq, 0) + 1
+        valid_bytes += len(line) + 2
+        if highest is not None and seq < highest:
+            out_of_order += 1
+        highest = seq if highest is None else max(highest, seq)
+
+    if manifest:
+        first, count = manifest["start_seq"], manifest["lines"]
+    elif seen:
+        first, count = min(seen), max(seen) - min(seen) + 1
+    else:
+        first, count = 0, 0
+    lost = [seq for seq in range(first, first + count) if seq not in seen]
+    duplicated = sum(n - 1 for n in seen.values())
+
+    print(f"INFO: {len(seen)} Lines Valid, {valid_bytes} Bytes, Expected {count} From {first:08X}")
+    ok = True
+    for name, items in (("Lost", lost), ("Corrupted", corrupted)):
+        if items:
+            print(f"FAIL: {len(items)} Lines {name}, First: {items[:3]}")
+            ok = False
+    if duplicated:
+        print(f"FAIL: {duplicated} Lines Duplicated")
+        ok = False
+    if out_of_order:
+        print(f"FAIL: {out_of_order} Lines Out of Order")
+        ok = False
+    if ok:
+        print("PASS: No Line Lost, Duplicated or Corrupted")
+
+    marks_ok, span = check_marks(marks)
+    ok = ok and marks_ok
+
+    # Bytes After The First Mark Arrived Within The Span of The Marks
+    throughput = (valid_bytes / span) if span >= MIN_THROUGHPUT_SPAN else 0.0
+    offered = (manifest["bytes"] / manifest["seconds"]) if manifest and manifest["seconds"] > 0 else 0.0
+    if throughput == 0.0:
+        print(f"INFO: Throughput Not Judged, Marks Span Less Than {MIN_THROUGHPUT_SPAN} s")
+    elif offered and throughput < offered * (1.0 - args.tolerance):
+        print(f"FAIL: Throughput {throughput:.0f} B/s, Offered {offered:.0f} B/s")
+        ok = False
+    else:
+        print(f"PASS: Throughput {throughput:.0f} B/s" + (f", Offered {offered:.0f} B/s" if offered else ""))
+
+    baud = args.baud or (manifest["baud"] if manifest else 0)
+    print(f"RESULT: {'PASS' if ok else 'FAIL'} At {baud} Bd")
+    if args.report:
+        new = not os.path.exists(args.report)
+        with open(args.report, "a", newline="") as f:
+            writer = csv.writer(f)
+            if new:
+                writer.writerow(REPORT_FIELDS)
+            writer.writerow([args.build, baud, len(seen), len(lost), duplicated, len(corrupted), out_of_order,
+                             int(marks_ok), f"{throughput:.0f}", f"{offered:.0f}", "PASS" if ok else "FAIL"])
+    sys.exit(0 if ok else 1)
+
+
+def cmd_summary(args):
+    """ Maximal Lossless Baud Rate of Each Build: Every Run At It And Below Passed. """
+    runs = {}
+    with open(args.report, "r", newline="") as f:
+        for row in csv.DictReader(f):
+            runs.setdefault(row["build"], []).append((int(row["baud"]), row["result"] == "PASS"))
+
+    print(f"{'Build':<24}{'Runs':>6}{'Lossless Up To':>16}{'First Failure':>16}")
+    for build, results in runs.items():
+        certified = 0
+        failure = None
+        for baud, passed in sorted(results, key=lambda run: (run[0], run[1])):
+            if not passed:
+                failure = baud
+                break
+            certified = baud
+        print(f"{build:<24}{len(results):>6}{certified:>16}{failure if failure else '-':>16}")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Load Generator And Loss Verifier For The Datalogger.")
+    sub = parser.add_subparsers(dest="command", required=True)
+
+    send = sub.add_parser("send", help="Sends The Load To a Serial Port")
+    send.add_argument("port")
+    send.add_argument("baud", type=int)
+    make = sub.add_parser("make", help="Writes The Load As a Timed Trace (uart_trace.py, Simulator)")
+    make.add_argument("-o", "--output", required=True)
+    make.add_argument("--baud", type=int, default=230400)
+
+    for command in (send, make):
+        command.add_argument("--lines", type=int, default=0, help="Number of Lines, 0 Means Until --seconds")
+        command.add_argument("--seconds", type=float, default=0.0)
+        command.add_argument("--length", default="fixed:64", help="fixed:N, uniform:MIN:MAX, exp:MEAN, choice:A,B")
+        command.add_argument("--line-gap-ms", type=float, default=0.0, help="Idle Time Between Lines")
+        command.add_argument("--burst", type=int, default=0, help="Lines Per Burst, 0 Means No Bursts")
+        command.add_argument("--burst-gap-ms", type=float, default=100.0)
+        command.add_argument("--start-seq", type=int, default=0)
+        command.add_argument("--seed", type=int, default=1)
+        command.add_argument("--manifest", help="JSON With What Was Sent, For verify")
+
+    verify = sub.add_parser("verify", help="Checks The Lines of a Session")
+    source = verify.add_mutually_exclusive_group(required=True)
+    source.add_argument("--dir", help="Session Directory (Card Mounted Over USB)")
+    source.add_argument("--image", help="Card Image (Simulator, Host Benchmark)")
+    verify.add_argument("--session", help="Session Directory In The Image (Default The Latest)")
+    verify.add_argument("--file-size", type=int, default=8192, help="Key 'file_size' of The Config")
+    verify.add_argument("--manifest", help="JSON of send or make, Gives The Expected Lines And The Offered Rate")
+    verify.add_argument("--baud", type=int, default=0, help="Baud Rate of The Run (Default From The Manifest)")
+    verify.add_argument("--tolerance", type=float, default=0.05, help="Allowed Shortfall of The Throughput")
+    verify.add_argument("--build", default="unknown", help="Firmware Build In The Report")
+    verify.add_argument("--report", help="CSV To Which The Result Is Appended")
+
+    summary = sub.add_parser("summary", help="Maximal Lossless Baud Rate Per Build From a Report")
+    summary.add_argument("report")
+
+    args = parser.parse_args()
+    try:
+        {"send": cmd_send, "make": cmd_make, "verify": cmd_verify, "summary": cmd_summary}[args.command](args)
+    except (OSError, ValueError, KeyError) as e:
+        print(e if str(e).startswith("ERR") else f"ERR: {e}")
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
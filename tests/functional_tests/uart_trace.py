@@ -0,0 +1,387 @@
+#
+#   Project:        NXP MCXN947 Datalogger
+#   Author:         Tomas Dolak
+#   File:           uart_trace.py
+#   Description:    Timed UART Traces: Makes, Captures And Replays Them, Then Verifies The Recorded Files Against
+#                   The Trace (Content, Time Marks, Flush Boundaries).
+#
+#   Usage:          python uart_trace.py make -o burst.utr [--lines N] [--line-gap-ms MS] [--burst N --burst-gap-ms MS]
+#                   python uart_trace.py capture COM11 230400 -o field.utr [--seconds S]
+#                   python uart_trace.py replay burst.utr COM11
+#                   python uart_trace.py verify burst.utr --dir E:/20261019_1
+#                   python uart_trace.py verify burst.utr --image sd.img [--session 20261019_1]
+#                   The Simulator (tests/sim) Replays a Trace With The Event "trace FILE".
+#
+#   Format:         "# uart-trace 1" Header, "baud N", Then One Record "T_US HEX" Per Line. The Bytes of a Record
+#                   Start No Earlier Than T_US (From The Start of The Replay) And Follow Back-To-Back At The Baud Rate.
+#
+
+# Libraries
+import argparse
+import os
+import random
+import re
+import sys
+import time
+from array import array
+from bisect import bisect_right
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "..", "tools"))
+import sd_image
+
+TRACE_HEADER = "# uart-trace 1"
+
+# Start, 8 Data Bits, Stop (8N1, The Only Frame The Trace Describes)
+FRAME_BITS = 10
+
+# Record Is Split When Its Bytes Would Not Follow Back-To-Back
+MAX_RECORD_BYTES = 256
+
+LOG_FILE = re.compile(r"^\d{8}_\d{6}_(\d+)\.txt$", re.IGNORECASE)
+SESSION_DIR = re.compile(r"^(\d{8})_(\d+)$")
+TIME_MARK = re.compile(rb"\((\d\d):(\d\d):(\d\d)\) ")
+TIME_MARK_SIZE = 11
+SECONDS_PER_DAY = 86400
+
+
+class Trace:
+    def __init__(self, baud, records=None):
+        self.baud = baud
+        self.records = records if records is not None else []
+
+    def frame_us(self):
+        return FRAME_BITS * 1e6 / self.baud
+
+    def stream(self):
+        return b"".join(data for _, data in self.records)
+
+    def arrivals(self):
+        """ Time (us) At Which The Stop Bit of Each Byte Ends, The Receiver Latches The Byte Then. """
+        frame = self.frame_us()
+        times = array("d")
+        end = 0.0
+        for at, data in self.records:
+            end = max(end, float(at))
+            for _ in data:
+                end += frame
+                times.append(end)
+        return times
+
+    def save(self, path):
+        with open(path, "w") as f:
+            f.write(f"{TRACE_HEADER}\nbaud {self.baud}\n")
+            for at, data in self.records:
+                f.write(f"{at} {data.hex()}\n")
+
+    @staticmethod
+    def load(path):
+        with open(path, "r") as f:
+            lines = f.read().splitlines()
+        if not lines or lines[0] != TRACE_HEADER:
+            raise ValueError(f"ERR: {path} Is Not a UART Trace")
+
+        trace = Trace(230400)
+        for number, line in enumerate(lines[1:], start=2):
+            if not line or line.startswith("#"):
+                continue
+            fields = line.split()
+            try:
+                if fields[0] == "baud":
+                    trace.baud = int(fields[1])
+                else:
+                    trace.records.append((int(fields[0]), bytes.fromhex(fields[1])))
+            except (IndexError, ValueError):
+                raise ValueError(f"ERR: {path} Line {number} Is Invalid")
+        return trace
+
+
+def add_line(trace, at, line):
+    for i in range(0, len(line), MAX_RECORD_BYTES):
+        trace.records.append((at, line[i:i + MAX_RECORD_BYTES]))
+
+
+def cmd_make(args):
+    rng = random.Random(args.seed)
+    if args.source:
+        with open(args.source, "rb") as f:
+            lines = [line.rstrip(b"\r\n") + b"\r\n" for line in f.read().splitlines()]
+    else:
+        lines = [f"Line {i:06d} {'x' * max(0, args.length - 15)}\r\n".encode("ascii") for i in range(args.lines)]
+
+    trace = Trace(args.baud)
+    frame = trace.frame_us()
+    at = 0
+    for i, line in enumerate(lines):
+        add_line(trace, at, line)
+        at += int(len(line) * frame)
+        if args.burst and (i + 1) % args.burst == 0:
+            at += int(args.burst_gap_ms * 1000)
+        else:
+            at += int((args.line_gap_ms + rng.uniform(0.0, args.jitter_ms)) * 1000)
+
+    trace.save(args.output)
+    print(f"INFO: {len(lines)} Lines, {len(trace.stream())} Bytes, {at / 1e6:.3f} s Written Into {args.output}")
+
+
+def cmd_capture(args):
+    import serial
+
+    trace = Trace(args.baud)
+    frame = trace.frame_us()
+    with serial.Serial(args.port, args.baud, timeout=0.001) as ser:
+        print(f"INFO: Capturing {args.port} At {args.baud} Bd, Ctrl+C Stops")
+        start = time.perf_counter()
+        try:
+            while args.seconds <= 0 or time.perf_counter() - start < args.seconds:
+                data = ser.read(MAX_RECORD_BYTES)
+                if data:
+                    # The Read Returns After The Last Byte, The First One Started len * frame Before
+                    now = (time.perf_counter() - start) * 1e6
+                    trace.records.append((max(0, int(now - len(data) * frame)), data))
+        except KeyboardInterrupt:
+            pass
+    trace.save(args.output)
+    print(f"INFO: {len(trace.stream())} Bytes Written Into {args.output}")
+
+
+def cmd_replay(args):
+    import serial
+
+    trace = Trace.load(args.trace)
+    with serial.Serial(args.port, trace.baud, timeout=0) as ser:
+        start = time.perf_counter()
+        print(f"INFO: Replay of {args.trace} Started At {time.strftime('%H:%M:%S')} (Host Clock)")
+        for at, data in trace.records:
+            delay = start + at / 1e6 - time.perf_counter()
+            if delay > 0:
+                time.sleep(delay)
+            ser.write(data)
+        ser.flush()
+    print(f"INFO: {len(trace.stream())} Bytes Replayed In {time.perf_counter() - start:.3f} s")
+
+
+def read_session(args):
+    """ Log Files of The Session In The Order They Were Written: (Name, Content). """
+    if args.image:
+        image = sd_image.FatImage(args.image)
+        session = args.session
+        if not session:
+            dirs = [name for name, is_dir, _, _ in image.listdir("/") if is_dir and SESSION_DIR.match(name)]
+            if not dirs:
+                raise ValueError(f"ERR: {args.image} Has No Session Directory")
+            session = max(dirs, key=lambda name: tuple(int(x) for x in SESSION_DIR.match(name).groups()))
+        names = [name for name, is_dir, _, _ in image.listdir(session) if not is_dir and LOG_FILE.match(name)]
+        read = lambda name: image.read(f"{session}/{name}")
+    else:
+        session = args.dir
+        names = [name for name in os.listdir(session) if LOG_FILE.match(name)]
+        read = lambda name: open(os.path.join(session, name), "rb").read()
+
+    names.sort(key=lambda name: int(LOG_FILE.match(name).group(1)))
+    print(f"INFO: Session {session}, {len(names)} Log Files")
+    return [(name, read(name)) for name in names]
+
+
+def strip_session(files, trace_stream, file_size):
+    """
+    Joins The Files Without The Flush Padding And Without The Time Marks. Returns The Data, The Time Marks
+    (Position of The LF, Seconds), The Flushes (Position, File, Offset In File) And The Offset In Its File of
+    Any Position. A File Which Reached file_size Was Closed By The Limit, Its Trailing Spaces Are Data.
+    """
+    marked = bytearray()
+    ends = []
+    starts = []
+    for name, content in files:
+        start = len(marked)
+        starts.append(start)
+        data = content.rstrip(b" ") if len(content) < file_size else content
+        padded = len(data) != len(content)
+        # The Mark After The Last CRLF Ends With a Space Too
+        if padded and re.search(rb"\r\n\(\d\d:\d\d:\d\d\)$", data):
+            data += b" "
+        marked += data
+        ends.append((len(marked), padded, name, len(marked) - start))
+
+    out = bytearray()
+    marks = []
+    flushes = []
+    checkpoints = [(0, 0)]
+    pos = 0
+    ends_iter = iter(ends)
+    end = next(ends_iter, None)
+    while True:
+        # Flush Boundaries Between The Marked Data Are Mapped To The Data Without Marks
+        while end is not None and end[0] <= pos:
+            if end[1]:
+                # Trailing Spaces Before a Flush Can Not Be Told From The Padding, They Are Taken From The Trace
+                at = len(out)
+                spaces = len(trace_stream[at:]) - len(trace_stream[at:].lstrip(b" "))
+                out += b" " * spaces
+                flushes.append((len(out), end[2], end[3]))
+                checkpoints.append((len(out), end[0]))
+            end = next(ends_iter, None)
+        if pos >= len(marked):
+            break
+
+        lf = marked.find(b"\n", pos)
+        stop = len(marked) if lf < 0 else lf + 1
+        if end is not None and end[0] < stop:
+            stop = end[0]
+        out += marked[pos:stop]
+        pos = stop
+        if out.endswith(b"\r\n") and pos == lf + 1:
+            match = TIME_MARK.match(marked, pos)
+            if match:
+                h, m, s = (int(x) for x in match.groups())
+                marks.append((len(out) - 1, h * 3600 + m * 60 + s))
+                pos += TIME_MARK_SIZE
+                checkpoints.append((len(out), pos))
+
+    def file_offset(at):
+        raw, mark = checkpoints[bisect_right(checkpoints, (at, len(marked))) - 1]
+        mark += at - raw
+        return mark - starts[max(0, bisect_right(starts, mark) - 1)]
+
+    return bytes(out), marks, flushes, file_offset
+
+
+def check_content(data, stream, trace):
+    if data == stream:
+        print(f"PASS: Content, {len(data)} Bytes Equal")
+        return True
+
+    first = next((i for i in range(min(len(data), len(stream))) if data[i] != stream[i]), min(len(data), len(stream)))
+    at = trace.arrivals()[min(first, len(stream) - 1)] / 1e6 if stream else 0.0
+    print(f"FAIL: Content, {len(data)} Bytes Recorded, {len(stream)} Sent, First Difference At Byte {first} "
+          f"(Sent At {at:.3f} s)")
+    print(f"      Sent:     {stream[max(0, first - 16):first + 32]!r}")
+    print(f"      Recorded: {data[max(0, first - 16):first + 32]!r}")
+    return False
+
+
+def check_marks(marks, arrivals, error_ms):
+    """ Each Mark Is The RTC Second When The LF Was Processed: s <= t + offset + delay < s + 1, 0 <= delay <= E. """
+    if not marks:
+        print("INFO: No Time Marks")
+        return True
+
+    error = error_ms / 1000.0
+    low, high = -float("inf"), float("inf")
+    day = 0
+    previous = None
+    for pos, second in marks:
+        if previous is not None and second + day < previous - SECONDS_PER_DAY / 2:
+            day += SECONDS_PER_DAY
+        second += day
+        previous = second
+        t = arrivals[pos] / 1e6
+        low, high = max(low, second - t - error), min(high, second + 1 - t)
+
+    if low >= high:
+        print(f"FAIL: Time Marks, No RTC Offset Explains All {len(marks)} Marks Within {error_ms} ms")
+        return False
+    print(f"PASS: Time Marks, {len(marks)} Marks Within {error_ms} ms (RTC Offset {low:.3f} .. {high:.3f} s)")
+    return True
+
+
+def check_flushes(flushes, file_offset, trace, stream, args):
+    """ Idle Gaps Above The Timeout Must End a File With Padding, Shorter Gaps Must Not. """
+    arrivals = trace.arrivals()
+    timeout = args.flush_timeout_ms * 1000.0
+    slack = args.slack_ms * 1000.0
+
+    gaps = {}
+    for pos in range(1, len(stream) + 1):
+        if pos == len(stream):
+            gaps[pos] = float("inf")
+        elif arrivals[pos] - arrivals[pos - 1] > timeout - slack:
+            gaps[pos] = arrivals[pos] - arrivals[pos - 1]
+
+    ok = True
+    flushed = {pos: (name, offset) for pos, name, offset in flushes}
+    for pos, (name, offset) in sorted(flushed.items()):
+        gap = gaps.get(pos)
+        if gap is None:
+            print(f"FAIL: Flush, {name} Ends At Byte {pos} Before The Idle Timeout")
+            ok = False
+
+    for pos, gap in sorted(gaps.items()):
+        if pos == len(stream) and args.open_end:
+            continue
+        if gap > timeout + slack and pos not in flushed:
+            # Data Ending On a Block Boundary Has Nothing To Pad, The Block Was Already Written
+            if file_offset(pos) % args.block_size == 0:
+                continue
+            print(f"FAIL: Flush, Idle Gap of {gap / 1e6:.3f} s After Byte {pos} Did Not End a File")
+            ok = False
+
+    if ok:
+        print(f"PASS: Flush, {len(flushed)} Padded File Ends, {len(gaps)} Idle Gaps "
+              f"(Timeout {args.flush_timeout_ms} ms +- {args.slack_ms} ms)")
+    return ok
+
+
+def cmd_verify(args):
+    trace = Trace.load(args.trace)
+    stream = trace.stream()
+    data, marks, flushes, file_offset = strip_session(read_session(args), stream, args.file_size)
+
+    ok = check_content(data, stream, trace)
+    if ok:
+        arrivals = trace.arrivals()
+        ok = check_marks(marks, arrivals, args.stamp_error_ms) and ok
+        ok = check_flushes(flushes, file_offset, trace, stream, args) and ok
+    else:
+        print("INFO: Time Marks And Flushes Not Checked, The Content Differs")
+    sys.exit(0 if ok else 1)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Timed UART Traces For The Datalogger.")
+    sub = parser.add_subparsers(dest="command", required=True)
+
+    make = sub.add_parser("make", help="Makes a Trace of Generated Lines or of The Lines of a Text File")
+    make.add_argument("-o", "--output", required=True)
+    make.add_argument("--source", help="Text File Whose Lines Are Sent (Default Generated Lines)")
+    make.add_argument("--baud", type=int, default=230400)
+    make.add_argument("--lines", type=int, default=1000)
+    make.add_argument("--length", type=int, default=64, help="Length of a Generated Line Without CRLF")
+    make.add_argument("--line-gap-ms", type=float, default=1.0)
+    make.add_argument("--jitter-ms", type=float, default=0.0, help="Random Extra Gap, Uniform From 0")
+    make.add_argument("--burst", type=int, default=0, help="Lines Per Burst, 0 Means No Bursts")
+    make.add_argument("--burst-gap-ms", type=float, default=4000.0)
+    make.add_argument("--seed", type=int, default=1)
+
+    capture = sub.add_parser("capture", help="Records The Bytes of a Serial Port With Their Arrival Times")
+    capture.add_argument("port")
+    capture.add_argument("baud", type=int)
+    capture.add_argument("-o", "--output", required=True)
+    capture.add_argument("--seconds", type=float, default=0.0, help="Length, 0 Until Ctrl+C")
+
+    replay = sub.add_parser("replay", help="Sends a Trace To a Serial Port With Its Timing")
+    replay.add_argument("trace")
+    replay.add_argument("port")
+
+    verify = sub.add_parser("verify", help="Checks The Log Files of a Session Against The Trace")
+    verify.add_argument("trace")
+    source = verify.add_mutually_exclusive_group(required=True)
+    source.add_argument("--dir", help="Session Directory (Card Mounted Over USB)")
+    source.add_argument("--image", help="Card Image (Simulator, Host Benchmark)")
+    verify.add_argument("--session", help="Session Directory In The Image (Default The Latest)")
+    verify.add_argument("--flush-timeout-ms", type=int, default=3000, help="Key 'flush_timeout_ms' of The Config")
+    verify.add_argument("--slack-ms", type=int, default=100, help="Tolerance of The Flush Timeout")
+    verify.add_argument("--block-size", type=int, default=512, help="Key 'block_size' of The Config")
+    verify.add_argument("--file-size", type=int, default=8192, help="Key 'file_size' of The Config")
+    verify.add_argument("--stamp-error-ms", type=int, default=250, help="Allowed Delay of a Time Mark")
+    verify.add_argument("--open-end", action="store_true", help="The Run Ended Before The Last Flush")
+
+    args = parser.parse_args()
+    try:
+        {"make": cmd_make, "capture": cmd_capture, "replay": cmd_replay, "verify": cmd_verify}[args.command](args)
+    except (OSError, ValueError) as e:
+        print(e if str(e).startswith("ERR") else f"ERR: {e}")
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
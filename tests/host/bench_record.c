@@ -0,0 +1,640 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      bench_record.c
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Host Benchmark of The Recording Core: Sweeps The Baud Rate And Reports The Maximal Lossless One.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           bench_record.c
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Host Benchmark of The Recording Core: Sweeps The Baud Rate And Reports The Maximal Lossless One.
+ * ****************************/
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ff.h"
+#include "parser.h"
+#include "record.h"
+
+#include "host.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/**
+ * @brief 	Default Length of a Generated Line (CRLF Included) And Its Bounds.
+ * @details A Line Is 'S' + 8 Hex Digits of The Sequence Number + ':' + Filler + CRLF.
+ */
+#define BENCH_DEFAULT_LINE			64U
+#define BENCH_LINE_OVERHEAD			12U
+#define BENCH_MIN_LINE				16U
+#define BENCH_MAX_LINE				256U
+
+/**
+ * @brief 	Default Time Data Are Sent Per Baud Rate In Seconds.
+ */
+#define BENCH_DEFAULT_SECONDS		2U
+
+/**
+ * @brief 	Period of The Feeder, Bytes Due In The Period Are Put On The Line Together.
+ */
+#define BENCH_FEED_PERIOD_US		200ULL
+
+/**
+ * @brief 	Maximal Lag of The Feeder Behind Its Schedule, Caught Up At Once.
+ * @details A Late Wake-Up of The Host Thread Would Otherwise Put a Burst Faster Than The Baud Rate On The Line,
+ * 			The Schedule Is Shifted Instead And The Offered Rate Is Measured.
+ */
+#define BENCH_MAX_LAG_US			1000ULL
+
+/**
+ * @brief 	Maximal Number of Session Directories And Log Files Scanned.
+ */
+#define BENCH_MAX_DIRS				16U
+#define BENCH_MAX_FILES				256U
+
+/**
+ * @brief 	Size of The Chunk Read From a Log File.
+ */
+#define BENCH_CHUNK_SIZE			4096U
+
+/**
+ * @brief 	Result of One Run.
+ */
+typedef struct
+{
+	uint32_t u32Baudrate;
+	uint32_t u32Lines;				/*<! Lines Sent									*/
+	uint32_t u32Good;				/*<! Lines Found Intact (Each Counted Once)		*/
+	uint32_t u32Lost;				/*<! Lines Not Found							*/
+	uint32_t u32Duplicate;			/*<! Lines Found More Than Once					*/
+	uint32_t u32Malformed;			/*<! Lines Which Do Not Match The Generator		*/
+	uint32_t u32Reordered;			/*<! Lines Found Before an Older Line			*/
+	uint32_t u32DroppedBlocks;		/*<! Full Blocks Overwritten In The Recorder	*/
+	uint32_t u32FifoFull;			/*<! Bytes Dropped By The ISR, FIFO Full		*/
+	double dOfferedBps;				/*<! Payload Bytes Per Second Put On The Line	*/
+	double dRecordedBps;			/*<! Intact Payload Bytes Per Second			*/
+	host_uart_stats_t xUart;
+	host_disk_stats_t xDisk;
+	uint64_t u64ElapsedUs;
+} bench_result_t;
+
+/**
+ * @brief 	State of The Log Scanner.
+ */
+typedef struct
+{
+	uint32_t u32LineLength;
+	uint32_t u32Lines;
+	uint8_t *pu8Seen;				/*<! Number of Times Each Line Was Found (Saturated)	*/
+	char acLine[BENCH_MAX_LINE * 2U];
+	uint32_t u32Length;
+	bool bOverflow;
+	int64_t i64LastSeq;
+	bench_result_t *pxResult;
+} bench_scan_t;
+
+/*******************************************************************************
+ * Global Variables
+ ******************************************************************************/
+/**
+ * @brief 	Swept Baud Rates.
+ */
+static const uint32_t g_au32Sweep[] =
+{
+	115200UL, 230400UL, 460800UL, 921600UL, 1500000UL, 3000000UL, 6000000UL
+};
+
+/**
+ * @brief 	Options.
+ */
+static uint32_t g_u32LineLength 	= BENCH_DEFAULT_LINE;
+static uint32_t g_u32Seconds 		= BENCH_DEFAULT_SECONDS;
+static uint32_t g_u32DiskSectors 	= HOST_DISK_DEFAULT_SECTORS;
+static const char *g_pcExtraConfig 	= "";
+static const char *g_pcImage 		= NULL;
+
+/*******************************************************************************
+ * Generator
+ ******************************************************************************/
+/**
+ * @brief 	Filler Character of a Line, Space-Free (The Recorder Pads Blocks With Spaces).
+ */
+static char BENCH_Filler(uint32_t u32Seq, uint32_t u32Index)
+{
+	return (char)('a' + ((u32Seq + u32Index) % 26U));
+}
+
+static void BENCH_MakeLine(uint32_t u32Seq, char *pcLine)
+{
+	uint32_t u32Filler = g_u32LineLength - BENCH_LINE_OVERHEAD;
+
+	(void)snprintf(pcLine, 11U, "S%08X:", u32Seq);
+	for (uint32_t i = 0UL; i < u32Filler; i++)
+	{
+		pcLine[10U + i] = BENCH_Filler(u32Seq, i);
+	}
+	pcLine[10U + u32Filler] = '\r';
+	pcLine[11U + u32Filler] = '\n';
+}
+
+/**
+ * @brief 	Number of Bits of One Frame On The Line With The Applied Configuration.
+ */
+static uint32_t BENCH_FrameBits(void)
+{
+	uint32_t u32Bits = 1UL;		/* Start Bit */
+
+	u32Bits += (kLPUART_SevenDataBits == PARSER_GetDataBits()) ? 7UL : 8UL;
+	u32Bits += (kLPUART_ParityDisabled == PARSER_GetParity()) ? 0UL : 1UL;
+	u32Bits += (kLPUART_TwoStopBit == PARSER_GetStopBits()) ? 2UL : 1UL;
+	return u32Bits;
+}
+
+/**
+ * @brief 	Sends The Lines At The Byte Rate of The Baud Rate.
+ *
+ * @return 	Time The Sending Took In Microseconds (Longer Than The Nominal One If The Schedule Was Shifted).
+ */
+static uint64_t BENCH_Feed(uint32_t u32Lines, uint32_t u32BytesPerSecond)
+{
+	char acLine[BENCH_MAX_LINE];
+	uint64_t u64Total = (uint64_t)u32Lines * g_u32LineLength;
+	uint64_t u64Sent = 0ULL;
+	uint64_t u64Begin = HOST_NowUs();
+	uint64_t u64Start = u64Begin;
+	uint64_t u64Now;
+
+	while (u64Sent < u64Total)
+	{
+		uint64_t u64Due;
+
+		u64Now = HOST_NowUs();
+		if ((u64Now - u64Start) > (((u64Sent * 1000000ULL) / u32BytesPerSecond) + BENCH_MAX_LAG_US))
+		{
+			u64Start = u64Now - ((u64Sent * 1000000ULL) / u32BytesPerSecond) - BENCH_MAX_LAG_US;
+		}
+		u64Due = ((u64Now - u64Start) * u32BytesPerSecond) / 1000000ULL;
+
+		while ((u64Sent < u64Due) && (u64Sent < u64Total))
+		{
+			uint32_t u32Offset = (uint32_t)(u64Sent % g_u32LineLength);
+
+			if (0UL == u32Offset)
+			{
+				BENCH_MakeLine((uint32_t)(u64Sent / g_u32LineLength), acLine);
+			}
+			HOST_UartInject((uint8_t)acLine[u32Offset]);
+			u64Sent++;
+		}
+		HOST_SleepUs(BENCH_FEED_PERIOD_US);
+	}
+	return HOST_NowUs() - u64Begin;
+}
+
+/*******************************************************************************
+ * Scanner
+ ******************************************************************************/
+/**
+ * @brief 	Checks One Line of The Log (Padding Spaces Removed, CRLF Stripped).
+ */
+static void BENCH_CheckLine(bench_scan_t *pxScan, char *pcLine, uint32_t u32Length)
+{
+	uint32_t u32Filler = pxScan->u32LineLength - BENCH_LINE_OVERHEAD;
+	unsigned int uSeq;
+	char cColon;
+
+	/* Timestamp "(hh:mm:ss)" Inserted After Each CRLF */
+	if ((u32Length >= 10U) && ('(' == pcLine[0]) && (')' == pcLine[9]))
+	{
+		pcLine += 10;
+		u32Length -= 10U;
+	}
+	if (0UL == u32Length)
+	{
+		return;
+	}
+
+	if ((u32Length != (10U + u32Filler)) || ('S' != pcLine[0]) ||
+		(2 != sscanf(&pcLine[1], "%8X%c", &uSeq, &cColon)) || (':' != cColon) || (uSeq >= pxScan->u32Lines))
+	{
+		pxScan->pxResult->u32Malformed++;
+		return;
+	}
+	for (uint32_t i = 0UL; i < u32Filler; i++)
+	{
+		if (BENCH_Filler(uSeq, i) != pcLine[10U + i])
+		{
+			pxScan->pxResult->u32Malformed++;
+			return;
+		}
+	}
+
+	if (0U == pxScan->pu8Seen[uSeq])
+	{
+		pxScan->pxResult->u32Good++;
+	}
+	else
+	{
+		pxScan->pxResult->u32Duplicate++;
+	}
+	if (pxScan->pu8Seen[uSeq] < UINT8_MAX)
+	{
+		pxScan->pu8Seen[uSeq]++;
+	}
+	if ((int64_t)uSeq < pxScan->i64LastSeq)
+	{
+		pxScan->pxResult->u32Reordered++;
+	}
+	pxScan->i64LastSeq = (int64_t)uSeq;
+}
+
+static void BENCH_ScanBytes(bench_scan_t *pxScan, const char *pcData, uint32_t u32Length)
+{
+	for (uint32_t i = 0UL; i < u32Length; i++)
+	{
+		char c = pcData[i];
+
+		if (' ' == c)
+		{
+			continue;
+		}
+		if ('\n' == c)
+		{
+			if (pxScan->bOverflow)
+			{
+				pxScan->pxResult->u32Malformed++;
+			}
+			else
+			{
+				if ((pxScan->u32Length > 0U) && ('\r' == pxScan->acLine[pxScan->u32Length - 1U]))
+				{
+					pxScan->u32Length--;
+				}
+				BENCH_CheckLine(pxScan, pxScan->acLine, pxScan->u32Length);
+			}
+			pxScan->u32Length = 0UL;
+			pxScan->bOverflow = false;
+		}
+		else if (pxScan->u32Length < sizeof(pxScan->acLine))
+		{
+			pxScan->acLine[pxScan->u32Length++] = c;
+		}
+		else
+		{
+			pxScan->bOverflow = true;
+		}
+	}
+}
+
+/**
+ * @brief 	Sort Keys: Directory "/YYYYMMDD_N" And Log File "YYYYMMDD_HHMMSS_N.txt".
+ */
+typedef struct
+{
+	char acName[FF_MAX_LFN + 1];
+	uint32_t u32Key1;
+	uint32_t u32Key2;
+} bench_entry_t;
+
+static int BENCH_CompareEntries(const void *pvA, const void *pvB)
+{
+	const bench_entry_t *pxA = (const bench_entry_t *)pvA;
+	const bench_entry_t *pxB = (const bench_entry_t *)pvB;
+
+	if (pxA->u32Key1 != pxB->u32Key1)
+	{
+		return (pxA->u32Key1 < pxB->u32Key1) ? -1 : 1;
+	}
+	return (pxA->u32Key2 < pxB->u32Key2) ? -1 : ((pxA->u32Key2 > pxB->u32Key2) ? 1 : 0);
+}
+
+/**
+ * @brief 	Lists The Entries of a Directory Matching The Pattern, Sorted By Their Counters.
+ */
+static uint32_t BENCH_List(const char *pcPath, bool bDirs, bench_entry_t *pxEntries, uint32_t u32Max)
+{
+	DIR dir;
+	FILINFO info;
+	uint32_t u32Count = 0UL;
+
+	if (FR_OK != f_opendir(&dir, pcPath))
+	{
+		return 0UL;
+	}
+	while ((FR_OK == f_readdir(&dir, &info)) && ('\0' != info.fname[0]) && (u32Count < u32Max))
+	{
+		bench_entry_t *pxEntry = &pxEntries[u32Count];
+		unsigned int uKey1;
+		unsigned int uKey2;
+		char acTime[8];
+
+		if (bDirs != (0U != (info.fattrib & AM_DIR)))
+		{
+			continue;
+		}
+		if (bDirs ? (2 != sscanf(info.fname, "%8u_%u", &uKey1, &uKey2)) :
+					(3 != sscanf(info.fname, "%8u_%6[0-9]_%u.txt", &uKey1, acTime, &uKey2)))
+		{
+			continue;
+		}
+		/* Files of a Session Are Ordered By Their Counter Only */
+		pxEntry->u32Key1 = bDirs ? uKey1 : 0UL;
+		pxEntry->u32Key2 = uKey2;
+		(void)snprintf(pxEntry->acName, sizeof(pxEntry->acName), "%s", info.fname);
+		u32Count++;
+	}
+	(void)f_closedir(&dir);
+	qsort(pxEntries, u32Count, sizeof(bench_entry_t), BENCH_CompareEntries);
+	return u32Count;
+}
+
+/**
+ * @brief 	Mounts The Disk And Checks All Logs Against The Generated Lines.
+ */
+static error_t BENCH_Scan(bench_result_t *pxResult)
+{
+	static bench_entry_t axDirs[BENCH_MAX_DIRS];
+	static bench_entry_t axFiles[BENCH_MAX_FILES];
+	static char acChunk[BENCH_CHUNK_SIZE];
+	static FATFS xFs;
+	static bench_scan_t xScan;
+	char acPath[2U * (FF_MAX_LFN + 2)];
+	uint32_t u32Dirs;
+	FIL file;
+	UINT bytesRead;
+
+	(void)memset(&xScan, 0, sizeof(xScan));
+	xScan.u32LineLength = g_u32LineLength;
+	xScan.u32Lines = pxResult->u32Lines;
+	xScan.i64LastSeq = -1;
+	xScan.pxResult = pxResult;
+	xScan.pu8Seen = (uint8_t *)calloc(pxResult->u32Lines + 1U, sizeof(uint8_t));
+	if ((NULL == xScan.pu8Seen) || (FR_OK != f_mount(&xFs, "2:/", 1U)) || (FR_OK != f_chdrive("2:")))
+	{
+		free(xScan.pu8Seen);
+		return ERROR_FILESYSTEM;
+	}
+
+	u32Dirs = BENCH_List("/", true, axDirs, BENCH_MAX_DIRS);
+	for (uint32_t d = 0UL; d < u32Dirs; d++)
+	{
+		uint32_t u32Files;
+
+		(void)snprintf(acPath, sizeof(acPath), "/%s", axDirs[d].acName);
+		u32Files = BENCH_List(acPath, false, axFiles, BENCH_MAX_FILES);
+		for (uint32_t f = 0UL; f < u32Files; f++)
+		{
+			(void)snprintf(acPath, sizeof(acPath), "/%s/%s", axDirs[d].acName, axFiles[f].acName);
+			if (FR_OK != f_open(&file, acPath, FA_READ))
+			{
+				continue;
+			}
+			while ((FR_OK == f_read(&file, acChunk, sizeof(acChunk), &bytesRead)) && (0U != bytesRead))
+			{
+				BENCH_ScanBytes(&xScan, acChunk, (uint32_t)bytesRead);
+			}
+			(void)f_close(&file);
+		}
+	}
+	/* Only The Timestamp Inserted After The Last CRLF May Follow It */
+	if (0UL != xScan.u32Length)
+	{
+		BENCH_CheckLine(&xScan, xScan.acLine, xScan.u32Length);
+	}
+
+	pxResult->u32Lost = pxResult->u32Lines - pxResult->u32Good;
+	free(xScan.pu8Seen);
+	(void)f_mount(NULL, "2:/", 0U);
+	return ERROR_NONE;
+}
+
+/*******************************************************************************
+ * Benchmark
+ ******************************************************************************/
+static error_t BENCH_Run(uint32_t u32Baudrate, bench_result_t *pxResult)
+{
+	char acConfig[512];
+	uint32_t u32BytesPerSecond;
+	uint64_t u64Start;
+	uint64_t u64FeedUs;
+	error_t retVal;
+
+	(void)memset(pxResult, 0, sizeof(bench_result_t));
+	pxResult->u32Baudrate = u32Baudrate;
+
+	(void)snprintf(acConfig, sizeof(acConfig), "baudrate=%u\r\n%s", u32Baudrate, g_pcExtraConfig);
+	if ((ERROR_NONE != HOST_DiskCreate(g_u32DiskSectors)) || (ERROR_NONE != HOST_SessionStart(acConfig)))
+	{
+		return ERROR_RECORD;
+	}
+	if (u32Baudrate != PARSER_GetBaudrate())
+	{
+		fprintf(stderr, "ERR: Baud Rate %u Rejected By The Parser.\n", u32Baudrate);
+		(void)HOST_SessionStop();
+		return ERROR_CONFIG;
+	}
+
+	/* Mount And Format Are Not Part of The Measurement */
+	HOST_DiskStats(&pxResult->xDisk);
+	HOST_UartStats(&pxResult->xUart);
+
+	u32BytesPerSecond = u32Baudrate / BENCH_FrameBits();
+	pxResult->u32Lines = (u32BytesPerSecond * g_u32Seconds) / g_u32LineLength;
+
+	u64Start = HOST_NowUs();
+	u64FeedUs = BENCH_Feed(pxResult->u32Lines, u32BytesPerSecond);
+	retVal = HOST_SessionStop();
+	pxResult->u64ElapsedUs = HOST_NowUs() - u64Start;
+	pxResult->u32DroppedBlocks = CONSOLELOG_GetDroppedBlocks();
+	pxResult->u32FifoFull = CONSOLELOG_GetFifoFullBytes();
+
+	HOST_DiskStats(&pxResult->xDisk);
+	HOST_UartStats(&pxResult->xUart);
+	if (ERROR_NONE != retVal)
+	{
+		fprintf(stderr, "ERR: Session Stop Failed (%u).\n", retVal);
+		return retVal;
+	}
+
+	retVal = BENCH_Scan(pxResult);
+	pxResult->dOfferedBps = ((double)pxResult->u32Lines * g_u32LineLength * 1e6) / (double)u64FeedUs;
+	pxResult->dRecordedBps = ((double)pxResult->u32Good * g_u32LineLength * 1e6) / (double)pxResult->u64ElapsedUs;
+	return retVal;
+}
+
+static bool BENCH_IsLossless(const bench_result_t *pxResult)
+{
+	return (0UL == pxResult->u32Lost) && (0UL == pxResult->u32Duplicate) && (0UL == pxResult->u32Malformed) &&
+		   (0UL == pxResult->u32Reordered) && (0ULL == pxResult->xUart.u64Overruns) &&
+		   (0UL == pxResult->u32DroppedBlocks) && (0UL == pxResult->u32FifoFull);
+}
+
+static void BENCH_Usage(void)
+{
+	printf("Usage: bench_record [options]\n"
+		   "  --baud N          Run Only This Baud Rate (Default: Sweep Up To %u)\n"
+		   "  --seconds N       Time Data Are Sent Per Baud Rate (Default %u)\n"
+		   "  --line N          Length of a Line, CRLF Included (%u..%u, Default %u)\n"
+		   "  --config FILE     Keys Appended To The Configuration (e.g. fifo_size, block_size)\n"
+		   "  --disk-mb N       Size of The RAM Disk (Default %lu)\n"
+		   "  --cmd-us N        Card Latency Per Command (Default %lu)\n"
+		   "  --sector-us N     Card Latency Per Sector (Default %lu)\n"
+		   "  --image FILE      Save The Disk of The Last Run\n"
+		   "  --require N       Fail If The Maximal Lossless Baud Rate Is Below N or Data Are Dropped Up To N\n"
+		   "  -v                Print INFO Lines of The Firmware\n",
+		   g_au32Sweep[(sizeof(g_au32Sweep) / sizeof(g_au32Sweep[0])) - 1U], BENCH_DEFAULT_SECONDS, BENCH_MIN_LINE, BENCH_MAX_LINE, BENCH_DEFAULT_LINE,
+		   (HOST_DISK_DEFAULT_SECTORS * HOST_DISK_SECTOR_SIZE) >> 20U, HOST_DISK_DEFAULT_CMD_US,
+		   HOST_DISK_DEFAULT_SECTOR_US);
+}
+
+/**
+ * @brief 	Reads The Whole File Into a NUL-Terminated Buffer.
+ */
+static char *BENCH_ReadFile(const char *pcPath)
+{
+	FILE *pxFile = fopen(pcPath, "rb");
+	char *pcContent = NULL;
+	long lSize;
+
+	if (NULL == pxFile)
+	{
+		return NULL;
+	}
+	if ((0 == fseek(pxFile, 0L, SEEK_END)) && (0L <= (lSize = ftell(pxFile))) && (0 == fseek(pxFile, 0L, SEEK_SET)) &&
+		(NULL != (pcContent = (char *)calloc((size_t)lSize + 1U, 1U))))
+	{
+		(void)fread(pcContent, 1U, (size_t)lSize, pxFile);
+	}
+	(void)fclose(pxFile);
+	return pcContent;
+}
+
+int main(int argc, char *argv[])
+{
+	uint32_t u32Baudrate = 0UL;
+	uint32_t u32Require = 0UL;
+	uint32_t u32CmdUs = HOST_DISK_DEFAULT_CMD_US;
+	uint32_t u32SectorUs = HOST_DISK_DEFAULT_SECTOR_US;
+	uint32_t u32MaxLossless = 0UL;
+	bool bAllLossless = true;
+	bool bDropped = false;
+	bench_result_t xResult;
+
+	(void)HOST_NowUs();
+
+	for (int i = 1; i < argc; i++)
+	{
+		const char *pcValue = ((i + 1) < argc) ? argv[i + 1] : NULL;
+		uint32_t u32Value = (NULL != pcValue) ? (uint32_t)strtoul(pcValue, NULL, 10) : 0UL;
+
+		if (0 == strcmp(argv[i], "-v"))
+		{
+			g_bHostVerbose = true;
+			continue;
+		}
+		if (NULL == pcValue)
+		{
+			BENCH_Usage();
+			return 2;
+		}
+		if (0 == strcmp(argv[i], "--baud"))				{ u32Baudrate = u32Value; }
+		else if (0 == strcmp(argv[i], "--seconds"))		{ g_u32Seconds = u32Value; }
+		else if (0 == strcmp(argv[i], "--line"))		{ g_u32LineLength = u32Value; }
+		else if (0 == strcmp(argv[i], "--disk-mb"))		{ g_u32DiskSectors = u32Value * (1048576UL / HOST_DISK_SECTOR_SIZE); }
+		else if (0 == strcmp(argv[i], "--cmd-us"))		{ u32CmdUs = u32Value; }
+		else if (0 == strcmp(argv[i], "--sector-us"))	{ u32SectorUs = u32Value; }
+		else if (0 == strcmp(argv[i], "--image"))		{ g_pcImage = pcValue; }
+		else if (0 == strcmp(argv[i], "--require"))		{ u32Require = u32Value; }
+		else if (0 == strcmp(argv[i], "--config"))
+		{
+			g_pcExtraConfig = BENCH_ReadFile(pcValue);
+			if (NULL == g_pcExtraConfig)
+			{
+				fprintf(stderr, "ERR: Failed To Read %s.\n", pcValue);
+				return 2;
+			}
+		}
+		else
+		{
+			BENCH_Usage();
+			return 2;
+		}
+		i++;
+	}
+	if ((g_u32LineLength < BENCH_MIN_LINE) || (g_u32LineLength > BENCH_MAX_LINE) || (0UL == g_u32Seconds))
+	{
+		BENCH_Usage();
+		return 2;
+	}
+	HOST_DiskSetLatency(u32CmdUs, u32SectorUs);
+
+	printf("INFO: %u s Per Rate, %u B Lines, Card %u us/Command + %u us/Sector.\n", g_u32Seconds, g_u32LineLength,
+		   u32CmdUs, u32SectorUs);
+	printf("%10s %10s %10s %8s %6s %5s %5s %8s %8s %5s %8s %9s %6s\n", "Baud", "Offer B/s", "Rec B/s", "Lines", "Lost",
+		   "Dup", "Bad", "Overrun", "FifoFull", "Drop", "Writes", "Sectors", "Busy");
+
+	for (uint32_t i = 0UL; i < (sizeof(g_au32Sweep) / sizeof(g_au32Sweep[0])); i++)
+	{
+		uint32_t u32Rate = (0UL != u32Baudrate) ? u32Baudrate : g_au32Sweep[i];
+
+		if (ERROR_NONE != BENCH_Run(u32Rate, &xResult))
+		{
+			fprintf(stderr, "ERR: Run At %u Baud Failed.\n", u32Rate);
+			return 1;
+		}
+		printf("%10u %10.0f %10.0f %8u %6u %5u %5u %8llu %8u %5u %8llu %9llu %5.1f%%\n", xResult.u32Baudrate,
+			   xResult.dOfferedBps, xResult.dRecordedBps, xResult.u32Lines, xResult.u32Lost,
+			   xResult.u32Duplicate, xResult.u32Malformed + xResult.u32Reordered,
+			   (unsigned long long)xResult.xUart.u64Overruns, xResult.u32FifoFull, xResult.u32DroppedBlocks,
+			   (unsigned long long)xResult.xDisk.u64Writes,
+			   (unsigned long long)xResult.xDisk.u64SectorsWritten,
+			   (100.0 * (double)xResult.xDisk.u64BusyUs) / (double)xResult.u64ElapsedUs);
+
+		/* A Dropped Block Is a Bug of The Recorder, Not a Limit of The Card, At Any Required Rate */
+		if ((0UL != xResult.u32DroppedBlocks) && (u32Rate <= u32Require))
+		{
+			fprintf(stderr, "ERR: %u Blocks Dropped By The Recorder At %u Baud.\n", xResult.u32DroppedBlocks, u32Rate);
+			bDropped = true;
+		}
+		if ((0UL != xResult.u32FifoFull) && (u32Rate <= u32Require))
+		{
+			fprintf(stderr, "ERR: %u Bytes Dropped On a Full FIFO At %u Baud.\n", xResult.u32FifoFull, u32Rate);
+			bDropped = true;
+		}
+
+		/* Rates Above The First Lossy One Do Not Count */
+		bAllLossless = bAllLossless && BENCH_IsLossless(&xResult);
+		if (bAllLossless)
+		{
+			u32MaxLossless = u32Rate;
+		}
+		if (0UL != u32Baudrate)
+		{
+			break;
+		}
+	}
+
+	if ((NULL != g_pcImage) && (ERROR_NONE != HOST_DiskSave(g_pcImage)))
+	{
+		return 1;
+	}
+
+	printf("INFO: Max Lossless Baud Rate: %u\n", u32MaxLossless);
+	if ((0UL != u32Require) && (u32MaxLossless < u32Require))
+	{
+		fprintf(stderr, "ERR: Max Lossless Baud Rate %u Is Below The Required %u.\n", u32MaxLossless, u32Require);
+		return 1;
+	}
+	return bDropped ? 1 : 0;
+}
@@ -0,0 +1,224 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      host.h
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Host Build of The Recording Core: Time, Simulated LPUART, RAM Disk And Recording Session.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           host.h
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Host Build of The Recording Core: Time, Simulated LPUART, RAM Disk And Recording Session.
+ * ****************************/
+
+#ifndef HOST_H_
+#define HOST_H_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "error.h"
+
+/*******************************************************************************
+ * Global Definitions
+ ******************************************************************************/
+/**
+ * @brief 	Default Size of The RAM Disk In Sectors (64 MB).
+ */
+#define HOST_DISK_DEFAULT_SECTORS	131072UL
+
+/**
+ * @brief 	Sector Size of The RAM Disk.
+ */
+#define HOST_DISK_SECTOR_SIZE		512U
+
+/**
+ * @brief 	Default Latency Model of The Card: Cost of One Command And of Each Transferred Sector.
+ * @details Roughly a Class 10 Card In 4-Bit Mode At 50 MHz (About 20 MB/s Sequential).
+ */
+#define HOST_DISK_DEFAULT_CMD_US	250UL
+#define HOST_DISK_DEFAULT_SECTOR_US	25UL
+
+/**
+ * @brief 	Statistics of The Simulated LPUART.
+ */
+typedef struct
+{
+	uint64_t u64Injected;			/*<! Bytes Put On The Line							*/
+	uint64_t u64Overruns;			/*<! Bytes Lost Because The RX Interrupt Was Off	*/
+} host_uart_stats_t;
+
+/**
+ * @brief 	Statistics of The RAM Disk.
+ */
+typedef struct
+{
+	uint64_t u64Reads;				/*<! Read Commands									*/
+	uint64_t u64Writes;				/*<! Write Commands									*/
+	uint64_t u64SectorsRead;		/*<! Sectors Read									*/
+	uint64_t u64SectorsWritten;		/*<! Sectors Written								*/
+	uint64_t u64BusyUs;				/*<! Time Spent In The Latency Model				*/
+} host_disk_stats_t;
+
+/**
+ * @brief 	Default Capacity of The Write Journal In Bytes And Its Maximal Number of Writes.
+ */
+#define HOST_JOURNAL_DEFAULT_SIZE	(64UL << 20U)
+#define HOST_JOURNAL_MAX_WRITES		65536UL
+
+/**
+ * @brief 	Verbose Output of PRINTF (INFO And DEBUG Lines), ERR Lines Are Always Printed.
+ */
+extern bool g_bHostVerbose;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+/**
+ * @brief 	Monotonic Time Since The First Call In Microseconds.
+ */
+uint64_t HOST_NowUs(void);
+
+/**
+ * @brief 	Sleeps The Calling Thread.
+ *
+ * @param 	u64Us Time In Microseconds.
+ */
+void HOST_SleepUs(uint64_t u64Us);
+
+/**
+ * @brief 	Puts One Byte On The RX Line of LPUART3.
+ * @details Runs LP_FLEXCOMM3_IRQHandler In The Calling Thread If The Interrupt Is Enabled (The Critical Section
+ * 			Holds It Off Like BASEPRI), Otherwise The Byte Is Counted As Overrun.
+ *
+ * @param 	u8Data Received Byte.
+ */
+void HOST_UartInject(uint8_t u8Data);
+
+/**
+ * @brief 	Returns The Statistics of LPUART3 And Clears Them.
+ *
+ * @param 	pxStats Statistics.
+ */
+void HOST_UartStats(host_uart_stats_t *pxStats);
+
+/**
+ * @brief 	Creates an Empty (Unformatted) RAM Disk, The Previous One Is Freed.
+ *
+ * @param 	u32Sectors Size In Sectors.
+ *
+ * @return 	ERROR_NONE If The Memory Was Allocated.
+ */
+error_t HOST_DiskCreate(uint32_t u32Sectors);
+
+/**
+ * @brief 	Loads The RAM Disk From an Image File, Its Size Sets The Size of The Disk.
+ *
+ * @param 	pcPath Image File.
+ *
+ * @return 	ERROR_NONE If The Image Was Read.
+ */
+error_t HOST_DiskLoad(const char *pcPath);
+
+/**
+ * @brief 	Saves The RAM Disk Into an Image File (Can Be Mounted By The Host, e.g. mtools or a Loop Device).
+ *
+ * @param 	pcPath Image File.
+ *
+ * @return 	ERROR_NONE If The Image Was Written.
+ */
+error_t HOST_DiskSave(const char *pcPath);
+
+/**
+ * @brief 	Sets The Latency Model of The RAM Disk, Zeros Make It Run At Memory Speed.
+ *
+ * @param 	u32CmdUs Cost of One Read or Write Command In Microseconds.
+ * @param 	u32SectorUs Cost of Each Transferred Sector In Microseconds.
+ */
+void HOST_DiskSetLatency(uint32_t u32CmdUs, uint32_t u32SectorUs);
+
+/**
+ * @brief 	Returns The Statistics of The RAM Disk And Clears Them.
+ *
+ * @param 	pxStats Statistics.
+ */
+void HOST_DiskStats(host_disk_stats_t *pxStats);
+
+/**
+ * @brief 	Creates The Write Journal: Each Write Command of The RAM Disk Is Recorded With Its Data In Order.
+ * @details The Journal Lives In Shared Memory, So Writes of a Forked Process Are Seen By Its Parent. It Must Be
+ * 			Created Before The Fork.
+ *
+ * @param 	u32Bytes Capacity For Data And Sector Numbers, Writes Beyond It Are Not Recorded.
+ *
+ * @return 	ERROR_NONE If The Memory Was Mapped.
+ */
+error_t HOST_DiskJournalCreate(uint32_t u32Bytes);
+
+/**
+ * @brief 	Starts or Stops Recording Writes Into The Journal (In The Calling Process).
+ *
+ * @param 	bEnable Writes Are Recorded.
+ */
+void HOST_DiskJournalEnable(bool bEnable);
+
+/**
+ * @brief 	Number of Writes In The Journal, It Is The Index The Next Write Gets.
+ */
+uint32_t HOST_DiskJournalWrites(void);
+
+/**
+ * @brief 	Tells Whether a Write Did Not Fit Into The Journal, Which Is Then Incomplete.
+ */
+bool HOST_DiskJournalFull(void);
+
+/**
+ * @brief 	Number of Sectors of a Write In The Journal, 0 If There Is No Such Write.
+ *
+ * @param 	u32Write Index of The Write.
+ */
+uint32_t HOST_DiskJournalSectors(uint32_t u32Write);
+
+/**
+ * @brief 	Time The Write Took In The Latency Model When It Was Recorded.
+ *
+ * @param 	u32Write Index of The Write.
+ */
+uint32_t HOST_DiskJournalCostUs(uint32_t u32Write);
+
+/**
+ * @brief 	Puts The First Sectors of a Write From The Journal On The RAM Disk, Without Latency And Statistics.
+ * @details Fewer Sectors Than The Write Has Model a Power Cut In The Middle of a Multi-Sector Write.
+ *
+ * @param 	u32Write Index of The Write.
+ * @param 	u32Sectors Number of Sectors Put On The Disk.
+ *
+ * @return 	ERROR_NONE If The Write Is In The Journal.
+ */
+error_t HOST_DiskJournalApply(uint32_t u32Write, uint32_t u32Sectors);
+
+/**
+ * @brief 	Mounts The Card And Starts Recording Like record_task After USB Detach.
+ * @details The Configuration Text Is Written Into CONFIG_FILE First, So It Goes Through CONSOLELOG_ReadConfig.
+ * 			A Thread Runs The Loop of record_task (Wait, Drain FIFO, Flush On Deadline).
+ *
+ * @param 	pcConfig Content of The Configuration File, NULL Keeps The File On The Disk.
+ *
+ * @return 	ERROR_NONE If Recording Runs.
+ */
+error_t HOST_SessionStart(const char *pcConfig);
+
+/**
+ * @brief 	Stops Recording Like a USB Attach: The Last Pass Runs, The Buffers Are Flushed, The Card Is Unmounted.
+ *
+ * @return 	ERROR_NONE If All Received Data Reached The Card.
+ */
+error_t HOST_SessionStop(void);
+
+#endif /* HOST_H_ */
@@ -0,0 +1,392 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      host_board.c
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Peripherals And Firmware Modules Around The Recording Core, Modelled For The Host Build.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           host_board.c
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Peripherals And Firmware Modules Around The Recording Core, Modelled For The Host Build.
+ * ****************************/
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdarg.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "fsl_common.h"
+#include "fsl_lpuart.h"
+#include "fsl_irtc.h"
+#include "fsl_clock.h"
+#include "fsl_gpio.h"
+#include "fsl_sd.h"
+#include "fsl_debug_console.h"
+#include "task.h"
+
+#include "led.h"
+#include "error.h"
+#include "trace.h"
+#include "mem.h"
+#include "usb_disk_adapter.h"
+
+#include "host.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/**
+ * @brief 	Core Clock of The MCXN947 (PLL0 At 150 MHz).
+ */
+#define HOST_CORE_CLOCK_HZ			150000000UL
+
+/**
+ * @brief 	Functional Clock of LP_FLEXCOMM3 (FRO_HF/1).
+ */
+#define HOST_FLEXCOMM_CLOCK_HZ		48000000UL
+
+/**
+ * @brief 	Alignment of The Blocks Drawn From The Arenas (SD DMA).
+ */
+#define HOST_MEM_ALIGN				32U
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+/**
+ * @brief 	LPUART3 Interrupt Handler of The Recorder (record.c).
+ */
+void LP_FLEXCOMM3_IRQHandler(void);
+
+/*******************************************************************************
+ * Global Variables
+ ******************************************************************************/
+bool g_bHostVerbose 				= false;
+uint32_t SystemCoreClock 			= HOST_CORE_CLOCK_HZ;
+volatile uint32_t g_u32DiagIsrCycles = 0UL;
+
+LPUART_Type g_xHostLpuart3;
+RTC_Type g_xHostRtc;
+GPIO_Type g_axHostGpio[5];
+
+/**
+ * @brief 	Card Handle, Only The ADMA Error Status Is Read By The Recorder.
+ */
+static USDHC_Type g_xHostUsdhc;
+static sdmmchost_t g_xHostSdmmc = { .hostController = { .base = &g_xHostUsdhc } };
+sd_card_t g_sd = { .host = &g_xHostSdmmc };
+
+/**
+ * @brief 	Enabled Interrupts (NVIC).
+ */
+static volatile bool g_abIrqEnabled[HOST_IRQ_COUNT];
+
+/**
+ * @brief 	Statistics of LPUART3.
+ */
+static host_uart_stats_t g_xUartStats;
+
+/**
+ * @brief 	Cycle Counter, Refreshed On Each Access.
+ */
+static DWT_Type g_xDwt;
+
+/**
+ * @brief 	Start of The Monotonic Time.
+ */
+static struct timespec g_xEpoch;
+static bool g_bEpochSet = false;
+
+/*******************************************************************************
+ * Time
+ ******************************************************************************/
+uint64_t HOST_NowUs(void)
+{
+	struct timespec xNow;
+
+	(void)clock_gettime(CLOCK_MONOTONIC, &xNow);
+	if (!g_bEpochSet)
+	{
+		/* First Call Comes From main Before Any Thread Is Started */
+		g_xEpoch = xNow;
+		g_bEpochSet = true;
+	}
+	return ((uint64_t)(xNow.tv_sec - g_xEpoch.tv_sec) * 1000000ULL) +
+		   (uint64_t)((xNow.tv_nsec - g_xEpoch.tv_nsec) / 1000L);
+}
+
+void HOST_SleepUs(uint64_t u64Us)
+{
+	struct timespec xTime;
+
+	xTime.tv_sec = (time_t)(u64Us / 1000000ULL);
+	xTime.tv_nsec = (long)((u64Us % 1000000ULL) * 1000ULL);
+	while (0 != nanosleep(&xTime, &xTime))
+	{
+	}
+}
+
+DWT_Type *HOST_Dwt(void)
+{
+	g_xDwt.CYCCNT = (uint32_t)(HOST_NowUs() * (SystemCoreClock / 1000000UL));
+	return &g_xDwt;
+}
+
+/*******************************************************************************
+ * NVIC
+ ******************************************************************************/
+status_t EnableIRQ(IRQn_Type interrupt)
+{
+	g_abIrqEnabled[interrupt] = true;
+	return kStatus_Success;
+}
+
+status_t EnableIRQWithPriority(IRQn_Type irq, uint8_t priNum)
+{
+	(void)priNum;
+	return EnableIRQ(irq);
+}
+
+status_t DisableIRQ(IRQn_Type interrupt)
+{
+	/* The Handler May Be Running In The Feeder Thread, Disabling Waits Till It Returns Like On The Core */
+	HOST_EnterCritical();
+	g_abIrqEnabled[interrupt] = false;
+	HOST_ExitCritical();
+	return kStatus_Success;
+}
+
+bool HOST_IsIrqEnabled(IRQn_Type interrupt)
+{
+	return g_abIrqEnabled[interrupt];
+}
+
+/*******************************************************************************
+ * LPUART3
+ ******************************************************************************/
+void LPUART_GetDefaultConfig(lpuart_config_t *config)
+{
+	(void)memset(config, 0, sizeof(lpuart_config_t));
+	config->baudRate_Bps 	= 115200U;
+	config->parityMode 		= kLPUART_ParityDisabled;
+	config->dataBitsCount 	= kLPUART_EightDataBits;
+	config->stopBitCount 	= kLPUART_OneStopBit;
+}
+
+status_t LPUART_Init(LPUART_Type *base, const lpuart_config_t *config, uint32_t srcClock_Hz)
+{
+	/* Same Limit As The SDK Driver: At Least 4 Samples Per Bit */
+	if ((0U == config->baudRate_Bps) || ((srcClock_Hz / 4U) < config->baudRate_Bps))
+	{
+		return kStatus_Fail;
+	}
+	base->xConfig 		= *config;
+	base->bInitialized 	= true;
+	base->u32Interrupts = 0UL;
+	base->u32Stat 		= 0UL;
+	return kStatus_Success;
+}
+
+void LPUART_Deinit(LPUART_Type *base)
+{
+	base->bInitialized 	= false;
+	base->u32Interrupts = 0UL;
+}
+
+void LPUART_EnableInterrupts(LPUART_Type *base, uint32_t mask)
+{
+	base->u32Interrupts |= mask;
+}
+
+void LPUART_DisableInterrupts(LPUART_Type *base, uint32_t mask)
+{
+	base->u32Interrupts &= ~mask;
+}
+
+uint32_t LPUART_GetStatusFlags(LPUART_Type *base)
+{
+	return base->u32Stat;
+}
+
+status_t LPUART_ClearStatusFlags(LPUART_Type *base, uint32_t mask)
+{
+	/* RDRF Is Cleared By Reading DATA, Error Flags Are Write-1-To-Clear */
+	base->u32Stat &= ~(mask & ~(uint32_t)kLPUART_RxDataRegFullFlag);
+	return kStatus_Success;
+}
+
+uint8_t LPUART_ReadByte(LPUART_Type *base)
+{
+	base->u32Stat &= ~(uint32_t)kLPUART_RxDataRegFullFlag;
+	return base->u8Data;
+}
+
+void HOST_UartInject(uint8_t u8Data)
+{
+	LPUART_Type *pxBase = LPUART3;
+
+	HOST_EnterCritical();
+	g_xUartStats.u64Injected++;
+
+	if (!pxBase->bInitialized || !pxBase->xConfig.enableRx)
+	{
+		/* Receiver Off, The Byte Is Not Seen At All */
+		g_xUartStats.u64Overruns++;
+	}
+	else if (0UL != (pxBase->u32Stat & (uint32_t)kLPUART_RxDataRegFullFlag))
+	{
+		/* Previous Byte Was Not Read */
+		pxBase->u32Stat |= (uint32_t)kLPUART_RxOverrunFlag;
+		g_xUartStats.u64Overruns++;
+	}
+	else
+	{
+		pxBase->u8Data = u8Data;
+		pxBase->u32Stat |= (uint32_t)kLPUART_RxDataRegFullFlag;
+	}
+
+	if (HOST_IsIrqEnabled(LP_FLEXCOMM3_IRQn) &&
+		(0UL != (pxBase->u32Interrupts & (uint32_t)kLPUART_RxDataRegFullInterruptEnable)) &&
+		(0UL != (pxBase->u32Stat & (uint32_t)kLPUART_RxDataRegFullFlag)))
+	{
+		LP_FLEXCOMM3_IRQHandler();
+	}
+	HOST_ExitCritical();
+}
+
+void HOST_UartStats(host_uart_stats_t *pxStats)
+{
+	HOST_EnterCritical();
+	*pxStats = g_xUartStats;
+	(void)memset(&g_xUartStats, 0, sizeof(g_xUartStats));
+	/* A Byte Left In DATA Belongs To The Previous Run */
+	LPUART3->u32Stat = 0UL;
+	HOST_ExitCritical();
+}
+
+uint32_t CLOCK_GetLPFlexCommClkFreq(uint32_t id)
+{
+	(void)id;
+	return HOST_FLEXCOMM_CLOCK_HZ;
+}
+
+/*******************************************************************************
+ * IRTC
+ ******************************************************************************/
+void IRTC_GetDatetime(RTC_Type *base, irtc_datetime_t *datetime)
+{
+	time_t xNow = time(NULL);
+	struct tm xTm;
+
+	(void)base;
+	(void)localtime_r(&xNow, &xTm);
+	datetime->year 		= (uint16_t)(xTm.tm_year + 1900);
+	datetime->month 	= (uint8_t)(xTm.tm_mon + 1);
+	datetime->day 		= (uint8_t)xTm.tm_mday;
+	datetime->weekDay 	= (uint8_t)xTm.tm_wday;
+	datetime->hour 		= (uint8_t)xTm.tm_hour;
+	datetime->minute 	= (uint8_t)xTm.tm_min;
+	datetime->second 	= (uint8_t)xTm.tm_sec;
+}
+
+/*******************************************************************************
+ * Debug Console
+ ******************************************************************************/
+int HOST_Printf(const char *pcFormat, ...)
+{
+	va_list xArgs;
+	int iLength;
+
+	if (!g_bHostVerbose && (0 != strncmp(pcFormat, "ERR", 3U)))
+	{
+		return 0;
+	}
+	va_start(xArgs, pcFormat);
+	iLength = vfprintf(stderr, pcFormat, xArgs);
+	va_end(xArgs);
+	return iLength;
+}
+
+/*******************************************************************************
+ * Firmware Modules Outside The Recording Core
+ ******************************************************************************/
+void *MEM_Alloc(mem_region_t eRegion, mem_owner_t eOwner, uint32_t u32Size, const char *pcName)
+{
+	uint32_t u32Aligned = (u32Size + HOST_MEM_ALIGN - 1U) & ~(HOST_MEM_ALIGN - 1U);
+	void *pvBlock = aligned_alloc(HOST_MEM_ALIGN, u32Aligned);
+
+	(void)eRegion;
+	(void)eOwner;
+	if (NULL == pvBlock)
+	{
+		PRINTF("ERR: Allocation of %s (%u B) Failed.\r\n", pcName, u32Size);
+		return NULL;
+	}
+	/* Retained Blocks Start Zeroed Like After Power-On, So The Retention Check Finds No Valid Header */
+	(void)memset(pvBlock, 0, u32Aligned);
+	return pvBlock;
+}
+
+void TRACE_Event(trace_id_t eId, uint8_t u8Type, uint16_t u16Arg)
+{
+	(void)eId;
+	(void)u8Type;
+	(void)u16Arg;
+}
+
+void TRACE_Trigger(trace_id_t eId)
+{
+	(void)eId;
+}
+
+bool TRACE_IsTriggered(void)
+{
+	return false;
+}
+
+error_t TRACE_Dump(void)
+{
+	return ERROR_NONE;
+}
+
+void LED_SignalRecording(void)
+{
+}
+
+void LED_SignalRecordingStop(void)
+{
+}
+
+void LED_SignalLowMemory(void)
+{
+}
+
+void LED_SignalError(void)
+{
+}
+
+void LED_SignalFlush(void)
+{
+}
+
+void LED_ClearSignalFlush(void)
+{
+}
+
+void USB_Disk_EnterStandby(void)
+{
+}
+
+void ERR_HandleError(void)
+{
+	/* The Firmware Halts In The Error State, The Run Is Not Usable Any More */
+	PRINTF("ERR: Error State Entered.\r\n");
+	exit(EXIT_FAILURE);
+}
@@ -0,0 +1,527 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      host_os.c
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    FreeRTOS API Used By The Recording Core, Mapped On POSIX Threads.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           host_os.c
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          FreeRTOS API Used By The Recording Core, Mapped On POSIX Threads.
+ * ****************************/
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <errno.h>
+#include <stdlib.h>
+#include <time.h>
+#include <pthread.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "timers.h"
+#include "semphr.h"
+
+#include "host.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/**
+ * @brief 	Task: Thread With Its Notification Value.
+ */
+struct HostTask
+{
+	pthread_t 		xThread;
+	pthread_mutex_t xLock;
+	pthread_cond_t 	xCond;
+	uint32_t 		u32Value;		/* Notification Value		*/
+	bool 			bPending;		/* Notification Pending		*/
+	void 			(*pfTask)(void *);
+	void 			*pvArg;
+};
+
+/*******************************************************************************
+ * Global Variables
+ ******************************************************************************/
+/**
+ * @brief 	Task of The Calling Thread, NULL For Threads Not Created By HOST_TaskCreate (main).
+ */
+static __thread struct HostTask *g_pxCurrentTask = NULL;
+
+/**
+ * @brief 	Task Used By Threads Not Created By HOST_TaskCreate.
+ */
+static struct HostTask g_xMainTask =
+{
+	.xLock = PTHREAD_MUTEX_INITIALIZER,
+	.xCond = PTHREAD_COND_INITIALIZER
+};
+
+/**
+ * @brief 	Critical Section, Held By The Simulated Interrupts While They Run.
+ */
+static pthread_mutex_t g_xCritical;
+static pthread_once_t g_xCriticalOnce = PTHREAD_ONCE_INIT;
+
+/**
+ * @brief 	Active Timers And The Timer Service Thread.
+ */
+static pthread_mutex_t g_xTimerLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t g_xTimerCond;
+static StaticTimer_t *g_pxTimers = NULL;
+static bool g_bTimerThreadStarted = false;
+static pthread_t g_xTimerThread;
+
+/*******************************************************************************
+ * Static Functions
+ ******************************************************************************/
+/**
+ * @brief 	Initializes a Condition Variable Timed By The Monotonic Clock.
+ */
+static void HOST_CondInit(pthread_cond_t *pxCond)
+{
+	pthread_condattr_t xAttr;
+
+	(void)pthread_condattr_init(&xAttr);
+	(void)pthread_condattr_setclock(&xAttr, CLOCK_MONOTONIC);
+	(void)pthread_cond_init(pxCond, &xAttr);
+	(void)pthread_condattr_destroy(&xAttr);
+}
+
+/**
+ * @brief 	Converts a Timeout In Ticks To an Absolute Monotonic Time.
+ */
+static struct timespec HOST_Deadline(TickType_t xTicks)
+{
+	struct timespec xTime;
+	uint64_t u64Ns;
+
+	(void)clock_gettime(CLOCK_MONOTONIC, &xTime);
+	u64Ns = (uint64_t)xTime.tv_nsec + ((uint64_t)xTicks * 1000000ULL / configTICK_RATE_HZ * 1000ULL);
+	xTime.tv_sec += (time_t)(u64Ns / 1000000000ULL);
+	xTime.tv_nsec = (long)(u64Ns % 1000000000ULL);
+	return xTime;
+}
+
+static struct HostTask *HOST_CurrentTask(void)
+{
+	return (NULL != g_pxCurrentTask) ? g_pxCurrentTask : &g_xMainTask;
+}
+
+static void *HOST_TaskEntry(void *pvTask)
+{
+	struct HostTask *pxTask = (struct HostTask *)pvTask;
+
+	g_pxCurrentTask = pxTask;
+	pxTask->pfTask(pxTask->pvArg);
+	return NULL;
+}
+
+static void HOST_CriticalInit(void)
+{
+	pthread_mutexattr_t xAttr;
+
+	(void)pthread_mutexattr_init(&xAttr);
+	(void)pthread_mutexattr_settype(&xAttr, PTHREAD_MUTEX_RECURSIVE);
+	(void)pthread_mutex_init(&g_xCritical, &xAttr);
+	(void)pthread_mutexattr_destroy(&xAttr);
+}
+
+/**
+ * @brief 	Timer Service Thread, Callbacks Run Without The Timer Lock Like In The Timer Service Task.
+ */
+static void *HOST_TimerThread(void *pvArg)
+{
+	(void)pvArg;
+
+	(void)pthread_mutex_lock(&g_xTimerLock);
+	while (true)
+	{
+		StaticTimer_t *pxDue = NULL;
+		TickType_t xNow = xTaskGetTickCount();
+		TickType_t xWait = portMAX_DELAY;
+
+		for (StaticTimer_t *pxTimer = g_pxTimers; NULL != pxTimer; pxTimer = pxTimer->pxNext)
+		{
+			if (!pxTimer->bActive)
+			{
+				continue;
+			}
+			if ((int32_t)(pxTimer->xExpiry - xNow) <= 0)
+			{
+				pxDue = pxTimer;
+				break;
+			}
+			if ((pxTimer->xExpiry - xNow) < xWait)
+			{
+				xWait = pxTimer->xExpiry - xNow;
+			}
+		}
+
+		if (NULL != pxDue)
+		{
+			if (pxDue->bAutoReload)
+			{
+				pxDue->xExpiry += pxDue->xPeriod;
+			}
+			else
+			{
+				pxDue->bActive = false;
+			}
+			(void)pthread_mutex_unlock(&g_xTimerLock);
+			pxDue->pfCallback(pxDue);
+			(void)pthread_mutex_lock(&g_xTimerLock);
+		}
+		else if (portMAX_DELAY == xWait)
+		{
+			(void)pthread_cond_wait(&g_xTimerCond, &g_xTimerLock);
+		}
+		else
+		{
+			struct timespec xDeadline = HOST_Deadline(xWait);
+			(void)pthread_cond_timedwait(&g_xTimerCond, &g_xTimerLock, &xDeadline);
+		}
+	}
+	return NULL;
+}
+
+/*******************************************************************************
+ * Tasks
+ ******************************************************************************/
+TaskHandle_t HOST_TaskCreate(void (*pfTask)(void *), void *pvArg)
+{
+	struct HostTask *pxTask = (struct HostTask *)calloc(1U, sizeof(struct HostTask));
+
+	if (NULL == pxTask)
+	{
+		return NULL;
+	}
+	(void)pthread_mutex_init(&pxTask->xLock, NULL);
+	HOST_CondInit(&pxTask->xCond);
+	pxTask->pfTask 	= pfTask;
+	pxTask->pvArg 	= pvArg;
+	if (0 != pthread_create(&pxTask->xThread, NULL, HOST_TaskEntry, pxTask))
+	{
+		free(pxTask);
+		return NULL;
+	}
+	return pxTask;
+}
+
+void HOST_TaskJoin(TaskHandle_t xTask)
+{
+	/* Not Freed, The Flush Timer May Fire After The Task Returned */
+	(void)pthread_join(xTask->xThread, NULL);
+}
+
+TickType_t xTaskGetTickCount(void)
+{
+	return (TickType_t)(HOST_NowUs() / (1000000ULL / configTICK_RATE_HZ));
+}
+
+TickType_t xTaskGetTickCountFromISR(void)
+{
+	return xTaskGetTickCount();
+}
+
+void vTaskDelay(TickType_t xTicksToDelay)
+{
+	HOST_SleepUs((uint64_t)xTicksToDelay * (1000000ULL / configTICK_RATE_HZ));
+}
+
+BaseType_t xTaskNotifyWait(uint32_t ulBitsToClearOnEntry, uint32_t ulBitsToClearOnExit,
+						   uint32_t *pulNotificationValue, TickType_t xTicksToWait)
+{
+	struct HostTask *pxTask = HOST_CurrentTask();
+	struct timespec xDeadline = HOST_Deadline(xTicksToWait);
+	BaseType_t xResult = pdTRUE;
+
+	(void)pthread_mutex_lock(&pxTask->xLock);
+	if (!pxTask->bPending)
+	{
+		pxTask->u32Value &= ~ulBitsToClearOnEntry;
+	}
+	while (!pxTask->bPending)
+	{
+		int iStatus = (portMAX_DELAY == xTicksToWait) ? pthread_cond_wait(&pxTask->xCond, &pxTask->xLock) :
+						pthread_cond_timedwait(&pxTask->xCond, &pxTask->xLock, &xDeadline);
+		if (ETIMEDOUT == iStatus)
+		{
+			xResult = pdFALSE;
+			break;
+		}
+	}
+	if (NULL != pulNotificationValue)
+	{
+		*pulNotificationValue = pxTask->u32Value;
+	}
+	if (pdTRUE == xResult)
+	{
+		pxTask->u32Value &= ~ulBitsToClearOnExit;
+	}
+	pxTask->bPending = false;
+	(void)pthread_mutex_unlock(&pxTask->xLock);
+	return xResult;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t xClearCountOnExit, TickType_t xTicksToWait)
+{
+	struct HostTask *pxTask = HOST_CurrentTask();
+	struct timespec xDeadline = HOST_Deadline(xTicksToWait);
+	uint32_t u32Value;
+
+	(void)pthread_mutex_lock(&pxTask->xLock);
+	while (0UL == pxTask->u32Value)
+	{
+		int iStatus = (portMAX_DELAY == xTicksToWait) ? pthread_cond_wait(&pxTask->xCond, &pxTask->xLock) :
+						pthread_cond_timedwait(&pxTask->xCond, &pxTask->xLock, &xDeadline);
+		if (ETIMEDOUT == iStatus)
+		{
+			break;
+		}
+	}
+	u32Value = pxTask->u32Value;
+	pxTask->u32Value = (pdTRUE == xClearCountOnExit) ? 0UL : ((0UL != u32Value) ? (u32Value - 1UL) : 0UL);
+	pxTask->bPending = false;
+	(void)pthread_mutex_unlock(&pxTask->xLock);
+	return u32Value;
+}
+
+BaseType_t xTaskNotify(TaskHandle_t xTaskToNotify, uint32_t ulValue, eNotifyAction eAction)
+{
+	struct HostTask *pxTask = (NULL != xTaskToNotify) ? xTaskToNotify : &g_xMainTask;
+
+	(void)pthread_mutex_lock(&pxTask->xLock);
+	switch (eAction)
+	{
+		case eSetBits:
+			pxTask->u32Value |= ulValue;
+			break;
+		case eIncrement:
+			pxTask->u32Value++;
+			break;
+		case eSetValueWithOverwrite:
+		case eSetValueWithoutOverwrite:
+			pxTask->u32Value = ulValue;
+			break;
+		default:
+			break;
+	}
+	pxTask->bPending = true;
+	(void)pthread_cond_signal(&pxTask->xCond);
+	(void)pthread_mutex_unlock(&pxTask->xLock);
+	return pdPASS;
+}
+
+BaseType_t xTaskNotifyFromISR(TaskHandle_t xTaskToNotify, uint32_t ulValue, eNotifyAction eAction,
+							  BaseType_t *pxHigherPriorityTaskWoken)
+{
+	if (NULL != pxHigherPriorityTaskWoken)
+	{
+		*pxHigherPriorityTaskWoken = pdFALSE;
+	}
+	return xTaskNotify(xTaskToNotify, ulValue, eAction);
+}
+
+void HOST_EnterCritical(void)
+{
+	(void)pthread_once(&g_xCriticalOnce, HOST_CriticalInit);
+	(void)pthread_mutex_lock(&g_xCritical);
+}
+
+void HOST_ExitCritical(void)
+{
+	(void)pthread_mutex_unlock(&g_xCritical);
+}
+
+/*******************************************************************************
+ * Timers
+ ******************************************************************************/
+TimerHandle_t xTimerCreateStatic(const char *pcTimerName, TickType_t xTimerPeriodInTicks, UBaseType_t uxAutoReload,
+								 void *pvTimerID, TimerCallbackFunction_t pxCallbackFunction,
+								 StaticTimer_t *pxTimerBuffer)
+{
+	(void)pcTimerName;
+
+	(void)pthread_mutex_lock(&g_xTimerLock);
+	if (!g_bTimerThreadStarted)
+	{
+		HOST_CondInit(&g_xTimerCond);
+		if (0 != pthread_create(&g_xTimerThread, NULL, HOST_TimerThread, NULL))
+		{
+			(void)pthread_mutex_unlock(&g_xTimerLock);
+			return NULL;
+		}
+		g_bTimerThreadStarted = true;
+	}
+
+	pxTimerBuffer->pfCallback 	= pxCallbackFunction;
+	pxTimerBuffer->pvTimerID 	= pvTimerID;
+	pxTimerBuffer->xPeriod 		= xTimerPeriodInTicks;
+	pxTimerBuffer->xExpiry 		= 0U;
+	pxTimerBuffer->bActive 		= false;
+	pxTimerBuffer->bAutoReload 	= (pdFALSE != (BaseType_t)uxAutoReload);
+	pxTimerBuffer->pxNext 		= g_pxTimers;
+	g_pxTimers = pxTimerBuffer;
+	(void)pthread_mutex_unlock(&g_xTimerLock);
+	return pxTimerBuffer;
+}
+
+BaseType_t xTimerStart(TimerHandle_t xTimer, TickType_t xTicksToWait)
+{
+	(void)xTicksToWait;
+
+	(void)pthread_mutex_lock(&g_xTimerLock);
+	xTimer->xExpiry = xTaskGetTickCount() + xTimer->xPeriod;
+	xTimer->bActive = true;
+	(void)pthread_cond_signal(&g_xTimerCond);
+	(void)pthread_mutex_unlock(&g_xTimerLock);
+	return pdPASS;
+}
+
+BaseType_t xTimerStop(TimerHandle_t xTimer, TickType_t xTicksToWait)
+{
+	(void)xTicksToWait;
+
+	(void)pthread_mutex_lock(&g_xTimerLock);
+	xTimer->bActive = false;
+	(void)pthread_mutex_unlock(&g_xTimerLock);
+	return pdPASS;
+}
+
+BaseType_t xTimerChangePeriod(TimerHandle_t xTimer, TickType_t xNewPeriod, TickType_t xTicksToWait)
+{
+	(void)pthread_mutex_lock(&g_xTimerLock);
+	xTimer->xPeriod = xNewPeriod;
+	(void)pthread_mutex_unlock(&g_xTimerLock);
+	return xTimerStart(xTimer, xTicksToWait);
+}
+
+BaseType_t xTimerIsTimerActive(TimerHandle_t xTimer)
+{
+	bool bActive;
+
+	(void)pthread_mutex_lock(&g_xTimerLock);
+	bActive = xTimer->bActive;
+	(void)pthread_mutex_unlock(&g_xTimerLock);
+	return bActive ? pdTRUE : pdFALSE;
+}
+
+void *pvTimerGetTimerID(TimerHandle_t xTimer)
+{
+	return xTimer->pvTimerID;
+}
+
+/*******************************************************************************
+ * Semaphores
+ ******************************************************************************/
+static SemaphoreHandle_t HOST_SemaphoreInit(StaticSemaphore_t *pxBuffer, uint32_t u32Count, uint32_t u32Max)
+{
+	(void)pthread_mutex_init(&pxBuffer->xLock, NULL);
+	HOST_CondInit(&pxBuffer->xCond);
+	pxBuffer->u32Count 	= u32Count;
+	pxBuffer->u32Max 	= u32Max;
+	pxBuffer->bDynamic 	= false;
+	return pxBuffer;
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutexStatic(StaticSemaphore_t *pxMutexBuffer)
+{
+	return HOST_SemaphoreInit(pxMutexBuffer, 1UL, 1UL);
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinaryStatic(StaticSemaphore_t *pxSemaphoreBuffer)
+{
+	return HOST_SemaphoreInit(pxSemaphoreBuffer, 0UL, 1UL);
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void)
+{
+	StaticSemaphore_t *pxBuffer = (StaticSemaphore_t *)malloc(sizeof(StaticSemaphore_t));
+
+	if (NULL == pxBuffer)
+	{
+		return NULL;
+	}
+	(void)HOST_SemaphoreInit(pxBuffer, 1UL, 1UL);
+	pxBuffer->bDynamic = true;
+	return pxBuffer;
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary(void)
+{
+	StaticSemaphore_t *pxBuffer = (StaticSemaphore_t *)malloc(sizeof(StaticSemaphore_t));
+
+	if (NULL == pxBuffer)
+	{
+		return NULL;
+	}
+	(void)HOST_SemaphoreInit(pxBuffer, 0UL, 1UL);
+	pxBuffer->bDynamic = true;
+	return pxBuffer;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t xSemaphore, TickType_t xBlockTime)
+{
+	struct timespec xDeadline = HOST_Deadline(xBlockTime);
+	BaseType_t xResult = pdTRUE;
+
+	(void)pthread_mutex_lock(&xSemaphore->xLock);
+	while (0UL == xSemaphore->u32Count)
+	{
+		int iStatus = (portMAX_DELAY == xBlockTime) ? pthread_cond_wait(&xSemaphore->xCond, &xSemaphore->xLock) :
+						pthread_cond_timedwait(&xSemaphore->xCond, &xSemaphore->xLock, &xDeadline);
+		if (ETIMEDOUT == iStatus)
+		{
+			xResult = pdFALSE;
+			break;
+		}
+	}
+	if (pdTRUE == xResult)
+	{
+		xSemaphore->u32Count--;
+	}
+	(void)pthread_mutex_unlock(&xSemaphore->xLock);
+	return xResult;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t xSemaphore)
+{
+	BaseType_t xResult = pdFALSE;
+
+	(void)pthread_mutex_lock(&xSemaphore->xLock);
+	if (xSemaphore->u32Count < xSemaphore->u32Max)
+	{
+		xSemaphore->u32Count++;
+		(void)pthread_cond_signal(&xSemaphore->xCond);
+		xResult = pdTRUE;
+	}
+	(void)pthread_mutex_unlock(&xSemaphore->xLock);
+	return xResult;
+}
+
+BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t xSemaphore, BaseType_t *pxHigherPriorityTaskWoken)
+{
+	if (NULL != pxHigherPriorityTaskWoken)
+	{
+		*pxHigherPriorityTaskWoken = pdFALSE;
+	}
+	return xSemaphoreGive(xSemaphore);
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t xSemaphore)
+{
+	(void)pthread_mutex_destroy(&xSemaphore->xLock);
+	(void)pthread_cond_destroy(&xSemaphore->xCond);
+	if (xSemaphore->bDynamic)
+	{
+		free(xSemaphore);
+	}
+}
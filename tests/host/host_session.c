@@ -0,0 +1,155 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      host_session.c
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Recording Session On The Host: The Sequence of record_task And msc_task Around The Recording Core.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           host_session.c
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Recording Session On The Host: The Sequence of record_task And msc_task Around The Recording Core.
+ * ****************************/
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "record.h"
+#include "dump.h"
+#include "uart.h"
+#include "parser.h"
+
+#include "host.h"
+
+/*******************************************************************************
+ * Global Variables
+ ******************************************************************************/
+/**
+ * @brief 	Handle of The Recording Thread, Notified From LPUART ISR And Flush Timer (Defined In main.c On Target).
+ */
+TaskHandle_t g_xRecordTaskHandle = NULL;
+
+/*******************************************************************************
+ * Static Functions
+ ******************************************************************************/
+/**
+ * @brief 	Loop of record_task In Exclusive Mode, Returns After The Pass Which Saw USB Attach.
+ */
+static void HOST_RecordTask(void *pvArg)
+{
+	uint32_t u32FileSize = PARSER_GetFileSize();
+	uint32_t u32Events;
+	error_t retVal;
+
+	(void)pvArg;
+
+	do
+	{
+		u32Events = CONSOLELOG_WaitForEvent();
+
+		CONSOLELOG_Lock();
+		retVal = CONSOLELOG_Recording(u32FileSize);
+		/* A Pass Stores One Block, The Flush And USB Attach Need The Whole FIFO In The Blocks */
+		while ((ERROR_NONE == retVal) && (0UL != (u32Events & (RECORD_EVENT_FLUSH | RECORD_EVENT_USB))) &&
+		       !CONSOLELOG_IsFifoEmpty())
+		{
+			retVal = CONSOLELOG_Recording(u32FileSize);
+		}
+		if ((ERROR_NONE == retVal) && (0UL != (u32Events & RECORD_EVENT_FLUSH)))
+		{
+			retVal = CONSOLELOG_Flush();
+		}
+		CONSOLELOG_Unlock();
+
+		if (ERROR_NONE != retVal)
+		{
+			ERR_HandleError();
+		}
+	} while (0UL == (u32Events & RECORD_EVENT_USB));
+}
+
+/**
+ * @brief 	Writes The Configuration File, Like The Host Editing It Over USB.
+ */
+static error_t HOST_WriteConfig(const char *pcConfig)
+{
+	FIL configFile;
+	UINT bytesWritten;
+	UINT length = (UINT)strlen(pcConfig);
+
+	if (FR_OK != f_open(&configFile, CONFIG_FILE, (FA_WRITE | FA_CREATE_ALWAYS)))
+	{
+		PRINTF("ERR: Failed To Create Configuration File.\r\n");
+		return ERROR_OPEN;
+	}
+	if ((FR_OK != f_write(&configFile, pcConfig, length, &bytesWritten)) || (length != bytesWritten))
+	{
+		PRINTF("ERR: Failed To Write Configuration File.\r\n");
+		(void)f_close(&configFile);
+		return ERROR_RECORD;
+	}
+	return (FR_OK == f_close(&configFile)) ? ERROR_NONE : ERROR_CLOSE;
+}
+
+/*******************************************************************************
+ * Functions
+ ******************************************************************************/
+error_t HOST_SessionStart(const char *pcConfig)
+{
+	error_t retVal;
+
+	retVal = CONSOLELOG_Init();
+	if (ERROR_NONE != retVal)
+	{
+		return retVal;
+	}
+
+	if (NULL != pcConfig)
+	{
+		retVal = HOST_WriteConfig(pcConfig);
+		if (ERROR_NONE != retVal)
+		{
+			return retVal;
+		}
+	}
+
+	/* Missing or Invalid Keys Keep Their Defaults, Like In record_task */
+	(void)CONSOLELOG_ReadConfig();
+	(void)CONSOLELOG_Configure();
+
+	g_xRecordTaskHandle = HOST_TaskCreate(HOST_RecordTask, NULL);
+	if (NULL == g_xRecordTaskHandle)
+	{
+		PRINTF("ERR: Failed To Start The Recording Thread.\r\n");
+		return ERROR_RECORD;
+	}
+
+	CONSOLELOG_Lock();
+	(void)DUMP_Prepare();
+	CONSOLELOG_Unlock();
+
+	UART_Init(PARSER_GetBaudrate());
+	UART_Enable();
+	return ERROR_NONE;
+}
+
+error_t HOST_SessionStop(void)
+{
+	error_t retVal;
+
+	/* USB1_HS ISR And msc_task: Receiving Stops, record_task Ends Its Pass, The Buffers Are Flushed */
+	UART_Disable();
+	(void)xTaskNotify(g_xRecordTaskHandle, RECORD_EVENT_USB, eSetBits);
+	HOST_TaskJoin(g_xRecordTaskHandle);
+
+	retVal = CONSOLELOG_PowerLossFlush();
+	if (ERROR_NONE != retVal)
+	{
+		return retVal;
+	}
+	return CONSOLELOG_Deinit();
+}
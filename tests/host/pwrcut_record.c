@@ -0,0 +1,823 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      pwrcut_record.c
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Host Power-Cut Harness: Cuts The Power Before Every Write of a Session And Checks The Boot Recovery.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           pwrcut_record.c
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Host Power-Cut Harness: Cuts The Power Before Every Write of a Session And Checks The Boot Recovery.
+ * ****************************/
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+
+#include "ff.h"
+#include "record.h"
+
+#include "host.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/**
+ * @brief 	Length of a Generated Line.
+ * @details A Line Is 'L' + 8 Hex Digits of The Line Number + ':' + Filler + LF. Without CR The Recorder Inserts
+ * 			No Time Marks, So The Logs Are Compared Byte By Byte With The Generator (Padding Spaces Skipped).
+ */
+#define PWRCUT_LINE					64U
+
+/**
+ * @brief 	Configuration of The Recorder: Blocks of Two Sectors (Torn Writes), Four Blocks Per File.
+ */
+#define PWRCUT_BLOCK_SIZE			1024UL
+#define PWRCUT_FILE_SIZE			4096UL
+#define PWRCUT_FLUSH_TIMEOUT_MS		200UL
+
+/**
+ * @brief 	Default Size of The RAM Disk In MB, Small So The Forks Stay Cheap.
+ */
+#define PWRCUT_DEFAULT_DISK_MB		16UL
+
+/**
+ * @brief 	Pause of The Feeder After Each Line, Keeps The FIFO Far From Full.
+ */
+#define PWRCUT_FEED_PERIOD_US		200ULL
+
+/**
+ * @brief 	Time The Recorder Is Given To Take The Fed Bytes From FIFO, Shorter Than The Flush Timeout.
+ */
+#define PWRCUT_SETTLE_US			30000ULL
+
+/**
+ * @brief 	Maximal Wait For The Idle Flush.
+ */
+#define PWRCUT_FLUSH_WAIT_US		5000000ULL
+
+/**
+ * @brief 	Maximal Number of Phases, Session Directories And Log Files Scanned.
+ */
+#define PWRCUT_MAX_PHASES			8U
+#define PWRCUT_MAX_DIRS				16U
+#define PWRCUT_MAX_FILES			64U
+
+/**
+ * @brief 	Size of The Chunk Read From a Log File.
+ */
+#define PWRCUT_CHUNK_SIZE			4096U
+
+/**
+ * @brief 	Default Number of Failed Cuts Printed.
+ */
+#define PWRCUT_DEFAULT_LIST			10UL
+
+/**
+ * @brief 	One Phase of The Reference Session: Bytes Fed, Then Idle Flush or Power Loss.
+ * @details The Tail Is Fed Once record_task Took The Bytes, So It Is Still In FIFO When The Power Drops.
+ */
+typedef struct
+{
+	uint32_t u32Bytes;
+	uint32_t u32Tail;
+	bool bPowerLoss;
+	const char *pcName;
+} pwrcut_phase_t;
+
+/**
+ * @brief 	State Shared By The Forked Processes.
+ */
+typedef struct
+{
+	/* Reference Session */
+	bool bReferenceDone;
+	uint32_t u32StartWrite;							/*<! First Write After Mount, Format And Configuration	*/
+	uint32_t au32PhaseWrite[PWRCUT_MAX_PHASES];		/*<! First Write of Each Phase							*/
+	uint64_t au64Acked[PWRCUT_MAX_PHASES];			/*<! Bytes Acknowledged By The Idle Flush of a Phase	*/
+	uint32_t au32AckWrite[PWRCUT_MAX_PHASES];		/*<! Writes On The Card When The Flush Was Acknowledged	*/
+	uint64_t u64Fed;
+	uint64_t u64Overruns;
+
+	/* One Cut */
+	error_t eRecovery;
+	uint64_t u64Recovered;							/*<! Non-Space Bytes In The Logs						*/
+	uint64_t u64Matched;							/*<! Leading Bytes Equal To The Generator				*/
+} pwrcut_shared_t;
+
+/**
+ * @brief 	Sort Keys: Directory "/YYYYMMDD_N" And Log File "YYYYMMDD_HHMMSS_N.txt".
+ */
+typedef struct
+{
+	char acName[FF_MAX_LFN + 1];
+	uint32_t u32Key1;
+	uint32_t u32Key2;
+} pwrcut_entry_t;
+
+/**
+ * @brief 	Totals of The Sweep.
+ */
+typedef struct
+{
+	uint32_t u32Cuts;
+	uint32_t u32Torn;
+	uint32_t u32Failed;
+	uint32_t u32Lost;				/*<! Cuts Which Lost Acknowledged Data			*/
+	uint32_t u32Garbage;			/*<! Cuts Whose Logs Hold Bytes Never Sent		*/
+	uint32_t u32Recovery;			/*<! Cuts After Which Boot Recovery Failed		*/
+	uint32_t u32Unsafe;				/*<! Last Write Before Which a Cut Lost Emergency Data	*/
+	uint64_t u64Saved;				/*<! Bytes Recovered With All Writes On The Card		*/
+} pwrcut_totals_t;
+
+/*******************************************************************************
+ * Global Variables
+ ******************************************************************************/
+/**
+ * @brief 	Reference Session, The Last Phase Ends With The Power Loss.
+ * @details The Second Burst Crosses The File Size Limit, The Last One Leaves a Partial Block And a Partial Line
+ * 			In FIFO For The Emergency Path.
+ */
+static const pwrcut_phase_t g_axPhases[] =
+{
+	{ 1600UL, 	0UL, 	false, 	"Burst, Idle Flush" 							},
+	{ 9000UL, 	0UL, 	false, 	"Burst Over File Size Limit, Idle Flush" 		},
+	{ 1304UL, 	40UL, 	true, 	"Partial Block, Partial Line In FIFO, Power Loss" }
+};
+
+#define PWRCUT_PHASES				((uint32_t)(sizeof(g_axPhases) / sizeof(g_axPhases[0])))
+
+/**
+ * @brief 	Fill Levels of The Back Buffer Measured On The Emergency Paths, The Last Row Leaves a Partial Line
+ * 			In FIFO.
+ */
+static const uint32_t g_au32FillBack[] = { 0UL, 256UL, 512UL, 768UL, 960UL, 512UL };
+static const uint32_t g_au32FillFifo[] = { 0UL, 0UL, 0UL, 0UL, 0UL, 40UL };
+
+/**
+ * @brief 	Options.
+ */
+static uint32_t g_u32DiskSectors 	= PWRCUT_DEFAULT_DISK_MB * (1048576UL / HOST_DISK_SECTOR_SIZE);
+static uint32_t g_u32List 			= PWRCUT_DEFAULT_LIST;
+static bool g_bDump 				= true;
+static bool g_bTorn 				= true;
+static bool g_bFill 				= true;
+
+/**
+ * @brief 	Configuration File of The Sessions.
+ */
+static char g_acConfig[128];
+
+/**
+ * @brief 	Shared State.
+ */
+static pwrcut_shared_t *g_pxShared = NULL;
+
+/*******************************************************************************
+ * Generator
+ ******************************************************************************/
+static uint8_t PWRCUT_Byte(uint64_t u64Index)
+{
+	static const char acHex[] = "0123456789ABCDEF";
+	uint32_t u32Line 	= (uint32_t)(u64Index / PWRCUT_LINE);
+	uint32_t u32Offset 	= (uint32_t)(u64Index % PWRCUT_LINE);
+
+	if (0UL == u32Offset)
+	{
+		return (uint8_t)'L';
+	}
+	if (u32Offset <= 8UL)
+	{
+		return (uint8_t)acHex[(u32Line >> (4UL * (8UL - u32Offset))) & 0xFUL];
+	}
+	if (9UL == u32Offset)
+	{
+		return (uint8_t)':';
+	}
+	if ((PWRCUT_LINE - 1U) == u32Offset)
+	{
+		return (uint8_t)'\n';
+	}
+	/* Space-Free, The Recorder Pads Blocks With Spaces */
+	return (uint8_t)('a' + ((u32Line + u32Offset) % 26UL));
+}
+
+/**
+ * @brief 	Puts The Next Bytes of The Stream On The Line, Pausing After Each Line.
+ */
+static void PWRCUT_Feed(uint64_t *pu64Fed, uint32_t u32Bytes)
+{
+	for (uint32_t i = 0UL; i < u32Bytes; i++)
+	{
+		HOST_UartInject(PWRCUT_Byte(*pu64Fed));
+		(*pu64Fed)++;
+		if (0ULL == (*pu64Fed % PWRCUT_LINE))
+		{
+			HOST_SleepUs(PWRCUT_FEED_PERIOD_US);
+		}
+	}
+}
+
+/*******************************************************************************
+ * Reference Session
+ ******************************************************************************/
+/**
+ * @brief 	Waits Till The Idle Flush Closed The File And record_task Finished Its Pass.
+ */
+static bool PWRCUT_WaitFlush(void)
+{
+	uint64_t u64End = HOST_NowUs() + PWRCUT_FLUSH_WAIT_US;
+
+	while (!CONSOLELOG_GetFlushCompleted())
+	{
+		if (HOST_NowUs() > u64End)
+		{
+			return false;
+		}
+		HOST_SleepUs(1000ULL);
+	}
+	/* The Flag Is Set Before The Latency Report Is Written, The Pass Ends Under The Lock */
+	CONSOLELOG_Lock();
+	CONSOLELOG_Unlock();
+	return true;
+}
+
+/**
+ * @brief 	Runs The Reference Session In a Forked Process, Its Writes Go Into The Journal.
+ */
+static void PWRCUT_Reference(void)
+{
+	host_uart_stats_t xUart;
+	uint64_t u64Fed = 0ULL;
+
+	if (ERROR_NONE != HOST_SessionStart(g_acConfig))
+	{
+		_exit(1);
+	}
+	g_pxShared->u32StartWrite = HOST_DiskJournalWrites();
+
+	for (uint32_t p = 0UL; p < PWRCUT_PHASES; p++)
+	{
+		g_pxShared->au32PhaseWrite[p] = HOST_DiskJournalWrites();
+		PWRCUT_Feed(&u64Fed, g_axPhases[p].u32Bytes);
+
+		if (!g_axPhases[p].bPowerLoss)
+		{
+			if (!PWRCUT_WaitFlush())
+			{
+				fprintf(stderr, "ERR: No Idle Flush After Phase %u.\n", p + 1UL);
+				_exit(1);
+			}
+			g_pxShared->au64Acked[p] 	= u64Fed;
+			g_pxShared->au32AckWrite[p] = HOST_DiskJournalWrites();
+			continue;
+		}
+
+		/* The Supply Drops While The Recorder Idles, Its Writes Do Not Mix Into The Emergency Path */
+		HOST_SleepUs(PWRCUT_SETTLE_US);
+		PWRCUT_Feed(&u64Fed, g_axPhases[p].u32Tail);
+		g_pxShared->au32PhaseWrite[p] = HOST_DiskJournalWrites();
+		(void)(g_bDump ? CONSOLELOG_PowerLossDump() : CONSOLELOG_PowerLossFlush());
+		break;
+	}
+
+	HOST_UartStats(&xUart);
+	g_pxShared->u64Fed 			= u64Fed;
+	g_pxShared->u64Overruns 	= xUart.u64Overruns;
+	g_pxShared->bReferenceDone 	= true;
+
+	/* Power Is Gone, Nothing Else Reaches The Card */
+	_exit(0);
+}
+
+/*******************************************************************************
+ * Recovery And Scanner
+ ******************************************************************************/
+static int PWRCUT_CompareEntries(const void *pvA, const void *pvB)
+{
+	const pwrcut_entry_t *pxA = (const pwrcut_entry_t *)pvA;
+	const pwrcut_entry_t *pxB = (const pwrcut_entry_t *)pvB;
+
+	if (pxA->u32Key1 != pxB->u32Key1)
+	{
+		return (pxA->u32Key1 < pxB->u32Key1) ? -1 : 1;
+	}
+	return (pxA->u32Key2 < pxB->u32Key2) ? -1 : ((pxA->u32Key2 > pxB->u32Key2) ? 1 : 0);
+}
+
+/**
+ * @brief 	Lists The Entries of a Directory Matching The Pattern, Sorted By Their Counters.
+ */
+static uint32_t PWRCUT_List(const char *pcPath, bool bDirs, pwrcut_entry_t *pxEntries, uint32_t u32Max)
+{
+	DIR dir;
+	FILINFO info;
+	uint32_t u32Count = 0UL;
+
+	if (FR_OK != f_opendir(&dir, pcPath))
+	{
+		return 0UL;
+	}
+	while ((FR_OK == f_readdir(&dir, &info)) && ('\0' != info.fname[0]) && (u32Count < u32Max))
+	{
+		pwrcut_entry_t *pxEntry = &pxEntries[u32Count];
+		unsigned int uKey1;
+		unsigned int uKey2;
+		char acTime[8];
+
+		if (bDirs != (0U != (info.fattrib & AM_DIR)))
+		{
+			continue;
+		}
+		if (bDirs ? (2 != sscanf(info.fname, "%8u_%u", &uKey1, &uKey2)) :
+					(3 != sscanf(info.fname, "%8u_%6[0-9]_%u.txt", &uKey1, acTime, &uKey2)))
+		{
+			continue;
+		}
+		pxEntry->u32Key1 = bDirs ? uKey1 : 0UL;
+		pxEntry->u32Key2 = uKey2;
+		(void)snprintf(pxEntry->acName, sizeof(pxEntry->acName), "%s", info.fname);
+		u32Count++;
+	}
+	(void)f_closedir(&dir);
+	qsort(pxEntries, u32Count, sizeof(pwrcut_entry_t), PWRCUT_CompareEntries);
+	return u32Count;
+}
+
+/**
+ * @brief 	Compares a File With The Stream, The First Byte Which Differs Ends The Match.
+ */
+static void PWRCUT_ScanFile(const char *pcPath, bool *pbMismatch)
+{
+	static char acChunk[PWRCUT_CHUNK_SIZE];
+	FIL file;
+	UINT bytesRead;
+
+	if (FR_OK != f_open(&file, pcPath, FA_READ))
+	{
+		return;
+	}
+	while ((FR_OK == f_read(&file, acChunk, sizeof(acChunk), &bytesRead)) && (0U != bytesRead))
+	{
+		for (UINT i = 0U; i < bytesRead; i++)
+		{
+			if (' ' == acChunk[i])
+			{
+				continue;
+			}
+			g_pxShared->u64Recovered++;
+			if (!*pbMismatch && ((uint8_t)acChunk[i] == PWRCUT_Byte(g_pxShared->u64Matched)))
+			{
+				g_pxShared->u64Matched++;
+			}
+			else
+			{
+				*pbMismatch = true;
+			}
+		}
+	}
+	(void)f_close(&file);
+}
+
+/**
+ * @brief 	Boots On The Cut Disk Like After Power-On, Then Reads The Logs In Order And DUMP_RECOVERED_FILE.
+ */
+static void PWRCUT_Recover(void)
+{
+	static pwrcut_entry_t axDirs[PWRCUT_MAX_DIRS];
+	static pwrcut_entry_t axFiles[PWRCUT_MAX_FILES];
+	static FATFS xFs;
+	char acPath[2U * (FF_MAX_LFN + 2)];
+	bool bMismatch = false;
+	uint32_t u32Dirs;
+
+	g_pxShared->u64Recovered 	= 0ULL;
+	g_pxShared->u64Matched 		= 0ULL;
+	g_pxShared->eRecovery 		= CONSOLELOG_Init();
+	if (ERROR_NONE == g_pxShared->eRecovery)
+	{
+		g_pxShared->eRecovery = CONSOLELOG_Deinit();
+	}
+	if (ERROR_NONE != g_pxShared->eRecovery)
+	{
+		return;
+	}
+	if ((FR_OK != f_mount(&xFs, "2:/", 1U)) || (FR_OK != f_chdrive("2:")))
+	{
+		g_pxShared->eRecovery = ERROR_FILESYSTEM;
+		return;
+	}
+
+	u32Dirs = PWRCUT_List("/", true, axDirs, PWRCUT_MAX_DIRS);
+	for (uint32_t d = 0UL; d < u32Dirs; d++)
+	{
+		uint32_t u32Files;
+
+		(void)snprintf(acPath, sizeof(acPath), "/%s", axDirs[d].acName);
+		u32Files = PWRCUT_List(acPath, false, axFiles, PWRCUT_MAX_FILES);
+		for (uint32_t f = 0UL; f < u32Files; f++)
+		{
+			(void)snprintf(acPath, sizeof(acPath), "/%s/%s", axDirs[d].acName, axFiles[f].acName);
+			PWRCUT_ScanFile(acPath, &bMismatch);
+		}
+	}
+	/* Dump of a Session Without Log File Ends Here, It Is The Newest Data */
+	PWRCUT_ScanFile("/" DUMP_RECOVERED_FILE, &bMismatch);
+	(void)f_mount(NULL, "2:/", 0U);
+}
+
+/*******************************************************************************
+ * Sweep
+ ******************************************************************************/
+/**
+ * @brief 	Runs a Function In a Forked Process And Waits For It.
+ *
+ * @return 	True If The Process Exited With 0.
+ */
+static bool PWRCUT_Fork(void (*pfnChild)(uint32_t, uint32_t), uint32_t u32Arg1, uint32_t u32Arg2)
+{
+	pid_t xPid;
+	int iStatus;
+
+	(void)fflush(stdout);
+	(void)fflush(stderr);
+	xPid = fork();
+	if (0 == xPid)
+	{
+		pfnChild(u32Arg1, u32Arg2);
+		(void)fflush(stdout);
+		_exit(0);
+	}
+	if ((xPid < 0) || (xPid != waitpid(xPid, &iStatus, 0)))
+	{
+		return false;
+	}
+	return WIFEXITED(iStatus) && (0 == WEXITSTATUS(iStatus));
+}
+
+/**
+ * @brief 	Child of One Cut: The Disk Holds All Writes Before u32Write, Then The First u32Torn Sectors of It.
+ */
+static void PWRCUT_CutChild(uint32_t u32Write, uint32_t u32Torn)
+{
+	/* Boot Recovery Reports What It Could Not Repair, The Sweep Judges The Result */
+	if (!g_bHostVerbose)
+	{
+		(void)freopen("/dev/null", "w", stderr);
+	}
+	if ((0UL != u32Torn) && (ERROR_NONE != HOST_DiskJournalApply(u32Write, u32Torn)))
+	{
+		_exit(1);
+	}
+	HOST_DiskSetLatency(0UL, 0UL);
+	PWRCUT_Recover();
+}
+
+/**
+ * @brief 	Bytes Acknowledged As Flushed Once The Given Number of Writes Reached The Card.
+ */
+static uint64_t PWRCUT_Acked(uint32_t u32Writes)
+{
+	uint64_t u64Acked = 0ULL;
+
+	for (uint32_t p = 0UL; p < PWRCUT_PHASES; p++)
+	{
+		if ((!g_axPhases[p].bPowerLoss) && (g_pxShared->au32AckWrite[p] <= u32Writes) &&
+			(g_pxShared->au64Acked[p] > u64Acked))
+		{
+			u64Acked = g_pxShared->au64Acked[p];
+		}
+	}
+	return u64Acked;
+}
+
+/**
+ * @brief 	Phase The Write Belongs To.
+ */
+static uint32_t PWRCUT_Phase(uint32_t u32Write)
+{
+	uint32_t u32Phase = 0UL;
+
+	for (uint32_t p = 1UL; p < PWRCUT_PHASES; p++)
+	{
+		if (u32Write >= g_pxShared->au32PhaseWrite[p])
+		{
+			u32Phase = p;
+		}
+	}
+	return u32Phase;
+}
+
+/**
+ * @brief 	Cuts The Power Before Write u32Write (Or In It After u32Torn Sectors) And Checks The Recovered Logs.
+ */
+static void PWRCUT_Cut(uint32_t u32Write, uint32_t u32Torn, pwrcut_totals_t *pxTotals)
+{
+	uint64_t u64Acked = PWRCUT_Acked(u32Write);
+	uint32_t u32Emergency = g_pxShared->au32PhaseWrite[PWRCUT_PHASES - 1UL];
+	bool bDone = PWRCUT_Fork(PWRCUT_CutChild, u32Write, u32Torn);
+	bool bRecovery = !bDone || (ERROR_NONE != g_pxShared->eRecovery);
+	bool bLost = !bRecovery && (g_pxShared->u64Matched < u64Acked);
+	bool bGarbage = !bRecovery && (g_pxShared->u64Recovered != g_pxShared->u64Matched);
+
+	pxTotals->u32Cuts++;
+	pxTotals->u32Torn += (0UL != u32Torn) ? 1UL : 0UL;
+	if (bRecovery || bLost || bGarbage)
+	{
+		pxTotals->u32Failed++;
+		pxTotals->u32Recovery += bRecovery ? 1UL : 0UL;
+		pxTotals->u32Lost += bLost ? 1UL : 0UL;
+		pxTotals->u32Garbage += bGarbage ? 1UL : 0UL;
+		if (pxTotals->u32Failed <= g_u32List)
+		{
+			printf("FAIL: Cut Before Write %u", u32Write);
+			if (0UL != u32Torn)
+			{
+				printf(" (%u of %u Sectors Written)", u32Torn, HOST_DiskJournalSectors(u32Write));
+			}
+			printf(" In \"%s\": ", g_axPhases[PWRCUT_Phase(u32Write)].pcName);
+			if (bRecovery)
+			{
+				printf("Boot Recovery Failed (%d)\n", bDone ? (int)g_pxShared->eRecovery : -1);
+			}
+			else
+			{
+				printf("Acked %llu B, Recovered %llu B, Matching %llu B\n", (unsigned long long)u64Acked,
+					   (unsigned long long)g_pxShared->u64Recovered, (unsigned long long)g_pxShared->u64Matched);
+			}
+		}
+	}
+
+	/* Emergency Path: The Last Cut Which Did Not Recover All Data It Saves In The End */
+	if ((u32Write >= u32Emergency) && (g_pxShared->u64Matched < pxTotals->u64Saved))
+	{
+		pxTotals->u32Unsafe = u32Write;
+	}
+}
+
+/**
+ * @brief 	Puts The Writes Before u32Write On The Parent Disk.
+ */
+static bool PWRCUT_Advance(uint32_t u32From, uint32_t u32To)
+{
+	for (uint32_t w = u32From; w < u32To; w++)
+	{
+		if (ERROR_NONE != HOST_DiskJournalApply(w, HOST_DiskJournalSectors(w)))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+/**
+ * @brief 	Card Time of The Writes In The Range In The Latency Model of The Reference Session.
+ */
+static uint64_t PWRCUT_CostUs(uint32_t u32From, uint32_t u32To)
+{
+	uint64_t u64Us = 0ULL;
+
+	for (uint32_t w = u32From; w < u32To; w++)
+	{
+		u64Us += HOST_DiskJournalCostUs(w);
+	}
+	return u64Us;
+}
+
+static void PWRCUT_ReferenceChild(uint32_t u32Unused1, uint32_t u32Unused2)
+{
+	(void)u32Unused1;
+	(void)u32Unused2;
+	PWRCUT_Reference();
+}
+
+/**
+ * @brief 	Runs The Reference Session And Cuts The Power Before Every Write of It.
+ *
+ * @return 	True If No Cut Lost Acknowledged Data or Left Garbage.
+ */
+static bool PWRCUT_Sweep(void)
+{
+	pwrcut_totals_t xTotals;
+	uint32_t u32Writes;
+	uint32_t u32Emergency;
+	uint64_t u64Pending;
+
+	(void)memset(&xTotals, 0, sizeof(xTotals));
+	HOST_DiskJournalEnable(true);
+	if (!PWRCUT_Fork(PWRCUT_ReferenceChild, 0UL, 0UL) || !g_pxShared->bReferenceDone)
+	{
+		fprintf(stderr, "ERR: Reference Session Failed.\n");
+		return false;
+	}
+	HOST_DiskJournalEnable(false);
+	if (HOST_DiskJournalFull() || (0ULL != g_pxShared->u64Overruns))
+	{
+		fprintf(stderr, "ERR: Reference Session Incomplete (Journal Full or %llu Overruns).\n",
+				(unsigned long long)g_pxShared->u64Overruns);
+		return false;
+	}
+	u32Writes 		= HOST_DiskJournalWrites();
+	u32Emergency 	= g_pxShared->au32PhaseWrite[PWRCUT_PHASES - 1UL];
+
+	/* What The Emergency Path Saved With All Its Writes On The Card Bounds Its Unsafe Window */
+	if (!PWRCUT_Advance(0UL, u32Writes) || !PWRCUT_Fork(PWRCUT_CutChild, u32Writes, 0UL) ||
+		(ERROR_NONE != g_pxShared->eRecovery))
+	{
+		fprintf(stderr, "ERR: Recovery of The Complete Session Failed.\n");
+		return false;
+	}
+	xTotals.u64Saved 	= g_pxShared->u64Matched;
+	xTotals.u32Unsafe 	= u32Emergency;
+	u64Pending 			= g_pxShared->u64Fed - PWRCUT_Acked(u32Writes);
+
+	printf("INFO: Reference Session: %llu B In %u Phases, %u Writes (Session From Write %u, Power Loss From %u).\n",
+		   (unsigned long long)g_pxShared->u64Fed, PWRCUT_PHASES, u32Writes, g_pxShared->u32StartWrite, u32Emergency);
+
+	/* Parent Disk Steps Through The Session, Each Cut Works On a Copy-On-Write Copy of It */
+	if ((ERROR_NONE != HOST_DiskCreate(g_u32DiskSectors)) || !PWRCUT_Advance(0UL, g_pxShared->u32StartWrite))
+	{
+		return false;
+	}
+	for (uint32_t w = g_pxShared->u32StartWrite; w <= u32Writes; w++)
+	{
+		uint32_t u32Sectors = HOST_DiskJournalSectors(w);
+
+		PWRCUT_Cut(w, 0UL, &xTotals);
+		for (uint32_t s = 1UL; g_bTorn && (s < u32Sectors); s++)
+		{
+			PWRCUT_Cut(w, s, &xTotals);
+		}
+		if ((w < u32Writes) && !PWRCUT_Advance(w, w + 1UL))
+		{
+			return false;
+		}
+	}
+
+	printf("INFO: Emergency Path (%s): %u Writes, %llu us Card Time, Saved %llu of %llu Pending B",
+		   g_bDump ? "Dump" : "FatFs", u32Writes - u32Emergency,
+		   (unsigned long long)PWRCUT_CostUs(u32Emergency, u32Writes),
+		   (unsigned long long)(xTotals.u64Saved - PWRCUT_Acked(u32Writes)), (unsigned long long)u64Pending);
+	if (xTotals.u64Saved > PWRCUT_Acked(u32Writes))
+	{
+		printf(", Safe After %u Writes (%llu us)", xTotals.u32Unsafe + 1UL - u32Emergency,
+			   (unsigned long long)PWRCUT_CostUs(u32Emergency, xTotals.u32Unsafe + 1UL));
+	}
+	printf(".\n");
+
+	printf("RESULT: %s: %u Cuts (%u Torn), %u Failed (Lost Acked %u, Garbage %u, Recovery %u).\n",
+		   (0UL == xTotals.u32Failed) ? "PASS" : "FAIL", xTotals.u32Cuts, xTotals.u32Torn, xTotals.u32Failed,
+		   xTotals.u32Lost, xTotals.u32Garbage, xTotals.u32Recovery);
+
+	/* Both Emergency Paths Must Save Everything Pending, The FIFO Included */
+	if (xTotals.u64Saved != g_pxShared->u64Fed)
+	{
+		fprintf(stderr, "ERR: Power Loss %s Lost %llu B.\n", g_bDump ? "Dump" : "Flush",
+				(unsigned long long)(g_pxShared->u64Fed - xTotals.u64Saved));
+		return false;
+	}
+	return (0UL == xTotals.u32Failed);
+}
+
+/*******************************************************************************
+ * Fill Levels
+ ******************************************************************************/
+/**
+ * @brief 	Child of One Row: One Block Written, Then The Back Buffer And FIFO Filled, Then The Emergency Path.
+ */
+static void PWRCUT_FillChild(uint32_t u32Row, uint32_t u32Dump)
+{
+	host_disk_stats_t xDisk;
+	uint64_t u64Fed = 0ULL;
+	uint64_t u64Start;
+	uint64_t u64Us;
+
+	if ((ERROR_NONE != HOST_DiskCreate(g_u32DiskSectors)) || (ERROR_NONE != HOST_SessionStart(g_acConfig)))
+	{
+		_exit(1);
+	}
+	PWRCUT_Feed(&u64Fed, PWRCUT_BLOCK_SIZE + g_au32FillBack[u32Row]);
+	HOST_SleepUs(PWRCUT_SETTLE_US);
+	PWRCUT_Feed(&u64Fed, g_au32FillFifo[u32Row]);
+
+	HOST_DiskStats(&xDisk);
+	u64Start = HOST_NowUs();
+	(void)((0UL != u32Dump) ? CONSOLELOG_PowerLossDump() : CONSOLELOG_PowerLossFlush());
+	u64Us = HOST_NowUs() - u64Start;
+	HOST_DiskStats(&xDisk);
+
+	printf("%6s %7u %7u %7llu %8llu %8llu %8llu\n", (0UL != u32Dump) ? "dump" : "fatfs", g_au32FillBack[u32Row],
+		   g_au32FillFifo[u32Row], (unsigned long long)xDisk.u64Writes,
+		   (unsigned long long)xDisk.u64SectorsWritten, (unsigned long long)xDisk.u64BusyUs,
+		   (unsigned long long)u64Us);
+}
+
+/**
+ * @brief 	Measures Both Emergency Paths At The Fill Levels.
+ */
+static bool PWRCUT_FillTable(void)
+{
+	printf("INFO: Emergency Paths By Buffer Fill (Block %lu B, Card Time In The Latency Model).\n",
+		   PWRCUT_BLOCK_SIZE);
+	printf("%6s %7s %7s %7s %8s %8s %8s\n", "Path", "Back B", "FIFO B", "Writes", "Sectors", "Card us", "Host us");
+	for (uint32_t r = 0UL; r < (sizeof(g_au32FillBack) / sizeof(g_au32FillBack[0])); r++)
+	{
+		if (!PWRCUT_Fork(PWRCUT_FillChild, r, 1UL) || !PWRCUT_Fork(PWRCUT_FillChild, r, 0UL))
+		{
+			fprintf(stderr, "ERR: Fill Level %u + %u Failed.\n", g_au32FillBack[r], g_au32FillFifo[r]);
+			return false;
+		}
+	}
+	return true;
+}
+
+/*******************************************************************************
+ * Main
+ ******************************************************************************/
+static void PWRCUT_Usage(void)
+{
+	printf("Usage: pwrcut_record [options]\n"
+		   "  --emergency PATH  Power Loss Path of The Session: dump or fatfs (Default dump)\n"
+		   "  --no-torn         Cut Only Between Writes, Not Inside Multi-Sector Writes\n"
+		   "  --no-fill         Skip The Table of The Emergency Paths By Buffer Fill\n"
+		   "  --list N          Failed Cuts Printed (Default %lu)\n"
+		   "  --disk-mb N       Size of The RAM Disk (Default %lu)\n"
+		   "  --cmd-us N        Card Latency Per Command (Default %lu)\n"
+		   "  --sector-us N     Card Latency Per Sector (Default %lu)\n"
+		   "  -v                Print INFO Lines of The Firmware\n",
+		   PWRCUT_DEFAULT_LIST, PWRCUT_DEFAULT_DISK_MB, HOST_DISK_DEFAULT_CMD_US, HOST_DISK_DEFAULT_SECTOR_US);
+}
+
+int main(int argc, char *argv[])
+{
+	uint32_t u32CmdUs = HOST_DISK_DEFAULT_CMD_US;
+	uint32_t u32SectorUs = HOST_DISK_DEFAULT_SECTOR_US;
+	bool bPass;
+
+	(void)HOST_NowUs();
+
+	for (int i = 1; i < argc; i++)
+	{
+		const char *pcValue = ((i + 1) < argc) ? argv[i + 1] : NULL;
+		uint32_t u32Value = (NULL != pcValue) ? (uint32_t)strtoul(pcValue, NULL, 10) : 0UL;
+
+		if (0 == strcmp(argv[i], "-v"))					{ g_bHostVerbose = true; continue; }
+		else if (0 == strcmp(argv[i], "--no-torn"))		{ g_bTorn = false; continue; }
+		else if (0 == strcmp(argv[i], "--no-fill"))		{ g_bFill = false; continue; }
+		else if (NULL == pcValue)
+		{
+			PWRCUT_Usage();
+			return 2;
+		}
+		if (0 == strcmp(argv[i], "--list"))				{ g_u32List = u32Value; }
+		else if (0 == strcmp(argv[i], "--disk-mb"))		{ g_u32DiskSectors = u32Value * (1048576UL / HOST_DISK_SECTOR_SIZE); }
+		else if (0 == strcmp(argv[i], "--cmd-us"))		{ u32CmdUs = u32Value; }
+		else if (0 == strcmp(argv[i], "--sector-us"))	{ u32SectorUs = u32Value; }
+		else if ((0 == strcmp(argv[i], "--emergency")) && (0 == strcmp(pcValue, "dump")))	{ g_bDump = true; }
+		else if ((0 == strcmp(argv[i], "--emergency")) && (0 == strcmp(pcValue, "fatfs")))	{ g_bDump = false; }
+		else
+		{
+			PWRCUT_Usage();
+			return 2;
+		}
+		i++;
+	}
+	if (0UL == g_u32DiskSectors)
+	{
+		PWRCUT_Usage();
+		return 2;
+	}
+	HOST_DiskSetLatency(u32CmdUs, u32SectorUs);
+	(void)snprintf(g_acConfig, sizeof(g_acConfig), "block_size=%lu\r\nfile_size=%lu\r\nflush_timeout_ms=%lu\r\n",
+				   PWRCUT_BLOCK_SIZE, PWRCUT_FILE_SIZE, PWRCUT_FLUSH_TIMEOUT_MS);
+
+	/* Shared With The Forked Sessions, Created Before The First Fork */
+	g_pxShared = (pwrcut_shared_t *)mmap(NULL, sizeof(pwrcut_shared_t), (PROT_READ | PROT_WRITE),
+										 (MAP_SHARED | MAP_ANONYMOUS), -1, 0);
+	if ((MAP_FAILED == (void *)g_pxShared) || (ERROR_NONE != HOST_DiskJournalCreate(HOST_JOURNAL_DEFAULT_SIZE)) ||
+		(ERROR_NONE != HOST_DiskCreate(g_u32DiskSectors)))
+	{
+		fprintf(stderr, "ERR: Failed To Set Up The Shared Memory.\n");
+		return 1;
+	}
+
+	printf("INFO: Block %lu B, File %lu B, Flush Timeout %lu ms, Card %u us/Command + %u us/Sector.\n",
+		   PWRCUT_BLOCK_SIZE, PWRCUT_FILE_SIZE, PWRCUT_FLUSH_TIMEOUT_MS, u32CmdUs, u32SectorUs);
+	bPass = PWRCUT_Sweep();
+	if (g_bFill && !PWRCUT_FillTable())
+	{
+		bPass = false;
+	}
+	return bPass ? 0 : 1;
+}
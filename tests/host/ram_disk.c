@@ -0,0 +1,343 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      ram_disk.c
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    RAM Disk With a Latency Model, Serves Both RAMDISK And SDDISK of diskio.c.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           ram_disk.c
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          RAM Disk With a Latency Model, Serves Both RAMDISK And SDDISK of diskio.c.
+ * ****************************/
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+
+#include "fsl_ram_disk.h"
+#include "fsl_debug_console.h"
+
+#include "host.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/**
+ * @brief 	One Write In The Journal, Its Sectors Follow.
+ */
+typedef struct
+{
+	uint32_t u32Sector;
+	uint32_t u32Count;
+	uint32_t u32CostUs;				/*<! Time In The Latency Model						*/
+} host_journal_entry_t;
+
+/**
+ * @brief 	Head of The Shared Journal, The Entries Follow.
+ */
+typedef struct
+{
+	uint32_t u32Writes;
+	bool bFull;
+	uint64_t u64Used;				/*<! Bytes of Entries								*/
+	uint64_t u64Capacity;
+	uint64_t au64Offset[HOST_JOURNAL_MAX_WRITES];
+} host_journal_t;
+
+/*******************************************************************************
+ * Global Variables
+ ******************************************************************************/
+/**
+ * @brief 	Content And Size of The Disk.
+ */
+static uint8_t *g_pu8Disk 			= NULL;
+static uint32_t g_u32DiskSectors 	= 0UL;
+
+/**
+ * @brief 	Latency Model.
+ */
+static uint32_t g_u32CmdUs 			= HOST_DISK_DEFAULT_CMD_US;
+static uint32_t g_u32SectorUs 		= HOST_DISK_DEFAULT_SECTOR_US;
+
+/**
+ * @brief 	Statistics, One Card Serves One Command At a Time.
+ */
+static host_disk_stats_t g_xDiskStats;
+static pthread_mutex_t g_xDiskLock = PTHREAD_MUTEX_INITIALIZER;
+
+/**
+ * @brief 	Write Journal (Shared Mapping) And Whether This Process Records Into It.
+ */
+static host_journal_t *g_pxJournal 	= NULL;
+static bool g_bJournalEnabled 		= false;
+
+/*******************************************************************************
+ * Static Functions
+ ******************************************************************************/
+/**
+ * @brief 	Blocks The Caller For The Time The Card Would Take.
+ */
+static void HOST_DiskBusy(UINT count)
+{
+	uint64_t u64Us = (uint64_t)g_u32CmdUs + ((uint64_t)g_u32SectorUs * count);
+
+	uint64_t u64End = HOST_NowUs() + u64Us;
+
+	/* Sleeps Overshoot By Milliseconds On a Loaded Host, The Card Time Is Spun Off Yielding To The Feeder */
+	g_xDiskStats.u64BusyUs += u64Us;
+	while (HOST_NowUs() < u64End)
+	{
+		(void)sched_yield();
+	}
+}
+
+/**
+ * @brief 	Appends a Write To The Journal, Called Under The Disk Lock.
+ */
+static void HOST_DiskJournalRecord(const BYTE *buff, LBA_t sector, UINT count, uint32_t u32CostUs)
+{
+	host_journal_entry_t xEntry = { (uint32_t)sector, (uint32_t)count, u32CostUs };
+	uint8_t *pu8Entries = (uint8_t *)&g_pxJournal[1];
+	size_t szBytes = sizeof(xEntry) + ((size_t)count * HOST_DISK_SECTOR_SIZE);
+
+	if (g_pxJournal->bFull || (g_pxJournal->u32Writes >= HOST_JOURNAL_MAX_WRITES) ||
+		((g_pxJournal->u64Used + szBytes) > g_pxJournal->u64Capacity))
+	{
+		if (!g_pxJournal->bFull)
+		{
+			PRINTF("ERR: Disk Journal Full After %u Writes.\r\n", g_pxJournal->u32Writes);
+		}
+		g_pxJournal->bFull = true;
+		return;
+	}
+	(void)memcpy(&pu8Entries[g_pxJournal->u64Used], &xEntry, sizeof(xEntry));
+	(void)memcpy(&pu8Entries[g_pxJournal->u64Used + sizeof(xEntry)], buff, (size_t)count * HOST_DISK_SECTOR_SIZE);
+	g_pxJournal->au64Offset[g_pxJournal->u32Writes] = g_pxJournal->u64Used;
+	g_pxJournal->u64Used += szBytes;
+	g_pxJournal->u32Writes++;
+}
+
+/**
+ * @brief 	Entry of a Write In The Journal, NULL If There Is No Such Write.
+ */
+static const host_journal_entry_t *HOST_DiskJournalEntry(uint32_t u32Write)
+{
+	if ((NULL == g_pxJournal) || (u32Write >= g_pxJournal->u32Writes))
+	{
+		return NULL;
+	}
+	return (const host_journal_entry_t *)(const void *)((const uint8_t *)&g_pxJournal[1] +
+														 g_pxJournal->au64Offset[u32Write]);
+}
+
+/*******************************************************************************
+ * Functions
+ ******************************************************************************/
+error_t HOST_DiskCreate(uint32_t u32Sectors)
+{
+	free(g_pu8Disk);
+	g_pu8Disk = (uint8_t *)calloc(u32Sectors, HOST_DISK_SECTOR_SIZE);
+	g_u32DiskSectors = (NULL != g_pu8Disk) ? u32Sectors : 0UL;
+	(void)memset(&g_xDiskStats, 0, sizeof(g_xDiskStats));
+	return (NULL != g_pu8Disk) ? ERROR_NONE : ERROR_UNKNOWN;
+}
+
+error_t HOST_DiskLoad(const char *pcPath)
+{
+	FILE *pxFile = fopen(pcPath, "rb");
+	long lSize;
+	error_t retVal = ERROR_OPEN;
+
+	if (NULL == pxFile)
+	{
+		PRINTF("ERR: Failed To Open Image %s.\r\n", pcPath);
+		return ERROR_OPEN;
+	}
+	if ((0 == fseek(pxFile, 0L, SEEK_END)) && (0L < (lSize = ftell(pxFile))) && (0 == fseek(pxFile, 0L, SEEK_SET)) &&
+		(ERROR_NONE == HOST_DiskCreate((uint32_t)(lSize / (long)HOST_DISK_SECTOR_SIZE))))
+	{
+		retVal = (g_u32DiskSectors == fread(g_pu8Disk, HOST_DISK_SECTOR_SIZE, g_u32DiskSectors, pxFile)) ?
+				 ERROR_NONE : ERROR_READ;
+	}
+	(void)fclose(pxFile);
+	if (ERROR_NONE != retVal)
+	{
+		PRINTF("ERR: Failed To Read Image %s.\r\n", pcPath);
+	}
+	return retVal;
+}
+
+error_t HOST_DiskSave(const char *pcPath)
+{
+	FILE *pxFile = fopen(pcPath, "wb");
+	error_t retVal;
+
+	if (NULL == pxFile)
+	{
+		PRINTF("ERR: Failed To Create Image %s.\r\n", pcPath);
+		return ERROR_OPEN;
+	}
+	retVal = (g_u32DiskSectors == fwrite(g_pu8Disk, HOST_DISK_SECTOR_SIZE, g_u32DiskSectors, pxFile)) ?
+			 ERROR_NONE : ERROR_RECORD;
+	if ((0 != fclose(pxFile)) || (ERROR_NONE != retVal))
+	{
+		PRINTF("ERR: Failed To Write Image %s.\r\n", pcPath);
+		retVal = ERROR_RECORD;
+	}
+	return retVal;
+}
+
+void HOST_DiskSetLatency(uint32_t u32CmdUs, uint32_t u32SectorUs)
+{
+	g_u32CmdUs 		= u32CmdUs;
+	g_u32SectorUs 	= u32SectorUs;
+}
+
+void HOST_DiskStats(host_disk_stats_t *pxStats)
+{
+	(void)pthread_mutex_lock(&g_xDiskLock);
+	*pxStats = g_xDiskStats;
+	(void)memset(&g_xDiskStats, 0, sizeof(g_xDiskStats));
+	(void)pthread_mutex_unlock(&g_xDiskLock);
+}
+
+error_t HOST_DiskJournalCreate(uint32_t u32Bytes)
+{
+	size_t szSize = sizeof(host_journal_t) + u32Bytes;
+	void *pvMap;
+
+	/* Pages Are Only Committed As The Journal Grows */
+	pvMap = mmap(NULL, szSize, (PROT_READ | PROT_WRITE), (MAP_SHARED | MAP_ANONYMOUS | MAP_NORESERVE), -1, 0);
+	if (MAP_FAILED == pvMap)
+	{
+		PRINTF("ERR: Failed To Map The Disk Journal (%u B).\r\n", u32Bytes);
+		return ERROR_UNKNOWN;
+	}
+	g_pxJournal = (host_journal_t *)pvMap;
+	g_pxJournal->u64Capacity = u32Bytes;
+	return ERROR_NONE;
+}
+
+void HOST_DiskJournalEnable(bool bEnable)
+{
+	(void)pthread_mutex_lock(&g_xDiskLock);
+	g_bJournalEnabled = bEnable && (NULL != g_pxJournal);
+	(void)pthread_mutex_unlock(&g_xDiskLock);
+}
+
+uint32_t HOST_DiskJournalWrites(void)
+{
+	return (NULL != g_pxJournal) ? g_pxJournal->u32Writes : 0UL;
+}
+
+bool HOST_DiskJournalFull(void)
+{
+	return (NULL != g_pxJournal) && g_pxJournal->bFull;
+}
+
+uint32_t HOST_DiskJournalSectors(uint32_t u32Write)
+{
+	const host_journal_entry_t *pxEntry = HOST_DiskJournalEntry(u32Write);
+
+	return (NULL != pxEntry) ? pxEntry->u32Count : 0UL;
+}
+
+uint32_t HOST_DiskJournalCostUs(uint32_t u32Write)
+{
+	const host_journal_entry_t *pxEntry = HOST_DiskJournalEntry(u32Write);
+
+	return (NULL != pxEntry) ? pxEntry->u32CostUs : 0UL;
+}
+
+error_t HOST_DiskJournalApply(uint32_t u32Write, uint32_t u32Sectors)
+{
+	const host_journal_entry_t *pxEntry = HOST_DiskJournalEntry(u32Write);
+
+	if ((NULL == pxEntry) || (NULL == g_pu8Disk) || (u32Sectors > pxEntry->u32Count) ||
+		((pxEntry->u32Sector + u32Sectors) > g_u32DiskSectors))
+	{
+		return ERROR_UNKNOWN;
+	}
+	(void)memcpy(&g_pu8Disk[(size_t)pxEntry->u32Sector * HOST_DISK_SECTOR_SIZE], &pxEntry[1],
+				 (size_t)u32Sectors * HOST_DISK_SECTOR_SIZE);
+	return ERROR_NONE;
+}
+
+DSTATUS ram_disk_status(BYTE pdrv)
+{
+	(void)pdrv;
+	return (NULL != g_pu8Disk) ? 0U : STA_NOINIT;
+}
+
+DSTATUS ram_disk_initialize(BYTE pdrv)
+{
+	return ram_disk_status(pdrv);
+}
+
+DRESULT ram_disk_read(BYTE pdrv, BYTE *buff, LBA_t sector, UINT count)
+{
+	(void)pdrv;
+	if ((NULL == g_pu8Disk) || ((sector + count) > g_u32DiskSectors))
+	{
+		return RES_PARERR;
+	}
+	(void)pthread_mutex_lock(&g_xDiskLock);
+	HOST_DiskBusy(count);
+	(void)memcpy(buff, &g_pu8Disk[(size_t)sector * HOST_DISK_SECTOR_SIZE], (size_t)count * HOST_DISK_SECTOR_SIZE);
+	g_xDiskStats.u64Reads++;
+	g_xDiskStats.u64SectorsRead += count;
+	(void)pthread_mutex_unlock(&g_xDiskLock);
+	return RES_OK;
+}
+
+DRESULT ram_disk_write(BYTE pdrv, const BYTE *buff, LBA_t sector, UINT count)
+{
+	(void)pdrv;
+	if ((NULL == g_pu8Disk) || ((sector + count) > g_u32DiskSectors))
+	{
+		return RES_PARERR;
+	}
+	(void)pthread_mutex_lock(&g_xDiskLock);
+	HOST_DiskBusy(count);
+	(void)memcpy(&g_pu8Disk[(size_t)sector * HOST_DISK_SECTOR_SIZE], buff, (size_t)count * HOST_DISK_SECTOR_SIZE);
+	g_xDiskStats.u64Writes++;
+	g_xDiskStats.u64SectorsWritten += count;
+	if (g_bJournalEnabled)
+	{
+		HOST_DiskJournalRecord(buff, sector, count, g_u32CmdUs + (g_u32SectorUs * (uint32_t)count));
+	}
+	(void)pthread_mutex_unlock(&g_xDiskLock);
+	return RES_OK;
+}
+
+DRESULT ram_disk_ioctl(BYTE pdrv, BYTE cmd, void *buff)
+{
+	(void)pdrv;
+	switch (cmd)
+	{
+		case CTRL_SYNC:
+			return RES_OK;
+		case GET_SECTOR_COUNT:
+			*(LBA_t *)buff = (LBA_t)g_u32DiskSectors;
+			return RES_OK;
+		case GET_SECTOR_SIZE:
+			*(WORD *)buff = (WORD)HOST_DISK_SECTOR_SIZE;
+			return RES_OK;
+		case GET_BLOCK_SIZE:
+			*(DWORD *)buff = 1UL;
+			return RES_OK;
+		default:
+			return RES_PARERR;
+	}
+}
@@ -0,0 +1,47 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      FreeRTOS.h
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Host Stub of The FreeRTOS Kernel Types And Configuration (1 ms Tick).
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           FreeRTOS.h
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Host Stub of The FreeRTOS Kernel Types And Configuration (1 ms Tick).
+ * ****************************/
+
+#ifndef FREERTOS_H_
+#define FREERTOS_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <assert.h>
+
+typedef uint32_t 		TickType_t;
+typedef long 			BaseType_t;
+typedef unsigned long 	UBaseType_t;
+typedef uint32_t 		StackType_t;
+
+#define portSTACK_TYPE					uint32_t
+#define pdFALSE							((BaseType_t)0)
+#define pdTRUE							((BaseType_t)1)
+#define pdPASS							pdTRUE
+#define pdFAIL							pdFALSE
+#define portMAX_DELAY					((TickType_t)0xFFFFFFFFUL)
+
+#define configTICK_RATE_HZ				((TickType_t)1000U)
+#define configMINIMAL_STACK_SIZE		((uint16_t)128U)
+#define configTIMER_TASK_STACK_DEPTH	((uint16_t)256U)
+#define portTICK_PERIOD_MS				((TickType_t)1000U / configTICK_RATE_HZ)
+#define pdMS_TO_TICKS(xTimeInMs)		((TickType_t)(((TickType_t)(xTimeInMs) * configTICK_RATE_HZ) / (TickType_t)1000U))
+
+#define configASSERT(x)					assert(x)
+#define portYIELD_FROM_ISR(x)			((void)(x))
+
+#endif /* FREERTOS_H_ */
@@ -0,0 +1,23 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      board.h
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Host Stub, The Board Support Is Not Needed On The Host.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           board.h
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Host Stub, The Board Support Is Not Needed On The Host.
+ * ****************************/
+
+#ifndef BOARD_H_
+#define BOARD_H_
+
+#include "fsl_common.h"
+
+#endif /* BOARD_H_ */
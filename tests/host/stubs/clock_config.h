@@ -0,0 +1,23 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      clock_config.h
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Host Stub, The Board Support Is Not Needed On The Host.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           clock_config.h
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Host Stub, The Board Support Is Not Needed On The Host.
+ * ****************************/
+
+#ifndef CLOCK_CONFIG_H_
+#define CLOCK_CONFIG_H_
+
+#include "fsl_common.h"
+
+#endif /* CLOCK_CONFIG_H_ */
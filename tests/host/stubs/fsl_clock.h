@@ -0,0 +1,25 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      fsl_clock.h
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Host Stub of The Clock Driver.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           fsl_clock.h
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Host Stub of The Clock Driver.
+ * ****************************/
+
+#ifndef FSL_CLOCK_H_
+#define FSL_CLOCK_H_
+
+#include <stdint.h>
+
+uint32_t CLOCK_GetLPFlexCommClkFreq(uint32_t id);
+
+#endif /* FSL_CLOCK_H_ */
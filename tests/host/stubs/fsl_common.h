@@ -0,0 +1,67 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      fsl_common.h
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Host Stub of The SDK Common Definitions, Interrupt Control And DWT Cycle Counter.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           fsl_common.h
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Host Stub of The SDK Common Definitions, Interrupt Control And DWT Cycle Counter.
+ * ****************************/
+
+#ifndef FSL_COMMON_H_
+#define FSL_COMMON_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+typedef int32_t status_t;
+
+#define kStatus_Success					((status_t)0)
+#define kStatus_Fail					((status_t)1)
+
+#define SDK_ALIGN(var, alignbytes)		var __attribute__((aligned(alignbytes)))
+#define SDK_ISR_EXIT_BARRIER
+
+#ifndef MIN
+#define MIN(a, b)						(((a) < (b)) ? (a) : (b))
+#endif
+#ifndef MAX
+#define MAX(a, b)						(((a) > (b)) ? (a) : (b))
+#endif
+
+typedef enum
+{
+	LP_FLEXCOMM3_IRQn 	= 0,
+	USB1_HS_IRQn,
+	HSCMP1_IRQn,
+	HOST_IRQ_COUNT
+} IRQn_Type;
+
+/* Interrupts Are Only Gated: a Disabled LPUART Interrupt Drops The Received Bytes (host_board.c) */
+status_t EnableIRQ(IRQn_Type interrupt);
+status_t EnableIRQWithPriority(IRQn_Type irq, uint8_t priNum);
+status_t DisableIRQ(IRQn_Type interrupt);
+bool HOST_IsIrqEnabled(IRQn_Type interrupt);
+
+typedef struct
+{
+	volatile uint32_t CYCCNT;
+} DWT_Type;
+
+/* Cycle Counter Derived From The Monotonic Clock At SystemCoreClock */
+DWT_Type *HOST_Dwt(void);
+
+#define DWT 							(HOST_Dwt())
+
+extern uint32_t SystemCoreClock;
+
+#endif /* FSL_COMMON_H_ */
@@ -0,0 +1,23 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      fsl_common_arm.h
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Host Stub, The Board Support Is Not Needed On The Host.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           fsl_common_arm.h
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Host Stub, The Board Support Is Not Needed On The Host.
+ * ****************************/
+
+#ifndef FSL_COMMON_ARM_H_
+#define FSL_COMMON_ARM_H_
+
+#include "fsl_common.h"
+
+#endif /* FSL_COMMON_ARM_H_ */
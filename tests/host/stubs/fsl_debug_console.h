@@ -0,0 +1,27 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      fsl_debug_console.h
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Host Stub of The Debug Console, Errors Are Always Printed, Other Messages With -v.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           fsl_debug_console.h
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Host Stub of The Debug Console, Errors Are Always Printed, Other Messages With -v.
+ * ****************************/
+
+#ifndef FSL_DEBUG_CONSOLE_H_
+#define FSL_DEBUG_CONSOLE_H_
+
+#include <stdio.h>
+
+int HOST_Printf(const char *pcFormat, ...) __attribute__((format(printf, 1, 2)));
+
+#define PRINTF 							HOST_Printf
+
+#endif /* FSL_DEBUG_CONSOLE_H_ */
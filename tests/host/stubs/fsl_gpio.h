@@ -0,0 +1,36 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      fsl_gpio.h
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Host Stub of The GPIO Driver, LEDs Are Not Modelled.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           fsl_gpio.h
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Host Stub of The GPIO Driver, LEDs Are Not Modelled.
+ * ****************************/
+
+#ifndef FSL_GPIO_H_
+#define FSL_GPIO_H_
+
+#include <stdint.h>
+
+typedef struct
+{
+	uint32_t PDOR;
+} GPIO_Type;
+
+extern GPIO_Type g_axHostGpio[5];
+
+#define GPIO0 							(&g_axHostGpio[0])
+#define GPIO1 							(&g_axHostGpio[1])
+#define GPIO2 							(&g_axHostGpio[2])
+#define GPIO3 							(&g_axHostGpio[3])
+#define GPIO4 							(&g_axHostGpio[4])
+
+#endif /* FSL_GPIO_H_ */
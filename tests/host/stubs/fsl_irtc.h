@@ -0,0 +1,45 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      fsl_irtc.h
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Host Stub of The IRTC Driver, The Time Runs From The Host Clock.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           fsl_irtc.h
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Host Stub of The IRTC Driver, The Time Runs From The Host Clock.
+ * ****************************/
+
+#ifndef FSL_IRTC_H_
+#define FSL_IRTC_H_
+
+#include <stdint.h>
+
+typedef struct
+{
+	uint16_t year;
+	uint8_t month;
+	uint8_t day;
+	uint8_t weekDay;
+	uint8_t hour;
+	uint8_t minute;
+	uint8_t second;
+} irtc_datetime_t;
+
+typedef struct
+{
+	uint32_t u32Reserved;
+} RTC_Type;
+
+extern RTC_Type g_xHostRtc;
+
+#define RTC 							(&g_xHostRtc)
+
+void IRTC_GetDatetime(RTC_Type *base, irtc_datetime_t *datetime);
+
+#endif /* FSL_IRTC_H_ */
@@ -0,0 +1,31 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      fsl_ram_disk.h
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    RAM Disk Backend of FatFs (RAM_DISK_ENABLE), Optionally Loaded From And Saved To an Image File.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           fsl_ram_disk.h
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          RAM Disk Backend of FatFs (RAM_DISK_ENABLE), Optionally Loaded From And Saved To an Image File.
+ * ****************************/
+
+#ifndef FSL_RAM_DISK_H_
+#define FSL_RAM_DISK_H_
+
+#include <stdint.h>
+#include "ff.h"
+#include "diskio.h"
+
+DSTATUS ram_disk_status(BYTE pdrv);
+DSTATUS ram_disk_initialize(BYTE pdrv);
+DRESULT ram_disk_read(BYTE pdrv, BYTE *buff, LBA_t sector, UINT count);
+DRESULT ram_disk_write(BYTE pdrv, const BYTE *buff, LBA_t sector, UINT count);
+DRESULT ram_disk_ioctl(BYTE pdrv, BYTE cmd, void *buff);
+
+#endif /* FSL_RAM_DISK_H_ */
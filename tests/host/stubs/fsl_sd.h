@@ -0,0 +1,43 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      fsl_sd.h
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Host Stub of The SD Card Driver, Only The Fields Read By The Recorder.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           fsl_sd.h
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Host Stub of The SD Card Driver, Only The Fields Read By The Recorder.
+ * ****************************/
+
+#ifndef FSL_SD_H_
+#define FSL_SD_H_
+
+#include <stdint.h>
+
+typedef struct
+{
+	volatile uint32_t ADMA_ERR_STATUS;
+} USDHC_Type;
+
+typedef struct
+{
+	USDHC_Type *base;
+} usdhc_host_t;
+
+typedef struct
+{
+	usdhc_host_t hostController;
+} sdmmchost_t;
+
+typedef struct
+{
+	sdmmchost_t *host;
+} sd_card_t;
+
+#endif /* FSL_SD_H_ */
@@ -0,0 +1,33 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      fsl_sd_disk.h
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Host Stub of The SD Disk Glue, The SD Card Drive Is Served By The RAM Disk.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           fsl_sd_disk.h
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Host Stub of The SD Disk Glue, The SD Card Drive Is Served By The RAM Disk.
+ * ****************************/
+
+#ifndef FSL_SD_DISK_H_
+#define FSL_SD_DISK_H_
+
+#include "fsl_sd.h"
+#include "fsl_ram_disk.h"
+
+extern sd_card_t g_sd;
+
+/* SDDISK And RAMDISK Share One Medium, So The Raw Dump Writes And FatFs See The Same Sectors */
+#define sd_disk_status					ram_disk_status
+#define sd_disk_initialize				ram_disk_initialize
+#define sd_disk_read					ram_disk_read
+#define sd_disk_write					ram_disk_write
+#define sd_disk_ioctl					ram_disk_ioctl
+
+#endif /* FSL_SD_DISK_H_ */
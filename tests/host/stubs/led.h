@@ -0,0 +1,25 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      led.h
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Forwards <led.h> To The Application Header.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           led.h
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Forwards <led.h> To The Application Header.
+ * ****************************/
+
+#ifndef HOST_LED_H_
+#define HOST_LED_H_
+
+/* Included With Angle Brackets By record.h And record.c, application/include Cannot Be Searched For Those
+ * (Its time.h Would Hide <time.h>), So The Header Is Reached Relative To This Directory */
+#include "../../../application/include/led.h"
+
+#endif /* HOST_LED_H_ */
@@ -0,0 +1,23 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      pin_mux.h
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Host Stub, The Board Support Is Not Needed On The Host.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           pin_mux.h
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Host Stub, The Board Support Is Not Needed On The Host.
+ * ****************************/
+
+#ifndef PIN_MUX_H_
+#define PIN_MUX_H_
+
+#include "fsl_common.h"
+
+#endif /* PIN_MUX_H_ */
@@ -0,0 +1,23 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      queue.h
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Host Stub of The FreeRTOS Queues (Not Used By The Recording Core).
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           queue.h
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Host Stub of The FreeRTOS Queues (Not Used By The Recording Core).
+ * ****************************/
+
+#ifndef QUEUE_H_
+#define QUEUE_H_
+
+#include "FreeRTOS.h"
+
+#endif /* QUEUE_H_ */
@@ -0,0 +1,25 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      record.h
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Forwards <record.h> To The Application Header.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           record.h
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Forwards <record.h> To The Application Header.
+ * ****************************/
+
+#ifndef HOST_RECORD_H_
+#define HOST_RECORD_H_
+
+/* Included With Angle Brackets By record.h And record.c, application/include Cannot Be Searched For Those
+ * (Its time.h Would Hide <time.h>), So The Header Is Reached Relative To This Directory */
+#include "../../../application/include/record.h"
+
+#endif /* HOST_RECORD_H_ */
@@ -0,0 +1,23 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      rtc_ds3231.h
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Host Stub, The Board Support Is Not Needed On The Host.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           rtc_ds3231.h
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Host Stub, The Board Support Is Not Needed On The Host.
+ * ****************************/
+
+#ifndef RTC_DS3231_H_
+#define RTC_DS3231_H_
+
+#include "fsl_common.h"
+
+#endif /* RTC_DS3231_H_ */
@@ -0,0 +1,23 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      sdmmc_config.h
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Host Stub of The SDMMC Board Configuration.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           sdmmc_config.h
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Host Stub of The SDMMC Board Configuration.
+ * ****************************/
+
+#ifndef SDMMC_CONFIG_H_
+#define SDMMC_CONFIG_H_
+
+#define BOARD_SDMMC_DATA_BUFFER_ALIGN_SIZE		(32U)
+
+#endif /* SDMMC_CONFIG_H_ */
@@ -0,0 +1,44 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      semphr.h
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Host Stub of The FreeRTOS Semaphores And Mutexes.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           semphr.h
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Host Stub of The FreeRTOS Semaphores And Mutexes.
+ * ****************************/
+
+#ifndef SEMPHR_H_
+#define SEMPHR_H_
+
+#include <pthread.h>
+#include "FreeRTOS.h"
+
+typedef struct HostSemaphore
+{
+	pthread_mutex_t xLock;
+	pthread_cond_t 	xCond;
+	uint32_t 		u32Count;
+	uint32_t 		u32Max;
+	bool 			bDynamic;		/* Allocated By xSemaphoreCreate*, Freed On Delete	*/
+} StaticSemaphore_t;
+
+typedef struct HostSemaphore *SemaphoreHandle_t;
+
+SemaphoreHandle_t xSemaphoreCreateMutexStatic(StaticSemaphore_t *pxMutexBuffer);
+SemaphoreHandle_t xSemaphoreCreateBinaryStatic(StaticSemaphore_t *pxSemaphoreBuffer);
+SemaphoreHandle_t xSemaphoreCreateMutex(void);
+SemaphoreHandle_t xSemaphoreCreateBinary(void);
+BaseType_t xSemaphoreTake(SemaphoreHandle_t xSemaphore, TickType_t xBlockTime);
+BaseType_t xSemaphoreGive(SemaphoreHandle_t xSemaphore);
+BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t xSemaphore, BaseType_t *pxHigherPriorityTaskWoken);
+void vSemaphoreDelete(SemaphoreHandle_t xSemaphore);
+
+#endif /* SEMPHR_H_ */
@@ -0,0 +1,69 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      task.h
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Host Stub of The FreeRTOS Task API, Tasks Are Threads And Notifications Condition Variables.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           task.h
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Host Stub of The FreeRTOS Task API, Tasks Are Threads And Notifications Condition Variables.
+ * ****************************/
+
+#ifndef TASK_H_
+#define TASK_H_
+
+#include "FreeRTOS.h"
+
+typedef struct HostTask *TaskHandle_t;
+
+typedef enum
+{
+	eNoAction = 0,
+	eSetBits,
+	eIncrement,
+	eSetValueWithOverwrite,
+	eSetValueWithoutOverwrite
+} eNotifyAction;
+
+TickType_t xTaskGetTickCount(void);
+TickType_t xTaskGetTickCountFromISR(void);
+void vTaskDelay(TickType_t xTicksToDelay);
+BaseType_t xTaskNotifyWait(uint32_t ulBitsToClearOnEntry, uint32_t ulBitsToClearOnExit,
+						   uint32_t *pulNotificationValue, TickType_t xTicksToWait);
+BaseType_t xTaskNotify(TaskHandle_t xTaskToNotify, uint32_t ulValue, eNotifyAction eAction);
+BaseType_t xTaskNotifyFromISR(TaskHandle_t xTaskToNotify, uint32_t ulValue, eNotifyAction eAction,
+							  BaseType_t *pxHigherPriorityTaskWoken);
+uint32_t ulTaskNotifyTake(BaseType_t xClearCountOnExit, TickType_t xTicksToWait);
+
+#define xTaskNotifyGive(xTaskToNotify)	xTaskNotify((xTaskToNotify), 0UL, eIncrement)
+
+/* Interrupts Run In The Feeder Thread, a Critical Section Holds Them Off */
+void HOST_EnterCritical(void);
+void HOST_ExitCritical(void);
+
+#define taskENTER_CRITICAL()			HOST_EnterCritical()
+#define taskEXIT_CRITICAL()				HOST_ExitCritical()
+
+/**
+ * @brief 	Starts a Task As a Thread.
+ *
+ * @param 	pfTask Task Function.
+ * @param 	pvArg Argument.
+ *
+ * @return 	Handle, Used For Notifications And HOST_TaskJoin.
+ */
+TaskHandle_t HOST_TaskCreate(void (*pfTask)(void *), void *pvArg);
+
+/**
+ * @brief 	Waits Till The Task Function Returns.
+ * @details The Handle Stays Valid, a Timer Armed By The Task May Still Notify It.
+ */
+void HOST_TaskJoin(TaskHandle_t xTask);
+
+#endif /* TASK_H_ */
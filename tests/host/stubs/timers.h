@@ -0,0 +1,46 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      timers.h
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Host Stub of The FreeRTOS Software Timers, Served By One Timer Thread.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           timers.h
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Host Stub of The FreeRTOS Software Timers, Served By One Timer Thread.
+ * ****************************/
+
+#ifndef TIMERS_H_
+#define TIMERS_H_
+
+#include "FreeRTOS.h"
+
+typedef struct HostTimer *TimerHandle_t;
+typedef void (*TimerCallbackFunction_t)(TimerHandle_t xTimer);
+
+typedef struct HostTimer
+{
+	TimerCallbackFunction_t pfCallback;
+	void 					*pvTimerID;
+	TickType_t 				xPeriod;
+	TickType_t 				xExpiry;
+	bool 					bActive;
+	bool 					bAutoReload;
+	struct HostTimer 		*pxNext;
+} StaticTimer_t;
+
+TimerHandle_t xTimerCreateStatic(const char *pcTimerName, TickType_t xTimerPeriodInTicks, UBaseType_t uxAutoReload,
+								 void *pvTimerID, TimerCallbackFunction_t pxCallbackFunction,
+								 StaticTimer_t *pxTimerBuffer);
+BaseType_t xTimerStart(TimerHandle_t xTimer, TickType_t xTicksToWait);
+BaseType_t xTimerStop(TimerHandle_t xTimer, TickType_t xTicksToWait);
+BaseType_t xTimerChangePeriod(TimerHandle_t xTimer, TickType_t xNewPeriod, TickType_t xTicksToWait);
+BaseType_t xTimerIsTimerActive(TimerHandle_t xTimer);
+void *pvTimerGetTimerID(TimerHandle_t xTimer);
+
+#endif /* TIMERS_H_ */
@@ -0,0 +1,23 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      usb_disk_adapter.h
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Host Stub of The SD Card Power States.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           usb_disk_adapter.h
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Host Stub of The SD Card Power States.
+ * ****************************/
+
+#ifndef USB_DISK_ADAPTER_H_
+#define USB_DISK_ADAPTER_H_
+
+void USB_Disk_EnterStandby(void);
+
+#endif /* USB_DISK_ADAPTER_H_ */
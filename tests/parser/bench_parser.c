@@ -0,0 +1,114 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      bench_parser.c
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Host Benchmark of The Configuration File Parser.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           bench_parser.c
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Host Benchmark of The Configuration File Parser.
+ * ****************************/
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "parser.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/**
+ * @brief 	Size of The Generated Configuration File.
+ */
+#define BENCH_FILE_SIZE 			(256U * 1024U)
+
+/**
+ * @brief 	Number of Passes Over The File.
+ */
+#define BENCH_PASSES 				50U
+
+/*******************************************************************************
+ * Functions
+ ******************************************************************************/
+static double BENCH_Now(void)
+{
+	struct timespec xNow;
+
+	(void)clock_gettime(CLOCK_MONOTONIC, &xNow);
+	return (double)xNow.tv_sec + ((double)xNow.tv_nsec * 1e-9);
+}
+
+int main(void)
+{
+	static const char *apcLines[] =
+	{
+		"# Recorder Configuration\n",
+		"baudrate=115200\n",
+		"file_size = 32768 ; Rotation\n",
+		"stop_bits=1\n",
+		"data_bits=8\n",
+		"parity=none\n",
+		"\n",
+		"free_space=50\n",
+		"durability_ms=5000\r\n",
+	};
+	char *pcFile = malloc(BENCH_FILE_SIZE);
+	size_t size = 0U;
+	uint32_t u32Lines = 0UL;
+	double start;
+	double elapsed;
+
+	if (NULL == pcFile)
+	{
+		return 1;
+	}
+
+	while (true)
+	{
+		const char *pcLine = apcLines[u32Lines % (sizeof(apcLines) / sizeof(apcLines[0]))];
+		size_t length = strlen(pcLine);
+
+		if ((size + length) > BENCH_FILE_SIZE)
+		{
+			break;
+		}
+		(void)memcpy(&pcFile[size], pcLine, length);
+		size += length;
+		u32Lines++;
+	}
+
+	start = BENCH_Now();
+	for (uint32_t pass = 0U; pass < BENCH_PASSES; pass++)
+	{
+		/* Same Chunks As CONSOLELOG_ReadConfig Reads */
+		PARSER_Begin();
+		for (size_t offset = 0U; offset < size; offset += PARSER_CHUNK_SIZE)
+		{
+			size_t length = ((size - offset) < PARSER_CHUNK_SIZE) ? (size - offset) : PARSER_CHUNK_SIZE;
+			PARSER_Feed(&pcFile[offset], (uint32_t)length);
+		}
+		if (ERROR_NONE != PARSER_End())
+		{
+			fprintf(stderr, "ERR: Benchmark Input Rejected.\n");
+			free(pcFile);
+			return 1;
+		}
+	}
+	elapsed = BENCH_Now() - start;
+
+	printf("INFO: %zu B, %u Lines x %u Passes: %.1f MB/s, %.1f ns/Line.\n", size, u32Lines, BENCH_PASSES,
+		   ((double)size * BENCH_PASSES) / elapsed / 1e6, (elapsed * 1e9) / ((double)u32Lines * BENCH_PASSES));
+	free(pcFile);
+	return 0;
+}
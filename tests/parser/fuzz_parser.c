@@ -0,0 +1,205 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      fuzz_parser.c
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Host Fuzz Target of The Configuration File Parser.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           fuzz_parser.c
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Host Fuzz Target of The Configuration File Parser.
+ * ****************************/
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "parser.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/**
+ * @brief 	Number of Mutated Inputs In Standalone Mode Without Arguments.
+ */
+#define FUZZ_ITERATIONS 			200000UL
+
+/**
+ * @brief 	Maximal Size of a Mutated Input.
+ */
+#define FUZZ_MAX_INPUT 				1024U
+
+/*******************************************************************************
+ * Functions
+ ******************************************************************************/
+/**
+ * @brief 	Feeds The Input In Chunks of Given Size.
+ */
+static error_t FUZZ_Parse(const uint8_t *pu8Data, size_t size, size_t chunk, REC_config_t *pxConfig)
+{
+	error_t retVal;
+
+	PARSER_Begin();
+	for (size_t offset = 0U; offset < size; offset += chunk)
+	{
+		size_t length = ((size - offset) < chunk) ? (size - offset) : chunk;
+		PARSER_Feed((const char *)&pu8Data[offset], (uint32_t)length);
+	}
+	retVal = PARSER_End();
+	*pxConfig = PARSER_GetConfig();
+	return retVal;
+}
+
+/**
+ * @brief 	Checks Every Value Against Its Key Descriptor.
+ */
+static void FUZZ_CheckConfig(const REC_config_t *pxConfig)
+{
+	uint32_t u32Count;
+	const parser_key_t *pxKeys = PARSER_GetKeys(&u32Count);
+
+	if ((pxConfig->baudrate < pxKeys[0].u32Min) || (pxConfig->baudrate > pxKeys[0].u32Max) ||
+		(0UL == pxConfig->size) || (0UL != (pxConfig->size % 512UL)) ||
+		((kLPUART_OneStopBit != pxConfig->stop_bits) && (kLPUART_TwoStopBit != pxConfig->stop_bits)) ||
+		((kLPUART_SevenDataBits != pxConfig->data_bits) && (kLPUART_EightDataBits != pxConfig->data_bits)) ||
+		((kLPUART_ParityDisabled != pxConfig->parity) && (kLPUART_ParityEven != pxConfig->parity) &&
+		 (kLPUART_ParityOdd != pxConfig->parity)) ||
+		(0UL == pxConfig->fifo_size) || (0UL != (pxConfig->fifo_size % 512UL)) ||
+		(RECORD_ARENA_SIZE < pxConfig->fifo_size) ||
+		(0UL == pxConfig->block_size) || (0UL != (pxConfig->block_size % 512UL)) ||
+		(32768UL < pxConfig->block_size) ||
+		(10UL > pxConfig->flush_timeout_ms) || (0UL == pxConfig->led_interval_ms) ||
+		(7U < pxConfig->rx_watermark) ||
+		(pxConfig->max_bytes != ((pxConfig->baudrate / 1000UL) * pxConfig->led_interval_ms)))
+	{
+		fprintf(stderr, "ERR: Configuration Out of Range (baudrate %u, size %u).\n", pxConfig->baudrate, pxConfig->size);
+		abort();
+	}
+}
+
+static int FUZZ_SameConfig(const REC_config_t *pxA, const REC_config_t *pxB)
+{
+	return (pxA->version == pxB->version) && (pxA->baudrate == pxB->baudrate) &&
+		   (pxA->stop_bits == pxB->stop_bits) && (pxA->data_bits == pxB->data_bits) &&
+		   (pxA->parity == pxB->parity) && (pxA->size == pxB->size) && (pxA->max_bytes == pxB->max_bytes) &&
+		   (pxA->free_space_limit_mb == pxB->free_space_limit_mb) && (pxA->durability_ms == pxB->durability_ms) &&
+		   (pxA->mode == pxB->mode) &&
+		   (pxA->fifo_size == pxB->fifo_size) && (pxA->block_size == pxB->block_size) &&
+		   (pxA->flush_timeout_ms == pxB->flush_timeout_ms) && (pxA->led_interval_ms == pxB->led_interval_ms) &&
+		   (pxA->rx_watermark == pxB->rx_watermark);
+}
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+	REC_config_t xWhole;
+	REC_config_t xChunked;
+	error_t wholeErr;
+	error_t chunkedErr;
+	/* First Byte Selects The Chunk Size, So Lines Split At Every Position Are Covered */
+	size_t chunk = (0U != size) ? ((size_t)(data[0] % PARSER_CHUNK_SIZE) + 1U) : 1U;
+
+	wholeErr 	= FUZZ_Parse(data, size, (0U != size) ? size : 1U, &xWhole);
+	chunkedErr 	= FUZZ_Parse(data, size, chunk, &xChunked);
+
+	FUZZ_CheckConfig(&xWhole);
+	if ((wholeErr != chunkedErr) || !FUZZ_SameConfig(&xWhole, &xChunked))
+	{
+		fprintf(stderr, "ERR: Result Depends On Chunk Size %zu.\n", chunk);
+		abort();
+	}
+	return 0;
+}
+
+#if defined(PARSER_FUZZ_STANDALONE)
+/**
+ * @brief 	Pseudo-Random Generator of The Standalone Mutator (xorshift32).
+ */
+static uint32_t FUZZ_Random(void)
+{
+	static uint32_t u32State = 0x2545F491UL;
+
+	u32State ^= u32State << 13;
+	u32State ^= u32State >> 17;
+	u32State ^= u32State << 5;
+	return u32State;
+}
+
+/**
+ * @brief 	Runs The Target Without libFuzzer: On The Given Files, Or On Mutations of a Built-In Seed.
+ */
+int main(int argc, char **argv)
+{
+	static const char acSeed[] = "baudrate=115200\nfile_size=2048\nstop_bits=1\ndata_bits=8\nparity=none\n"
+								 "# comment\nfree_space=50 ; trailing\r\ndurability_ms=5000\n"
+								 "mode=binary\n";
+	static const char acAlphabet[] = "=#;\r\n\t 0123456789abdefilnoprstuyz_\xFF";
+	uint8_t au8Input[FUZZ_MAX_INPUT];
+
+	if (argc > 1)
+	{
+		for (int i = 1; i < argc; i++)
+		{
+			FILE *pFile = fopen(argv[i], "rb");
+			size_t size;
+
+			if (NULL == pFile)
+			{
+				fprintf(stderr, "ERR: Failed To Open %s.\n", argv[i]);
+				return 1;
+			}
+			size = fread(au8Input, 1U, sizeof(au8Input), pFile);
+			(void)fclose(pFile);
+			(void)LLVMFuzzerTestOneInput(au8Input, size);
+		}
+		printf("INFO: %d Input(s) Passed.\n", argc - 1);
+		return 0;
+	}
+
+	for (uint32_t n = 0UL; n < FUZZ_ITERATIONS; n++)
+	{
+		size_t size = sizeof(acSeed) - 1U;
+		uint32_t u32Mutations = (FUZZ_Random() % 8UL) + 1UL;
+
+		(void)memcpy(au8Input, acSeed, size);
+		for (uint32_t m = 0UL; m < u32Mutations; m++)
+		{
+			uint32_t u32Pos = FUZZ_Random() % (uint32_t)size;
+			uint8_t u8Char = ((FUZZ_Random() & 1UL) != 0UL) ? (uint8_t)FUZZ_Random() :
+							 (uint8_t)acAlphabet[FUZZ_Random() % (sizeof(acAlphabet) - 1U)];
+
+			switch (FUZZ_Random() % 3UL)
+			{
+				case 0UL: 	/* Replace */
+					au8Input[u32Pos] = u8Char;
+					break;
+				case 1UL: 	/* Insert, Long Lines Included */
+					if (size < sizeof(au8Input))
+					{
+						(void)memmove(&au8Input[u32Pos + 1U], &au8Input[u32Pos], size - u32Pos);
+						au8Input[u32Pos] = u8Char;
+						size++;
+					}
+					break;
+				default: 	/* Delete */
+					if (size > 1U)
+					{
+						(void)memmove(&au8Input[u32Pos], &au8Input[u32Pos + 1U], size - u32Pos - 1U);
+						size--;
+					}
+					break;
+			}
+		}
+		(void)LLVMFuzzerTestOneInput(au8Input, size);
+	}
+	printf("INFO: %lu Mutated Inputs Passed.\n", FUZZ_ITERATIONS);
+	return 0;
+}
+#endif /* defined(PARSER_FUZZ_STANDALONE) */
@@ -0,0 +1,30 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      fsl_debug_console.h
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Host Stub of The Debug Console.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           fsl_debug_console.h
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Host Stub of The Debug Console.
+ * ****************************/
+
+#ifndef FSL_DEBUG_CONSOLE_H_
+#define FSL_DEBUG_CONSOLE_H_
+
+#include <stdio.h>
+
+/* Messages Are Printed Only With HOST_VERBOSE, The Fuzzer And Benchmark Run Quiet */
+#if defined(HOST_VERBOSE)
+#define PRINTF(...) 	((void)printf(__VA_ARGS__))
+#else
+#define PRINTF(...) 	((void)(0 && printf(__VA_ARGS__)))
+#endif /* defined(HOST_VERBOSE) */
+
+#endif /* FSL_DEBUG_CONSOLE_H_ */
@@ -0,0 +1,41 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      fsl_lpuart.h
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Host Stub of The LPUART Driver Types Used By The Parser.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           fsl_lpuart.h
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Host Stub of The LPUART Driver Types Used By The Parser.
+ * ****************************/
+
+#ifndef FSL_LPUART_H_
+#define FSL_LPUART_H_
+
+/* Values Match The MCUXpresso SDK Driver */
+typedef enum
+{
+	kLPUART_ParityDisabled 	= 0x0U,
+	kLPUART_ParityEven 		= 0x2U,
+	kLPUART_ParityOdd 		= 0x3U
+} lpuart_parity_mode_t;
+
+typedef enum
+{
+	kLPUART_EightDataBits 	= 0x0U,
+	kLPUART_SevenDataBits 	= 0x1U
+} lpuart_data_bits_t;
+
+typedef enum
+{
+	kLPUART_OneStopBit 		= 0U,
+	kLPUART_TwoStopBit 		= 1U
+} lpuart_stop_bit_count_t;
+
+#endif /* FSL_LPUART_H_ */
@@ -0,0 +1,103 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      FreeRTOSConfig.h
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    FreeRTOS Configuration of The Linux Simulator, Follows application/configuration/freertos.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           FreeRTOSConfig.h
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          FreeRTOS Configuration of The Linux Simulator, Follows application/configuration/freertos.
+ * ****************************/
+
+#ifndef FREERTOS_CONFIG_H
+#define FREERTOS_CONFIG_H
+
+/*-----------------------------------------------------------
+ * Same Kernel Features, Priorities And Tick As The Firmware. Differences Come From The POSIX Port:
+ * - No Tickless Idle, The Tick Is a SIGALRM Interval Timer.
+ * - Each Task Is a pthread, The Idle And Timer Task Stacks Must Hold PTHREAD_STACK_MIN.
+ * - The Run-Time Counter Is Supplied By The Port (portGET_RUN_TIME_COUNTER_VALUE), Not By CTIMER1.
+ * - No Cortex-M Interrupt Priorities, Interrupts Are Served By The Interrupt Task of sim_irq.c.
+ *----------------------------------------------------------*/
+
+#define configUSE_PREEMPTION                    1
+#define configUSE_TICKLESS_IDLE                 0
+#define configCPU_CLOCK_HZ                      (SystemCoreClock)
+#define configTICK_RATE_HZ                      ((TickType_t)200)
+#define configMAX_PRIORITIES                    6
+#define configMINIMAL_STACK_SIZE                ((unsigned short)(16384U / sizeof(portSTACK_TYPE)))
+#define configMAX_TASK_NAME_LEN                 20
+#define configTICK_TYPE_WIDTH_IN_BITS           TICK_TYPE_WIDTH_32_BITS
+#define configIDLE_SHOULD_YIELD                 1
+#define configUSE_TASK_NOTIFICATIONS            1
+#define configUSE_MUTEXES                       1
+#define configUSE_RECURSIVE_MUTEXES             1
+#define configUSE_COUNTING_SEMAPHORES           1
+#define configQUEUE_REGISTRY_SIZE               8
+#define configUSE_QUEUE_SETS                    0
+#define configUSE_TIME_SLICING                  0
+#define configUSE_NEWLIB_REENTRANT              0
+#define configENABLE_BACKWARD_COMPATIBILITY     0
+#define configNUM_THREAD_LOCAL_STORAGE_POINTERS 5
+
+/* Memory allocation related definitions. */
+#define configSUPPORT_STATIC_ALLOCATION         1
+#define configSUPPORT_DYNAMIC_ALLOCATION        1
+#define configTOTAL_HEAP_SIZE                   ((size_t)(32 * 1024)) /* Kernel Objects Are Larger With 64-Bit Pointers */
+#define configAPPLICATION_ALLOCATED_HEAP        0
+
+/* Hook function related definitions. */
+#define configUSE_IDLE_HOOK                     0
+#define configUSE_TICK_HOOK                     0
+#define configCHECK_FOR_STACK_OVERFLOW          2
+#define configUSE_MALLOC_FAILED_HOOK            0
+#define configUSE_DAEMON_TASK_STARTUP_HOOK      0
+
+/* Run time and task stats gathering related definitions. */
+#define configGENERATE_RUN_TIME_STATS           1
+#define configUSE_TRACE_FACILITY                1
+#define configUSE_STATS_FORMATTING_FUNCTIONS    0
+#define configRECORD_STACK_HIGH_ADDRESS         1
+
+/* Co-routine related definitions. */
+#define configUSE_CO_ROUTINES                   0
+#define configMAX_CO_ROUTINE_PRIORITIES         2
+
+/* Software timer related definitions. */
+#define configUSE_TIMERS                        1
+#define configTIMER_TASK_PRIORITY               (configMAX_PRIORITIES - 2)
+#define configTIMER_QUEUE_LENGTH                10
+#define configTIMER_TASK_STACK_DEPTH            (configMINIMAL_STACK_SIZE * 2)
+
+/* A Failed Assertion Ends The Run With The Location (sim_board.c) */
+void SIM_Assert(const char *pcFile, int iLine);
+#define configASSERT(x)                         if ((x) == 0) { SIM_Assert(__FILE__, __LINE__); }
+
+/* Optional functions - most linkers will remove unused functions anyway. */
+#define INCLUDE_vTaskPrioritySet                1
+#define INCLUDE_uxTaskPriorityGet               1
+#define INCLUDE_vTaskDelete                     1
+#define INCLUDE_vTaskSuspend                    1
+#define INCLUDE_vTaskDelayUntil                 1
+#define INCLUDE_vTaskDelay                      1
+#define INCLUDE_xTaskGetSchedulerState          1
+#define INCLUDE_xTaskGetCurrentTaskHandle       1
+#define INCLUDE_uxTaskGetStackHighWaterMark     0
+#define INCLUDE_xTaskGetIdleTaskHandle          0
+#define INCLUDE_eTaskGetState                   0
+#define INCLUDE_xTimerPendFunctionCall          1
+#define INCLUDE_xTaskAbortDelay                 0
+#define INCLUDE_xTaskGetHandle                  0
+#define INCLUDE_xTaskResumeFromISR              1
+
+/* Clock manager provides in this variable system core clock frequency */
+#include <stdint.h>
+extern uint32_t SystemCoreClock;
+
+#endif /* FREERTOS_CONFIG_H */
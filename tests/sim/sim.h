@@ -0,0 +1,270 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      sim.h
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Linux Simulator of The Whole Firmware: Peripheral Models And The Scenario of Timed Events.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           sim.h
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Linux Simulator of The Whole Firmware: Peripheral Models And The Scenario of Timed Events.
+ * ****************************/
+
+#ifndef SIM_H_
+#define SIM_H_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "fsl_common.h"
+#include "error.h"
+
+/*******************************************************************************
+ * Global Definitions
+ ******************************************************************************/
+/**
+ * @brief 	Core Clock of The MCXN947 (PLL0 At 150 MHz), Drives DWT->CYCCNT.
+ */
+#define SIM_CORE_CLOCK_HZ			150000000UL
+
+/**
+ * @brief 	Functional Clocks of LP_FLEXCOMM3 And CTIMER4 (FRO_HF), CTIMER1 (FRO 12M).
+ */
+#define SIM_FRO_HF_CLOCK_HZ			48000000UL
+#define SIM_FRO_12M_CLOCK_HZ		12000000UL
+
+/**
+ * @brief 	Default Size of a New Card Image In MB.
+ */
+#define SIM_CARD_DEFAULT_MB			64UL
+
+/**
+ * @brief 	Sector Size of The Card.
+ */
+#define SIM_CARD_SECTOR_SIZE		512U
+
+/**
+ * @brief 	Default Latency Model of The Card: Cost of One Command And of Each Transferred Sector.
+ * @details Same As The Host Benchmark (tests/host), Roughly a Class 10 Card In 4-Bit Mode At 50 MHz.
+ */
+#define SIM_CARD_DEFAULT_CMD_US		250UL
+#define SIM_CARD_DEFAULT_SECTOR_US	25UL
+
+/**
+ * @brief 	Maximal Number of Scenario Events And Length of Their Argument.
+ */
+#define SIM_MAX_EVENTS				64U
+#define SIM_ARG_SIZE				256U
+
+/**
+ * @brief 	Priority of The Interrupt Task, Same As The Emergency Task (Nothing Runs Above It).
+ */
+#define SIM_IRQ_TASK_PRIO			(configMAX_PRIORITIES - 1)
+
+/**
+ * @brief 	Events of The Scenario.
+ */
+typedef enum
+{
+	SIM_EVENT_UART = 0,				/*<! Puts The Content of a File On The RX Line		*/
+	SIM_EVENT_TRACE,				/*<! Replays a Timed Trace On The RX Line			*/
+	SIM_EVENT_ATTACH,				/*<! Plugs The USB Cable In (VBUS Session Valid)	*/
+	SIM_EVENT_DETACH,				/*<! Unplugs The USB Cable							*/
+	SIM_EVENT_PWRLOSS,				/*<! Supply Falls Below The Comparator Threshold	*/
+	SIM_EVENT_QUIT					/*<! Ends The Run With The Supply Still On			*/
+} sim_event_type_t;
+
+/**
+ * @brief 	One Timed Event of The Scenario.
+ */
+typedef struct
+{
+	uint64_t u64AtUs;				/*<! Time Since Start of The Scheduler				*/
+	sim_event_type_t eType;
+	uint32_t u32Value;				/*<! Hold-Up Time of SIM_EVENT_PWRLOSS (us)			*/
+	char acArg[SIM_ARG_SIZE];		/*<! File of SIM_EVENT_UART And SIM_EVENT_TRACE		*/
+} sim_event_t;
+
+/**
+ * @brief 	Statistics of The RX Line of LPUART3.
+ */
+typedef struct
+{
+	uint64_t u64Sent;				/*<! Bytes Put On The Line							*/
+	uint64_t u64Received;			/*<! Bytes Latched Into DATA						*/
+	uint64_t u64Overruns;			/*<! Bytes Lost, DATA Was Not Read In Time			*/
+	uint64_t u64Dropped;			/*<! Bytes Lost, Receiver Off or Baud Rate Differs	*/
+} sim_uart_stats_t;
+
+/**
+ * @brief 	Statistics of The Card.
+ */
+typedef struct
+{
+	uint64_t u64Reads;				/*<! Read Commands									*/
+	uint64_t u64Writes;				/*<! Write Commands									*/
+	uint64_t u64SectorsRead;		/*<! Sectors Read									*/
+	uint64_t u64SectorsWritten;		/*<! Sectors Written								*/
+	uint64_t u64BusyUs;				/*<! Time Spent In The Latency Model				*/
+	uint64_t u64Rejected;			/*<! Commands Issued After The Power Cut			*/
+} sim_card_stats_t;
+
+/**
+ * @brief 	Verbose Output of PRINTF (INFO And DEBUG Lines), ERR Lines Are Always Printed.
+ */
+extern bool g_bSimVerbose;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+/**
+ * @brief 	Monotonic Time Since The First Call In Microseconds.
+ */
+uint64_t SIM_NowUs(void);
+
+/**
+ * @brief 	Creates The Interrupt Task, Which Runs The Scenario And Serves The Peripheral Models Every Tick.
+ * @details Called From main Before The Firmware Starts The Scheduler.
+ *
+ * @param 	pxEvents Scenario, Sorted By Time.
+ * @param 	u32Events Number of Events.
+ *
+ * @return 	ERROR_NONE If The Task Was Created.
+ */
+error_t SIM_IrqStart(const sim_event_t *pxEvents, uint32_t u32Events);
+
+/**
+ * @brief 	Requests an Interrupt, The Handler Runs In The Interrupt Task Once The Line Is Enabled (NVIC).
+ *
+ * @param 	eIrq Interrupt.
+ */
+void SIM_IrqSetPending(IRQn_Type eIrq);
+
+/**
+ * @brief 	Runs The Handlers of Pending And Enabled Interrupts, Called Only From The Interrupt Task.
+ */
+void SIM_IrqDispatch(void);
+
+/**
+ * @brief 	Sets The Baud Rate And Frame of The Sender On The RX Line.
+ *
+ * @param 	u32Baud Baud Rate, The Receiver Drops The Bytes If It Runs At a Different One.
+ */
+void SIM_UartSetSender(uint32_t u32Baud);
+
+/**
+ * @brief 	Queues The Content of a File On The RX Line, It Follows The Data Queued Before.
+ *
+ * @param 	pcPath File.
+ *
+ * @return 	ERROR_NONE If The File Was Read.
+ */
+error_t SIM_UartSend(const char *pcPath);
+
+/**
+ * @brief 	Queues a Trace On The RX Line, Each Record Starts No Earlier Than Its Time After u64BaseUs.
+ * @details Format of tests/functional_tests/uart_trace.py: Header, Optional "baud N" Which Sets The Sender,
+ * 			Then "T_US HEX" Records. Bytes of a Record Follow Back-To-Back.
+ *
+ * @param 	pcPath Trace File.
+ * @param 	u64BaseUs Time (SIM_NowUs) To Which The Record Times Are Added.
+ *
+ * @return 	ERROR_NONE If The Trace Was Read.
+ */
+error_t SIM_UartSendTrace(const char *pcPath, uint64_t u64BaseUs);
+
+/**
+ * @brief 	Puts The Bytes Due By Now On The Line, Called Every Tick From The Interrupt Task.
+ *
+ * @param 	u64NowUs Current Time.
+ */
+void SIM_UartPoll(uint64_t u64NowUs);
+
+/**
+ * @brief 	Checks Whether All Queued Bytes Were Put On The Line.
+ */
+bool SIM_UartIdle(void);
+
+/**
+ * @brief 	Returns The Statistics of The RX Line.
+ *
+ * @param 	pxStats Statistics.
+ */
+void SIM_UartStats(sim_uart_stats_t *pxStats);
+
+/**
+ * @brief 	Fires The Match Interrupt of CTIMER4 Once Its Period Elapsed, Called Every Tick.
+ *
+ * @param 	u64NowUs Current Time.
+ */
+void SIM_CtimerPoll(uint64_t u64NowUs);
+
+/**
+ * @brief 	Drops The Supply Below The Threshold of CMP1, The Falling Edge Requests HSCMP1_IRQn If Armed.
+ */
+void SIM_CmpTrip(void);
+
+/**
+ * @brief 	Opens The Card Image, a Missing Image Is Created Empty (Unformatted).
+ *
+ * @param 	pcPath Image File.
+ * @param 	u32SizeMB Size of a New Image.
+ *
+ * @return 	ERROR_NONE If The Image Is Open.
+ */
+error_t SIM_CardOpen(const char *pcPath, uint32_t u32SizeMB);
+
+/**
+ * @brief 	Sets The Latency Model of The Card, Zeros Make It Run At File Speed.
+ *
+ * @param 	u32CmdUs Cost of One Read or Write Command In Microseconds.
+ * @param 	u32SectorUs Cost of Each Transferred Sector In Microseconds.
+ */
+void SIM_CardSetLatency(uint32_t u32CmdUs, uint32_t u32SectorUs);
+
+/**
+ * @brief 	Cuts The Power of The Card, Every Later Command Fails And Nothing More Reaches The Image.
+ */
+void SIM_CardPowerCut(void);
+
+/**
+ * @brief 	Returns The Statistics of The Card.
+ *
+ * @param 	pxStats Statistics.
+ */
+void SIM_CardStats(sim_card_stats_t *pxStats);
+
+/**
+ * @brief 	Closes The Card Image.
+ */
+void SIM_CardClose(void);
+
+/**
+ * @brief 	Plugs or Unplugs The USB Cable, The Change of The Session Requests USB1_HS_IRQn.
+ *
+ * @param 	bAttached True If The Cable Is Plugged In.
+ */
+void SIM_UsbSetAttached(bool bAttached);
+
+/**
+ * @brief 	Sets The Time Held By The External DS3231, From Which The Firmware Sets The IRTC At Boot.
+ *
+ * @param 	i64Epoch Calendar Time In Seconds Since 1970 (Read As Local Time).
+ */
+void SIM_RtcSet(int64_t i64Epoch);
+
+/**
+ * @brief 	Prints The Statistics of The Run And Ends The Process.
+ *
+ * @param 	iStatus Exit Status.
+ */
+void SIM_Exit(int iStatus);
+
+#endif /* SIM_H_ */
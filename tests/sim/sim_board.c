@@ -0,0 +1,509 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      sim_board.c
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Simulator Models of The Board: Clocks, Pins, GPIO, RTCs, Timers, Comparator And The Debug Console.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           sim_board.c
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Simulator Models of The Board: Clocks, Pins, GPIO, RTCs, Timers, Comparator And The Debug Console.
+ * ****************************/
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "fsl_common.h"
+#include "fsl_clock.h"
+#include "fsl_gpio.h"
+#include "fsl_edma.h"
+#include "fsl_spc.h"
+#include "fsl_irtc.h"
+#include "fsl_lpcmp.h"
+#include "fsl_ctimer.h"
+#include "fsl_debug_console.h"
+#include "rtc_ds3231.h"
+#include "board.h"
+#include "pin_mux.h"
+#include "clock_config.h"
+
+#include "sim.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/**
+ * @brief 	Number of CTIMER Instances.
+ */
+#define SIM_CTIMER_COUNT			5U
+
+/*******************************************************************************
+ * Global Variables
+ ******************************************************************************/
+bool g_bSimVerbose 					= false;
+uint32_t SystemCoreClock 			= SIM_CORE_CLOCK_HZ;
+
+DCB_Type g_xSimDcb;
+GPIO_Type g_axSimGpio[5];
+DMA_Type g_axSimDma[2];
+SPC_Type g_xSimSpc;
+RTC_Type g_xSimRtc;
+LPCMP_Type g_xSimCmp1;
+
+/**
+ * @brief 	Timers And Their Functional Clocks (CTIMER1 FRO 12M For Run-Time Stats, CTIMER4 FRO_HF For Power Loss).
+ */
+static CTIMER_Type g_axSimCtimer[SIM_CTIMER_COUNT];
+static const uint32_t g_au32SimCtimerClock[SIM_CTIMER_COUNT] =
+{
+	SIM_FRO_HF_CLOCK_HZ, SIM_FRO_12M_CLOCK_HZ, SIM_FRO_12M_CLOCK_HZ, SIM_FRO_12M_CLOCK_HZ, SIM_FRO_HF_CLOCK_HZ
+};
+
+/**
+ * @brief 	Cycle Counter, Refreshed On Each Access.
+ */
+static DWT_Type g_xSimDwt;
+
+/**
+ * @brief 	Start of The Monotonic Time.
+ */
+static struct timespec g_xSimEpoch;
+static bool g_bSimEpochSet 			= false;
+
+/**
+ * @brief 	Calendar Time of The DS3231 Minus The Monotonic Time (Microseconds), Host Local Time If Not Set.
+ */
+static int64_t g_i64SimDs3231OffsetUs = 0LL;
+static bool g_bSimDs3231Set 		= false;
+
+/*******************************************************************************
+ * Time
+ ******************************************************************************/
+uint64_t SIM_NowUs(void)
+{
+	struct timespec xNow;
+
+	(void)clock_gettime(CLOCK_MONOTONIC, &xNow);
+	if (!g_bSimEpochSet)
+	{
+		/* First Call Comes From main Before The Scheduler Starts */
+		g_xSimEpoch = xNow;
+		g_bSimEpochSet = true;
+	}
+	return ((uint64_t)(xNow.tv_sec - g_xSimEpoch.tv_sec) * 1000000ULL) +
+		   (uint64_t)((xNow.tv_nsec - g_xSimEpoch.tv_nsec) / 1000L);
+}
+
+DWT_Type *SIM_Dwt(void)
+{
+	g_xSimDwt.CYCCNT = (uint32_t)(SIM_NowUs() * (SystemCoreClock / 1000000UL));
+	return &g_xSimDwt;
+}
+
+void SDK_DelayAtLeastUs(uint32_t delayTime_us, uint32_t coreClock_Hz)
+{
+	uint64_t u64End = SIM_NowUs() + delayTime_us;
+
+	(void)coreClock_Hz;
+	while (SIM_NowUs() < u64End)
+	{
+	}
+}
+
+/*******************************************************************************
+ * Clocks, Power And Pins
+ ******************************************************************************/
+void CLOCK_SetClkDiv(clock_div_name_t div_name, uint32_t value)
+{
+	(void)div_name;
+	(void)value;
+}
+
+void CLOCK_AttachClk(clock_attach_id_t connection)
+{
+	(void)connection;
+}
+
+void CLOCK_EnableClock(clock_ip_name_t clk)
+{
+	(void)clk;
+}
+
+status_t CLOCK_SetupExtClocking(uint32_t iFreq)
+{
+	(void)iFreq;
+	return kStatus_Success;
+}
+
+status_t CLOCK_SetupClk16KClocking(uint32_t clk_16k_enable_mask)
+{
+	(void)clk_16k_enable_mask;
+	return kStatus_Success;
+}
+
+uint32_t CLOCK_GetCTimerClkFreq(uint32_t id)
+{
+	return (id < SIM_CTIMER_COUNT) ? g_au32SimCtimerClock[id] : 0UL;
+}
+
+uint32_t CLOCK_GetCoreSysClkFreq(void)
+{
+	return SystemCoreClock;
+}
+
+void BOARD_InitBootClocks(void)
+{
+}
+
+void BOARD_InitPins(void)
+{
+}
+
+void BOARD_InitDebugConsole(void)
+{
+}
+
+void BOARD_PowerMode_OD(void)
+{
+}
+
+void BOARD_USB_Disk_Config(uint32_t intPriority)
+{
+	(void)intPriority;
+}
+
+void LPI2C2_DeinitPins(void)
+{
+}
+
+status_t SPC_EnableActiveModeAnalogModules(SPC_Type *base, uint32_t maskValue)
+{
+	base->u32Analog |= maskValue;
+	return kStatus_Success;
+}
+
+void EDMA_Init(DMA_Type *base, const edma_config_t *config)
+{
+	(void)base;
+	(void)config;
+}
+
+void GPIO_PortToggle(GPIO_Type *base, uint32_t mask)
+{
+	base->PDOR ^= mask;
+}
+
+/*******************************************************************************
+ * IRTC And DS3231
+ ******************************************************************************/
+/**
+ * @brief 	Host Local Time Read As Calendar Time, Like a DS3231 Set By Hand.
+ */
+static int64_t SIM_LocalEpoch(void)
+{
+	time_t xNow = time(NULL);
+	struct tm xTm;
+
+	(void)localtime_r(&xNow, &xTm);
+	return (int64_t)timegm(&xTm);
+}
+
+/**
+ * @brief 	Calendar Time of The DS3231 In Seconds.
+ */
+static int64_t SIM_Ds3231Epoch(void)
+{
+	if (!g_bSimDs3231Set)
+	{
+		return SIM_LocalEpoch();
+	}
+	return (g_i64SimDs3231OffsetUs + (int64_t)SIM_NowUs()) / 1000000LL;
+}
+
+void SIM_RtcSet(int64_t i64Epoch)
+{
+	g_i64SimDs3231OffsetUs 	= (i64Epoch * 1000000LL) - (int64_t)SIM_NowUs();
+	g_bSimDs3231Set 		= true;
+}
+
+uint8_t RTC_Init(void)
+{
+	return (uint8_t)ERROR_NONE;
+}
+
+void RTC_Deinit(void)
+{
+}
+
+uint8_t RTC_GetState(void)
+{
+	/* Backup Battery Kept The Oscillator Running */
+	return 1U;
+}
+
+void RTC_SetOscState(RTC_osc_state_t state)
+{
+	(void)state;
+}
+
+void RTC_SetTime(RTC_time_t *pTime)
+{
+	(void)pTime;
+}
+
+void RTC_SetDate(RTC_date_t *pDate)
+{
+	(void)pDate;
+}
+
+void RTC_GetTime(RTC_time_t *pTime)
+{
+	time_t xEpoch = (time_t)SIM_Ds3231Epoch();
+	struct tm xTm;
+
+	(void)gmtime_r(&xEpoch, &xTm);
+	pTime->format 	= 0U;
+	pTime->sec 		= (uint8_t)xTm.tm_sec;
+	pTime->min 		= (uint8_t)xTm.tm_min;
+	pTime->hrs 		= (uint8_t)xTm.tm_hour;
+}
+
+void RTC_GetDate(RTC_date_t *pDate)
+{
+	time_t xEpoch = (time_t)SIM_Ds3231Epoch();
+	struct tm xTm;
+
+	(void)gmtime_r(&xEpoch, &xTm);
+	/* DS3231 Counts The Week Days From 1 (Sunday) */
+	pDate->date 	= (uint8_t)xTm.tm_mday;
+	pDate->day 		= (uint8_t)(xTm.tm_wday + 1);
+	pDate->month 	= (uint8_t)(xTm.tm_mon + 1);
+	pDate->year 	= (uint8_t)(xTm.tm_year - 100);
+}
+
+void RTC_SetTimeDefault(RTC_time_t *pTime)
+{
+	(void)memset(pTime, 0, sizeof(RTC_time_t));
+}
+
+void RTC_SetDateDefault(RTC_date_t *pDate)
+{
+	pDate->date 	= 1U;
+	pDate->day 		= 1U;
+	pDate->month 	= 1U;
+	pDate->year 	= 0U;
+}
+
+status_t IRTC_Init(RTC_Type *base, const irtc_config_t *config)
+{
+	(void)config;
+	base->bRunning = false;
+	return kStatus_Success;
+}
+
+status_t IRTC_SetDatetime(RTC_Type *base, const irtc_datetime_t *datetime)
+{
+	struct tm xTm;
+
+	(void)memset(&xTm, 0, sizeof(xTm));
+	xTm.tm_year 	= (int)datetime->year - 1900;
+	xTm.tm_mon 		= (int)datetime->month - 1;
+	xTm.tm_mday 	= (int)datetime->day;
+	xTm.tm_hour 	= (int)datetime->hour;
+	xTm.tm_min 		= (int)datetime->minute;
+	xTm.tm_sec 		= (int)datetime->second;
+
+	base->i64OffsetUs 	= ((int64_t)timegm(&xTm) * 1000000LL) - (int64_t)SIM_NowUs();
+	base->bRunning 		= true;
+	return kStatus_Success;
+}
+
+void IRTC_GetDatetime(RTC_Type *base, irtc_datetime_t *datetime)
+{
+	time_t xEpoch = (time_t)((base->i64OffsetUs + (int64_t)SIM_NowUs()) / 1000000LL);
+	struct tm xTm;
+
+	(void)gmtime_r(&xEpoch, &xTm);
+	datetime->year 		= (uint16_t)(xTm.tm_year + 1900);
+	datetime->month 	= (uint8_t)(xTm.tm_mon + 1);
+	datetime->day 		= (uint8_t)xTm.tm_mday;
+	datetime->weekDay 	= (uint8_t)xTm.tm_wday;
+	datetime->hour 		= (uint8_t)xTm.tm_hour;
+	datetime->minute 	= (uint8_t)xTm.tm_min;
+	datetime->second 	= (uint8_t)xTm.tm_sec;
+}
+
+/*******************************************************************************
+ * CTIMER
+ ******************************************************************************/
+CTIMER_Type *SIM_Ctimer(uint32_t u32Index)
+{
+	CTIMER_Type *pxTimer = &g_axSimCtimer[u32Index];
+	uint64_t u64Ticks;
+
+	if (pxTimer->bRunning)
+	{
+		u64Ticks = ((SIM_NowUs() - pxTimer->u64StartUs) * g_au32SimCtimerClock[u32Index]) / 1000000ULL;
+		pxTimer->TC = (uint32_t)(u64Ticks / ((uint64_t)pxTimer->u32Prescale + 1ULL));
+	}
+	return pxTimer;
+}
+
+void CTIMER_GetDefaultConfig(ctimer_config_t *config)
+{
+	(void)memset(config, 0, sizeof(ctimer_config_t));
+}
+
+void CTIMER_Init(CTIMER_Type *base, const ctimer_config_t *config)
+{
+	base->u32Prescale 	= config->prescale;
+	base->u32Match 		= 0UL;
+	base->bMatchIrq 	= false;
+	base->bRunning 		= false;
+	base->u32Stat 		= 0UL;
+	base->TC 			= 0UL;
+}
+
+void CTIMER_SetupMatch(CTIMER_Type *base, ctimer_match_t matchChannel, const ctimer_match_config_t *config)
+{
+	/* Only Match 0 Is Used, It Resets The Counter */
+	(void)matchChannel;
+	base->u32Match 	= config->matchValue;
+	base->bMatchIrq = config->enableInterrupt;
+}
+
+void CTIMER_StartTimer(CTIMER_Type *base)
+{
+	base->u64StartUs 	= SIM_NowUs();
+	base->bRunning 		= true;
+}
+
+void CTIMER_StopTimer(CTIMER_Type *base)
+{
+	base->bRunning = false;
+}
+
+void CTIMER_ClearStatusFlags(CTIMER_Type *base, uint32_t mask)
+{
+	base->u32Stat &= ~mask;
+}
+
+void SIM_CtimerPoll(uint64_t u64NowUs)
+{
+	CTIMER_Type *pxTimer = &g_axSimCtimer[4];
+	uint64_t u64MatchUs;
+
+	if (!pxTimer->bRunning || !pxTimer->bMatchIrq || (0UL == pxTimer->u32Match))
+	{
+		return;
+	}
+
+	u64MatchUs = ((uint64_t)pxTimer->u32Match * ((uint64_t)pxTimer->u32Prescale + 1ULL) * 1000000ULL) /
+				 g_au32SimCtimerClock[4];
+	if ((u64NowUs - pxTimer->u64StartUs) >= u64MatchUs)
+	{
+		/* Counter Reset On Match, The Next Period Starts Now */
+		pxTimer->u32Stat |= (uint32_t)kCTIMER_Match0Flag;
+		pxTimer->u64StartUs = u64NowUs;
+		SIM_IrqSetPending(CTIMER4_IRQn);
+	}
+}
+
+/*******************************************************************************
+ * LPCMP
+ ******************************************************************************/
+void LPCMP_Init(LPCMP_Type *base, const lpcmp_config_t *config)
+{
+	(void)config;
+	base->bInitialized 	= true;
+	base->u32Interrupts = 0UL;
+	base->u32Stat 		= 0UL;
+}
+
+void LPCMP_SetDACConfig(LPCMP_Type *base, const lpcmp_dac_config_t *config)
+{
+	(void)base;
+	(void)config;
+}
+
+void LPCMP_SetInputChannels(LPCMP_Type *base, uint32_t positiveChannel, uint32_t negativeChannel)
+{
+	(void)base;
+	(void)positiveChannel;
+	(void)negativeChannel;
+}
+
+void LPCMP_EnableInterrupts(LPCMP_Type *base, uint32_t mask)
+{
+	base->u32Interrupts |= mask;
+}
+
+void LPCMP_ClearStatusFlags(LPCMP_Type *base, uint32_t mask)
+{
+	base->u32Stat &= ~mask;
+}
+
+void SIM_CmpTrip(void)
+{
+	LPCMP_Type *pxCmp = CMP1;
+
+	if (!pxCmp->bInitialized)
+	{
+		return;
+	}
+
+	/* Before CTIMER4 Armed The Detection The Edge Is Only Latched, The Handler Clears It */
+	pxCmp->u32Stat |= (uint32_t)kLPCMP_OutputFallingEventFlag;
+	if (0UL != (pxCmp->u32Interrupts & (uint32_t)kLPCMP_OutputFallingInterruptEnable))
+	{
+		SIM_IrqSetPending(HSCMP1_IRQn);
+		SIM_IrqDispatch();
+	}
+}
+
+/*******************************************************************************
+ * Debug Console
+ ******************************************************************************/
+int SIM_Printf(const char *pcFormat, ...)
+{
+	va_list xArgs;
+	int iLength;
+	bool bRunning = (taskSCHEDULER_RUNNING == xTaskGetSchedulerState());
+
+	if (!g_bSimVerbose && (0 != strncmp(pcFormat, "ERR", 3U)))
+	{
+		return 0;
+	}
+
+	/* A Task Switched Out Inside stdio Would Keep Its Lock, The Next Task Printing Would Block Forever */
+	if (bRunning)
+	{
+		vTaskSuspendAll();
+	}
+	va_start(xArgs, pcFormat);
+	iLength = vfprintf(stderr, pcFormat, xArgs);
+	va_end(xArgs);
+	if (bRunning)
+	{
+		(void)xTaskResumeAll();
+	}
+	return iLength;
+}
+
+void SIM_Assert(const char *pcFile, int iLine)
+{
+	(void)fprintf(stderr, "ERR: Assertion Failed At %s:%d.\n", pcFile, iLine);
+	abort();
+}
@@ -0,0 +1,230 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      sim_irq.c
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Simulator Model of The NVIC: Interrupt Task Serving The Scenario And The Peripheral Models.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           sim_irq.c
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Simulator Model of The NVIC: Interrupt Task Serving The Scenario And The Peripheral Models.
+ * ****************************/
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "FreeRTOS.h"
+#include "task.h"
+#include "fsl_common.h"
+#include "fsl_debug_console.h"
+
+#include "sim.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/**
+ * @brief 	Stack of The Interrupt Task In Words, The Handlers Run On It.
+ */
+#define SIM_IRQ_STACK_SIZE			(configMINIMAL_STACK_SIZE)
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+/**
+ * @brief 	Interrupt Handlers of The Firmware, Same Names As In startup_mcxn947_cm33_core0.c.
+ */
+void LP_FLEXCOMM3_IRQHandler(void);
+void USB1_HS_IRQHandler(void);
+void HSCMP1_IRQHandler(void);
+void CTIMER4_IRQHandler(void);
+
+/**
+ * @brief 	Runs The Scenario And Dispatches The Interrupts Once Per Tick.
+ */
+static void SIM_IrqTask(void *pvParameters);
+
+/*******************************************************************************
+ * Global Variables
+ ******************************************************************************/
+/**
+ * @brief 	Vector Table, Indexed By IRQn_Type.
+ */
+static void (*const g_apfnSimVectors[SIM_IRQ_COUNT])(void) =
+{
+	LP_FLEXCOMM3_IRQHandler,
+	USB1_HS_IRQHandler,
+	HSCMP1_IRQHandler,
+	CTIMER4_IRQHandler
+};
+
+/**
+ * @brief 	Enabled And Pending Interrupts (NVIC ISER And ISPR).
+ */
+static volatile bool g_abSimIrqEnabled[SIM_IRQ_COUNT];
+static volatile bool g_abSimIrqPending[SIM_IRQ_COUNT];
+
+/**
+ * @brief 	Scenario And The Next Event.
+ */
+static const sim_event_t *g_pxSimEvents = NULL;
+static uint32_t g_u32SimEvents 			= 0UL;
+static uint32_t g_u32SimNextEvent 		= 0UL;
+
+/**
+ * @brief 	Time of The Power Cut, 0 If The Supply Is Still On.
+ */
+static uint64_t g_u64SimPowerCutUs 		= 0ULL;
+
+/**
+ * @brief 	Start of The Scheduler, The Times of The Scenario Are Relative To It.
+ */
+static uint64_t g_u64SimStartUs 		= 0ULL;
+
+/*******************************************************************************
+ * NVIC
+ ******************************************************************************/
+status_t EnableIRQ(IRQn_Type interrupt)
+{
+	g_abSimIrqEnabled[interrupt] = true;
+	return kStatus_Success;
+}
+
+status_t EnableIRQWithPriority(IRQn_Type irq, uint8_t priNum)
+{
+	/* All Lines Share The Interrupt Task, Nesting By Priority Is Not Modelled */
+	(void)priNum;
+	return EnableIRQ(irq);
+}
+
+status_t DisableIRQ(IRQn_Type interrupt)
+{
+	g_abSimIrqEnabled[interrupt] = false;
+	return kStatus_Success;
+}
+
+status_t IRQ_ClearPendingIRQ(IRQn_Type interrupt)
+{
+	g_abSimIrqPending[interrupt] = false;
+	return kStatus_Success;
+}
+
+uint32_t DisableGlobalIRQ(void)
+{
+	/* The Interrupt Task Can Not Preempt a Critical Section */
+	taskENTER_CRITICAL();
+	return 0UL;
+}
+
+void EnableGlobalIRQ(uint32_t primask)
+{
+	(void)primask;
+	taskEXIT_CRITICAL();
+}
+
+void SIM_IrqSetPending(IRQn_Type eIrq)
+{
+	g_abSimIrqPending[eIrq] = true;
+}
+
+void SIM_IrqDispatch(void)
+{
+	for (uint32_t i = 0UL; i < (uint32_t)SIM_IRQ_COUNT; i++)
+	{
+		/* A Line Enabled While Pending Fires Right Away, Like On The Core */
+		if (g_abSimIrqEnabled[i] && g_abSimIrqPending[i])
+		{
+			g_abSimIrqPending[i] = false;
+			g_apfnSimVectors[i]();
+		}
+	}
+}
+
+/*******************************************************************************
+ * Interrupt Task
+ ******************************************************************************/
+error_t SIM_IrqStart(const sim_event_t *pxEvents, uint32_t u32Events)
+{
+	g_pxSimEvents 	= pxEvents;
+	g_u32SimEvents 	= u32Events;
+
+	if (pdPASS != xTaskCreate(SIM_IrqTask, "sim_irq", SIM_IRQ_STACK_SIZE, NULL, SIM_IRQ_TASK_PRIO, NULL))
+	{
+		PRINTF("ERR: Interrupt Task Creation Failed!\r\n");
+		return ERROR_UNKNOWN;
+	}
+	return ERROR_NONE;
+}
+
+/**
+ * @brief 	Applies One Event of The Scenario.
+ */
+static void SIM_IrqRunEvent(const sim_event_t *pxEvent, uint64_t u64NowUs)
+{
+	switch (pxEvent->eType)
+	{
+		case SIM_EVENT_UART:
+			(void)SIM_UartSend(pxEvent->acArg);
+			break;
+		case SIM_EVENT_TRACE:
+			/* Record Times Count From The Time of The Event, Not From When The Tick Ran It */
+			(void)SIM_UartSendTrace(pxEvent->acArg, g_u64SimStartUs + pxEvent->u64AtUs);
+			break;
+		case SIM_EVENT_ATTACH:
+			SIM_UsbSetAttached(true);
+			break;
+		case SIM_EVENT_DETACH:
+			SIM_UsbSetAttached(false);
+			break;
+		case SIM_EVENT_PWRLOSS:
+			/* The Comparator Trips At Once, The Card Keeps Its Supply For The Hold-Up Time */
+			SIM_CmpTrip();
+			g_u64SimPowerCutUs = u64NowUs + pxEvent->u32Value;
+			if (0ULL == g_u64SimPowerCutUs)
+			{
+				g_u64SimPowerCutUs = 1ULL;
+			}
+			break;
+		case SIM_EVENT_QUIT:
+		default:
+			SIM_Exit(0);
+			break;
+	}
+}
+
+static void SIM_IrqTask(void *pvParameters)
+{
+	uint64_t u64NowUs;
+
+	(void)pvParameters;
+	g_u64SimStartUs = SIM_NowUs();
+
+	for (;;)
+	{
+		u64NowUs = SIM_NowUs() - g_u64SimStartUs;
+
+		while ((g_u32SimNextEvent < g_u32SimEvents) && (g_pxSimEvents[g_u32SimNextEvent].u64AtUs <= u64NowUs))
+		{
+			SIM_IrqRunEvent(&g_pxSimEvents[g_u32SimNextEvent], u64NowUs);
+			g_u32SimNextEvent++;
+		}
+
+		SIM_CtimerPoll(SIM_NowUs());
+		SIM_UartPoll(SIM_NowUs());
+		SIM_IrqDispatch();
+
+		if ((0ULL != g_u64SimPowerCutUs) && (u64NowUs >= g_u64SimPowerCutUs))
+		{
+			/* Hold-Up Capacitor Is Empty, Whatever Did Not Reach The Card Is Lost */
+			SIM_CardPowerCut();
+			SIM_Exit(0);
+		}
+
+		vTaskDelay(1U);
+	}
+}
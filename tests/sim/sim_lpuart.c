@@ -0,0 +1,387 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      sim_lpuart.c
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Simulator Model of LPUART3: Register Model And The RX Line Paced At The Baud Rate of The Sender.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           sim_lpuart.c
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Simulator Model of LPUART3: Register Model And The RX Line Paced At The Baud Rate of The Sender.
+ * ****************************/
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "fsl_common.h"
+#include "fsl_lpuart.h"
+#include "fsl_debug_console.h"
+
+#include "defs.h"
+#include "sim.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/**
+ * @brief 	Bits of One Frame of The Sender (Start, 8 Data Bits, No Parity, Stop).
+ */
+#define SIM_UART_FRAME_BITS			10ULL
+
+/**
+ * @brief 	Chunk In Which a File Is Read Into The Line Buffer.
+ */
+#define SIM_UART_READ_CHUNK			4096U
+
+/**
+ * @brief 	Header of a Trace File (tests/functional_tests/uart_trace.py).
+ */
+#define SIM_TRACE_HEADER			"# uart-trace 1"
+
+/*******************************************************************************
+ * Global Variables
+ ******************************************************************************/
+LPUART_Type g_xSimLpuart3;
+
+/**
+ * @brief 	Bytes Queued On The Line, Sent From The Head.
+ * @details Each Byte Has The Earliest Time Its Frame May Start (Trace), 0 If It Follows The Previous One.
+ */
+static uint8_t *g_pu8SimLine 			= NULL;
+static uint64_t *g_pu64SimNotBeforeNs 	= NULL;
+static size_t g_szSimLineSize 			= 0U;
+static size_t g_szSimLineHead 			= 0U;
+
+/**
+ * @brief 	Baud Rate of The Sender And Time of The Next Frame End In Nanoseconds.
+ */
+static uint32_t g_u32SimSenderBaud 	= DEFAULT_BAUDRATE;
+static uint64_t g_u64SimNextNs 		= 0ULL;
+
+/**
+ * @brief 	Statistics of The Line.
+ */
+static sim_uart_stats_t g_xSimUartStats;
+
+/*******************************************************************************
+ * LPUART Driver
+ ******************************************************************************/
+void LPUART_GetDefaultConfig(lpuart_config_t *config)
+{
+	(void)memset(config, 0, sizeof(lpuart_config_t));
+	config->baudRate_Bps 	= 115200U;
+	config->parityMode 		= kLPUART_ParityDisabled;
+	config->dataBitsCount 	= kLPUART_EightDataBits;
+	config->stopBitCount 	= kLPUART_OneStopBit;
+}
+
+status_t LPUART_Init(LPUART_Type *base, const lpuart_config_t *config, uint32_t srcClock_Hz)
+{
+	/* Same Limit As The SDK Driver: At Least 4 Samples Per Bit */
+	if ((0U == config->baudRate_Bps) || ((srcClock_Hz / 4U) < config->baudRate_Bps))
+	{
+		return kStatus_Fail;
+	}
+	base->xConfig 		= *config;
+	base->bInitialized 	= true;
+	base->u32Interrupts = 0UL;
+	base->u32Stat 		= 0UL;
+	return kStatus_Success;
+}
+
+void LPUART_Deinit(LPUART_Type *base)
+{
+	base->bInitialized 	= false;
+	base->u32Interrupts = 0UL;
+}
+
+void LPUART_EnableInterrupts(LPUART_Type *base, uint32_t mask)
+{
+	base->u32Interrupts |= mask;
+}
+
+void LPUART_DisableInterrupts(LPUART_Type *base, uint32_t mask)
+{
+	base->u32Interrupts &= ~mask;
+}
+
+uint32_t LPUART_GetStatusFlags(LPUART_Type *base)
+{
+	return base->u32Stat;
+}
+
+status_t LPUART_ClearStatusFlags(LPUART_Type *base, uint32_t mask)
+{
+	/* RDRF Is Cleared By Reading DATA, Error Flags Are Write-1-To-Clear */
+	base->u32Stat &= ~(mask & ~(uint32_t)kLPUART_RxDataRegFullFlag);
+	return kStatus_Success;
+}
+
+uint8_t LPUART_ReadByte(LPUART_Type *base)
+{
+	base->u32Stat &= ~(uint32_t)kLPUART_RxDataRegFullFlag;
+	return base->u8Data;
+}
+
+/*******************************************************************************
+ * RX Line
+ ******************************************************************************/
+void SIM_UartSetSender(uint32_t u32Baud)
+{
+	g_u32SimSenderBaud = u32Baud;
+}
+
+/**
+ * @brief 	Drops The Bytes Already Sent And Makes Room For More, Called With The Scheduler Suspended.
+ *
+ * @param 	szMore Number of Bytes To Be Queued.
+ *
+ * @return 	ERROR_NONE If The Buffers Were Grown.
+ */
+static error_t SIM_UartReserve(size_t szMore)
+{
+	uint8_t *pu8Line;
+	uint64_t *pu64NotBefore;
+
+	if (0U != g_szSimLineHead)
+	{
+		(void)memmove(g_pu8SimLine, &g_pu8SimLine[g_szSimLineHead], g_szSimLineSize - g_szSimLineHead);
+		(void)memmove(g_pu64SimNotBeforeNs, &g_pu64SimNotBeforeNs[g_szSimLineHead],
+					  (g_szSimLineSize - g_szSimLineHead) * sizeof(uint64_t));
+		g_szSimLineSize -= g_szSimLineHead;
+		g_szSimLineHead = 0U;
+	}
+
+	pu8Line = realloc(g_pu8SimLine, g_szSimLineSize + szMore);
+	if (NULL != pu8Line)
+	{
+		g_pu8SimLine = pu8Line;
+	}
+	pu64NotBefore = realloc(g_pu64SimNotBeforeNs, (g_szSimLineSize + szMore) * sizeof(uint64_t));
+	if (NULL != pu64NotBefore)
+	{
+		g_pu64SimNotBeforeNs = pu64NotBefore;
+	}
+	return ((NULL != pu8Line) && (NULL != pu64NotBefore)) ? ERROR_NONE : ERROR_READ;
+}
+
+error_t SIM_UartSend(const char *pcPath)
+{
+	FILE *pxFile;
+	size_t szRead;
+	error_t eError = ERROR_NONE;
+
+	/* Host Library Must Not Be Entered By Two Tasks At Once */
+	vTaskSuspendAll();
+	pxFile = fopen(pcPath, "rb");
+	if (NULL == pxFile)
+	{
+		(void)xTaskResumeAll();
+		PRINTF("ERR: Can Not Open %s.\r\n", pcPath);
+		return ERROR_OPEN;
+	}
+
+	do
+	{
+		eError = SIM_UartReserve(SIM_UART_READ_CHUNK);
+		if (ERROR_NONE != eError)
+		{
+			break;
+		}
+		szRead = fread(&g_pu8SimLine[g_szSimLineSize], 1U, SIM_UART_READ_CHUNK, pxFile);
+		(void)memset(&g_pu64SimNotBeforeNs[g_szSimLineSize], 0, szRead * sizeof(uint64_t));
+		g_szSimLineSize += szRead;
+	} while (SIM_UART_READ_CHUNK == szRead);
+
+	(void)fclose(pxFile);
+	(void)xTaskResumeAll();
+
+	if (ERROR_NONE != eError)
+	{
+		PRINTF("ERR: Can Not Read %s.\r\n", pcPath);
+	}
+	return eError;
+}
+
+/**
+ * @brief 	Queues One Record of a Trace: Hex Bytes Whose First Frame Starts No Earlier Than u64AtNs.
+ */
+static error_t SIM_UartQueueRecord(const char *pcHex, uint64_t u64AtNs)
+{
+	size_t szDigits = strspn(pcHex, "0123456789abcdefABCDEF");
+	size_t szBytes = szDigits / 2U;
+	char acByte[3] = { 0 };
+	size_t i;
+
+	if ((0U == szBytes) || (0U != (szDigits % 2U)) || ('\0' != pcHex[szDigits]) ||
+		(ERROR_NONE != SIM_UartReserve(szBytes)))
+	{
+		return ERROR_READ;
+	}
+	for (i = 0U; i < szBytes; i++)
+	{
+		acByte[0] = pcHex[2U * i];
+		acByte[1] = pcHex[(2U * i) + 1U];
+		g_pu8SimLine[g_szSimLineSize] = (uint8_t)strtoul(acByte, NULL, 16);
+		/* Only The First Byte Waits, The Rest Follow Back-To-Back */
+		g_pu64SimNotBeforeNs[g_szSimLineSize] = (0U == i) ? u64AtNs : 0ULL;
+		g_szSimLineSize++;
+	}
+	return ERROR_NONE;
+}
+
+error_t SIM_UartSendTrace(const char *pcPath, uint64_t u64BaseUs)
+{
+	FILE *pxFile;
+	char *pcLine = NULL;
+	size_t szLine = 0U;
+	char *pcEnd;
+	char *pcHex;
+	uint64_t u64AtUs;
+	uint32_t u32Number = 0UL;
+	error_t eError = ERROR_NONE;
+
+	vTaskSuspendAll();
+	pxFile = fopen(pcPath, "r");
+	if (NULL == pxFile)
+	{
+		(void)xTaskResumeAll();
+		PRINTF("ERR: Can Not Open %s.\r\n", pcPath);
+		return ERROR_OPEN;
+	}
+
+	while ((ERROR_NONE == eError) && (-1 != getline(&pcLine, &szLine, pxFile)))
+	{
+		u32Number++;
+		pcLine[strcspn(pcLine, "\r\n")] = '\0';
+		if (1UL == u32Number)
+		{
+			eError = (0 == strcmp(pcLine, SIM_TRACE_HEADER)) ? ERROR_NONE : ERROR_READ;
+			continue;
+		}
+		if (('#' == pcLine[0]) || ('\0' == pcLine[0]))
+		{
+			continue;
+		}
+		if (0 == strncmp(pcLine, "baud ", 5U))
+		{
+			/* Trace Was Taken At This Rate, The Line Runs At It From Now */
+			g_u32SimSenderBaud = (uint32_t)strtoul(&pcLine[5], NULL, 10);
+			eError = (0UL != g_u32SimSenderBaud) ? ERROR_NONE : ERROR_READ;
+			continue;
+		}
+
+		u64AtUs = strtoull(pcLine, &pcEnd, 10);
+		pcHex = pcEnd + strspn(pcEnd, " \t");
+		eError = ((pcEnd != pcLine) && (pcHex != pcEnd)) ?
+				 SIM_UartQueueRecord(pcHex, (u64BaseUs + u64AtUs) * 1000ULL) : ERROR_READ;
+	}
+
+	free(pcLine);
+	(void)fclose(pxFile);
+	(void)xTaskResumeAll();
+
+	if (ERROR_NONE != eError)
+	{
+		PRINTF("ERR: Invalid Trace %s At Line %u.\r\n", pcPath, u32Number);
+	}
+	return eError;
+}
+
+/**
+ * @brief 	Latches One Byte Into The Receiver.
+ */
+static void SIM_UartReceive(uint8_t u8Data)
+{
+	LPUART_Type *pxBase = LPUART3;
+
+	g_xSimUartStats.u64Sent++;
+
+	if (!pxBase->bInitialized || !pxBase->xConfig.enableRx)
+	{
+		/* Receiver Off (Mass Storage Mode, Power Loss), The Byte Is Not Seen At All */
+		g_xSimUartStats.u64Dropped++;
+		return;
+	}
+	if (pxBase->xConfig.baudRate_Bps != g_u32SimSenderBaud)
+	{
+		/* Sampled At The Wrong Rate, The Stop Bit Is Not Where The Receiver Expects It */
+		pxBase->u32Stat |= (uint32_t)kLPUART_FramingErrorFlag;
+		g_xSimUartStats.u64Dropped++;
+		return;
+	}
+	if (0UL != (pxBase->u32Stat & (uint32_t)kLPUART_RxDataRegFullFlag))
+	{
+		/* Previous Byte Was Not Read */
+		pxBase->u32Stat |= (uint32_t)kLPUART_RxOverrunFlag;
+		g_xSimUartStats.u64Overruns++;
+		return;
+	}
+
+	pxBase->u8Data = u8Data;
+	pxBase->u32Stat |= (uint32_t)kLPUART_RxDataRegFullFlag;
+	g_xSimUartStats.u64Received++;
+
+	if (0UL != (pxBase->u32Interrupts & (uint32_t)kLPUART_RxDataRegFullInterruptEnable))
+	{
+		SIM_IrqSetPending(LP_FLEXCOMM3_IRQn);
+		SIM_IrqDispatch();
+	}
+}
+
+void SIM_UartPoll(uint64_t u64NowUs)
+{
+	uint64_t u64NowNs = u64NowUs * 1000ULL;
+	uint64_t u64FrameNs = (SIM_UART_FRAME_BITS * 1000000000ULL) / g_u32SimSenderBaud;
+
+	if (g_szSimLineHead >= g_szSimLineSize)
+	{
+		/* Line Idle, The Next Frame Starts When Data Is Queued */
+		g_u64SimNextNs = u64NowNs + u64FrameNs;
+		return;
+	}
+
+	/* Frames Follow Back-To-Back Unless a Byte Waits For Its Time, Those Ending Since The Last Tick Are Received */
+	while (g_szSimLineHead < g_szSimLineSize)
+	{
+		uint64_t u64EndNs = g_pu64SimNotBeforeNs[g_szSimLineHead] + u64FrameNs;
+
+		if (u64EndNs < g_u64SimNextNs)
+		{
+			u64EndNs = g_u64SimNextNs;
+		}
+		if (u64EndNs > u64NowNs)
+		{
+			break;
+		}
+		SIM_UartReceive(g_pu8SimLine[g_szSimLineHead]);
+		g_szSimLineHead++;
+		g_u64SimNextNs = u64EndNs + u64FrameNs;
+	}
+}
+
+bool SIM_UartIdle(void)
+{
+	return (g_szSimLineHead >= g_szSimLineSize);
+}
+
+void SIM_UartStats(sim_uart_stats_t *pxStats)
+{
+	*pxStats = g_xSimUartStats;
+}
+
+uint32_t CLOCK_GetLPFlexCommClkFreq(uint32_t id)
+{
+	(void)id;
+	return SIM_FRO_HF_CLOCK_HZ;
+}
@@ -0,0 +1,333 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      sim_main.c
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Linux Simulator of The Whole Firmware: Command Line, Scenario And The Summary of The Run.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           sim_main.c
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Linux Simulator of The Whole Firmware: Command Line, Scenario And The Summary of The Run.
+ * ****************************/
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "fsl_debug_console.h"
+
+#include "defs.h"
+#include "sim.h"
+
+/* The Firmware main Is Renamed By The Makefile, This One Sets Up The Models And Calls It */
+#undef main
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/**
+ * @brief 	Size of One Line of The Scenario File.
+ */
+#define SIM_LINE_SIZE				(SIM_ARG_SIZE + 64U)
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+/**
+ * @brief 	main of The Firmware (application/src/main.c), Does Not Return.
+ */
+int FIRMWARE_Main(void);
+
+/*******************************************************************************
+ * Global Variables
+ ******************************************************************************/
+/**
+ * @brief 	Scenario, Sorted By Time.
+ */
+static sim_event_t g_axSimEvents[SIM_MAX_EVENTS];
+static uint32_t g_u32SimEventCount = 0UL;
+
+/**
+ * @brief 	Names of The Events, Indexed By sim_event_type_t.
+ */
+static const char *const g_apcSimEventName[] = { "uart", "trace", "attach", "detach", "pwrloss", "quit" };
+
+/*******************************************************************************
+ * Static Functions
+ ******************************************************************************/
+static void SIM_Usage(void)
+{
+	(void)fprintf(stderr,
+		"Usage: ./datalogger_sim [Options]\n"
+		"  --image FILE        Card Image, Created Empty If Missing (Default sd.img)\n"
+		"  --disk-mb N         Size of a New Image In MB (Default %lu)\n"
+		"  --baud N            Baud Rate of The Sender (Default %lu)\n"
+		"  --cmd-us N          Card Latency Per Command In us (Default %lu)\n"
+		"  --sector-us N       Card Latency Per Sector In us (Default %lu)\n"
+		"  --rtc \"Y-M-D H:M:S\" Time of The DS3231 At Power-On (Default Host Local Time)\n"
+		"  --at MS:EVENT[:ARG] Event At MS Milliseconds After Power-On\n"
+		"  --script FILE       Events, One \"MS EVENT [ARG]\" Per Line, # Starts a Comment\n"
+		"  -v                  Print INFO Lines of The Firmware\n"
+		"Events: uart FILE, trace FILE, attach, detach, pwrloss [HOLDUP_MS], quit\n"
+		"  trace Replays a Trace of uart_trace.py With Its Timing And Baud Rate.\n"
+		"  pwrloss Trips The Comparator (Armed %.1f s After Power-On), The Card Loses Its\n"
+		"  Supply After HOLDUP_MS (Default The Hold-Up Budget) And The Run Ends.\n",
+		SIM_CARD_DEFAULT_MB, (unsigned long)DEFAULT_BAUDRATE, SIM_CARD_DEFAULT_CMD_US,
+		SIM_CARD_DEFAULT_SECTOR_US, (double)PWRLOSS_DET_ACTIVE_IN_TIME);
+}
+
+/**
+ * @brief 	Adds One Event To The Scenario.
+ *
+ * @param 	pcTime Time In Milliseconds.
+ * @param 	pcName Name of The Event.
+ * @param 	pcArg Argument, NULL If None.
+ *
+ * @return 	ERROR_NONE If The Event Is Valid.
+ */
+static error_t SIM_AddEvent(const char *pcTime, const char *pcName, const char *pcArg)
+{
+	sim_event_t *pxEvent = &g_axSimEvents[g_u32SimEventCount];
+	char *pcEnd;
+	uint32_t i;
+
+	if (g_u32SimEventCount >= SIM_MAX_EVENTS)
+	{
+		(void)fprintf(stderr, "ERR: More Than %u Events.\n", SIM_MAX_EVENTS);
+		return ERROR_CONFIG;
+	}
+
+	(void)memset(pxEvent, 0, sizeof(sim_event_t));
+	pxEvent->u64AtUs = strtoull(pcTime, &pcEnd, 10) * 1000ULL;
+	if ((pcEnd == pcTime) || ('\0' != *pcEnd))
+	{
+		(void)fprintf(stderr, "ERR: Invalid Time '%s'.\n", pcTime);
+		return ERROR_CONFIG;
+	}
+
+	for (i = 0U; i < (sizeof(g_apcSimEventName) / sizeof(g_apcSimEventName[0])); i++)
+	{
+		if (0 == strcmp(pcName, g_apcSimEventName[i]))
+		{
+			break;
+		}
+	}
+	if (i == (sizeof(g_apcSimEventName) / sizeof(g_apcSimEventName[0])))
+	{
+		(void)fprintf(stderr, "ERR: Unknown Event '%s'.\n", pcName);
+		return ERROR_CONFIG;
+	}
+	pxEvent->eType = (sim_event_type_t)i;
+
+	switch (pxEvent->eType)
+	{
+		case SIM_EVENT_UART:
+		case SIM_EVENT_TRACE:
+			if ((NULL == pcArg) || (strlen(pcArg) >= SIM_ARG_SIZE))
+			{
+				(void)fprintf(stderr, "ERR: Event %s Needs a File.\n", pcName);
+				return ERROR_CONFIG;
+			}
+			(void)strcpy(pxEvent->acArg, pcArg);
+			break;
+		case SIM_EVENT_PWRLOSS:
+			pxEvent->u32Value = (NULL != pcArg) ? (uint32_t)(strtoul(pcArg, NULL, 10) * 1000UL) :
+												  PWRLOSS_HOLDUP_BUDGET_US;
+			break;
+		default:
+			break;
+	}
+
+	/* Kept Sorted By Time, Events At The Same Time Run In The Order Given */
+	for (i = g_u32SimEventCount; (i > 0U) && (g_axSimEvents[i - 1U].u64AtUs > pxEvent->u64AtUs); i--)
+	{
+	}
+	if (i != g_u32SimEventCount)
+	{
+		sim_event_t xEvent = *pxEvent;
+
+		(void)memmove(&g_axSimEvents[i + 1U], &g_axSimEvents[i], (g_u32SimEventCount - i) * sizeof(sim_event_t));
+		g_axSimEvents[i] = xEvent;
+	}
+	g_u32SimEventCount++;
+	return ERROR_NONE;
+}
+
+/**
+ * @brief 	Reads The Events of a Scenario File.
+ */
+static error_t SIM_LoadScript(const char *pcPath)
+{
+	char acLine[SIM_LINE_SIZE];
+	char *pcTime;
+	char *pcName;
+	char *pcSave;
+	FILE *pxFile = fopen(pcPath, "r");
+	error_t eError = ERROR_NONE;
+
+	if (NULL == pxFile)
+	{
+		(void)fprintf(stderr, "ERR: Can Not Open %s.\n", pcPath);
+		return ERROR_OPEN;
+	}
+	while ((ERROR_NONE == eError) && (NULL != fgets(acLine, sizeof(acLine), pxFile)))
+	{
+		acLine[strcspn(acLine, "#\r\n")] = '\0';
+		pcTime = strtok_r(acLine, " \t", &pcSave);
+		if (NULL == pcTime)
+		{
+			continue;
+		}
+		pcName = strtok_r(NULL, " \t", &pcSave);
+		eError = (NULL != pcName) ? SIM_AddEvent(pcTime, pcName, strtok_r(NULL, " \t", &pcSave)) : ERROR_CONFIG;
+	}
+	(void)fclose(pxFile);
+	return eError;
+}
+
+/*******************************************************************************
+ * Functions
+ ******************************************************************************/
+void SIM_Exit(int iStatus)
+{
+	sim_uart_stats_t xUart;
+	sim_card_stats_t xCard;
+
+	/* Nothing Runs Any More, Like a Board Without Supply */
+	vTaskSuspendAll();
+	SIM_UartStats(&xUart);
+	SIM_CardStats(&xCard);
+	SIM_CardClose();
+
+	(void)fprintf(stderr, "INFO: Run Ended At %.3f s.\n", (double)SIM_NowUs() / 1e6);
+	(void)fprintf(stderr, "INFO: UART %llu Sent, %llu Received, %llu Overruns, %llu Dropped%s.\n",
+				  (unsigned long long)xUart.u64Sent, (unsigned long long)xUart.u64Received,
+				  (unsigned long long)xUart.u64Overruns, (unsigned long long)xUart.u64Dropped,
+				  SIM_UartIdle() ? "" : " (Line Still Busy)");
+	(void)fprintf(stderr, "INFO: Card %llu Reads (%llu Sectors), %llu Writes (%llu Sectors), Busy %.3f s, "
+				  "%llu Rejected After The Power Cut.\n",
+				  (unsigned long long)xCard.u64Reads, (unsigned long long)xCard.u64SectorsRead,
+				  (unsigned long long)xCard.u64Writes, (unsigned long long)xCard.u64SectorsWritten,
+				  (double)xCard.u64BusyUs / 1e6, (unsigned long long)xCard.u64Rejected);
+	exit(iStatus);
+}
+
+int main(int argc, char **argv)
+{
+	const char *pcImage = "sd.img";
+	uint32_t u32DiskMB 	= SIM_CARD_DEFAULT_MB;
+	uint32_t u32CmdUs 	= SIM_CARD_DEFAULT_CMD_US;
+	uint32_t u32SectorUs = SIM_CARD_DEFAULT_SECTOR_US;
+	char acEvent[SIM_LINE_SIZE];
+	char *pcName;
+	char *pcArg;
+	struct tm xTm;
+
+	(void)SIM_NowUs();
+
+	for (int i = 1; i < argc; i++)
+	{
+		const char *pcOpt = argv[i];
+		const char *pcVal = ((i + 1) < argc) ? argv[i + 1] : NULL;
+
+		if (0 == strcmp(pcOpt, "-v"))
+		{
+			g_bSimVerbose = true;
+			continue;
+		}
+		if ((NULL == pcVal) || (0 == strcmp(pcOpt, "--help")))
+		{
+			SIM_Usage();
+			return (0 == strcmp(pcOpt, "--help")) ? EXIT_SUCCESS : EXIT_FAILURE;
+		}
+		i++;
+
+		if (0 == strcmp(pcOpt, "--image"))
+		{
+			pcImage = pcVal;
+		}
+		else if (0 == strcmp(pcOpt, "--disk-mb"))
+		{
+			u32DiskMB = (uint32_t)strtoul(pcVal, NULL, 10);
+		}
+		else if (0 == strcmp(pcOpt, "--baud"))
+		{
+			SIM_UartSetSender((uint32_t)strtoul(pcVal, NULL, 10));
+		}
+		else if (0 == strcmp(pcOpt, "--cmd-us"))
+		{
+			u32CmdUs = (uint32_t)strtoul(pcVal, NULL, 10);
+		}
+		else if (0 == strcmp(pcOpt, "--sector-us"))
+		{
+			u32SectorUs = (uint32_t)strtoul(pcVal, NULL, 10);
+		}
+		else if (0 == strcmp(pcOpt, "--rtc"))
+		{
+			(void)memset(&xTm, 0, sizeof(xTm));
+			if (NULL == strptime(pcVal, "%Y-%m-%d %H:%M:%S", &xTm))
+			{
+				(void)fprintf(stderr, "ERR: Invalid Time '%s'.\n", pcVal);
+				return EXIT_FAILURE;
+			}
+			SIM_RtcSet((int64_t)timegm(&xTm));
+		}
+		else if (0 == strcmp(pcOpt, "--at"))
+		{
+			(void)snprintf(acEvent, sizeof(acEvent), "%s", pcVal);
+			pcName = strchr(acEvent, ':');
+			pcArg = (NULL != pcName) ? strchr(&pcName[1], ':') : NULL;
+			if (NULL == pcName)
+			{
+				(void)fprintf(stderr, "ERR: Invalid Event '%s'.\n", pcVal);
+				return EXIT_FAILURE;
+			}
+			*pcName++ = '\0';
+			if (NULL != pcArg)
+			{
+				*pcArg++ = '\0';
+			}
+			if (ERROR_NONE != SIM_AddEvent(acEvent, pcName, pcArg))
+			{
+				return EXIT_FAILURE;
+			}
+		}
+		else if (0 == strcmp(pcOpt, "--script"))
+		{
+			if (ERROR_NONE != SIM_LoadScript(pcVal))
+			{
+				return EXIT_FAILURE;
+			}
+		}
+		else
+		{
+			SIM_Usage();
+			return EXIT_FAILURE;
+		}
+	}
+
+	if (ERROR_NONE != SIM_CardOpen(pcImage, u32DiskMB))
+	{
+		return EXIT_FAILURE;
+	}
+	SIM_CardSetLatency(u32CmdUs, u32SectorUs);
+
+	if (ERROR_NONE != SIM_IrqStart(g_axSimEvents, g_u32SimEventCount))
+	{
+		return EXIT_FAILURE;
+	}
+
+	/* Power-On: The Firmware Initializes The Board, Creates Its Tasks And Starts The Scheduler */
+	return FIRMWARE_Main();
+}
@@ -0,0 +1,115 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      sim_usb.c
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Simulator Model of The USB1 High-Speed Device: VBUS Session And The Mass Storage Buffers.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           sim_usb.c
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Simulator Model of The USB1 High-Speed Device: VBUS Session And The Mass Storage Buffers.
+ * ****************************/
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "FreeRTOS.h"
+#include "task.h"
+#include "fsl_common.h"
+#include "fsl_debug_console.h"
+#include "usb_device_dci.h"
+#include "disk.h"
+
+#include "task_switching.h"
+#include "mem.h"
+#include "sim.h"
+
+/*******************************************************************************
+ * Global Variables
+ ******************************************************************************/
+/**
+ * @brief 	Controller Registers, The Cable Is Unplugged At Power-On.
+ */
+static USBHS_Type g_xSimUsbhs = { .OTGSC = USBHS_OTGSC_BSE_MASK };
+static usb_device_ehci_state_struct_t g_xSimEhci = { .registerBase = &g_xSimUsbhs };
+static usb_device_struct_t g_xSimDevice = { .controllerHandle = &g_xSimEhci };
+
+/**
+ * @brief 	Mass Storage Buffers, Drawn Like In msc/source/disk.c So The DMA Region Has The Same Layout.
+ */
+static uint8_t *g_apu8SimMscRead[USB_DEVICE_MSC_READ_BUFFERS];
+#if (false == MSC_CONCURRENT_RECORD_ENABLED)
+static uint8_t *g_apu8SimMscWrite[USB_DEVICE_MSC_BUFFER_NUMBER];
+#endif /* (false == MSC_CONCURRENT_RECORD_ENABLED) */
+
+/*******************************************************************************
+ * Functions
+ ******************************************************************************/
+void USB_DeviceModeInit(void)
+{
+	uint32_t i;
+
+	for (i = 0U; i < USB_DEVICE_MSC_READ_BUFFERS; i++)
+	{
+		g_apu8SimMscRead[i] =
+			(uint8_t *)MEM_Alloc(MEM_REGION_DMA, MEM_OWNER_MSC, USB_DEVICE_MSC_READ_BUFF_SIZE, "MSC Read Buffer");
+	}
+#if (false == MSC_CONCURRENT_RECORD_ENABLED)
+	/* Read-Only Card Has No Write Buffers (USB_DEVICE_MSC_WRITE_BUFFERS) */
+	for (i = 0U; i < USB_DEVICE_MSC_WRITE_BUFFERS; i++)
+	{
+		g_apu8SimMscWrite[i] =
+			(uint8_t *)MEM_Alloc(MEM_REGION_DMA, MEM_OWNER_MSC, USB_DEVICE_MSC_WRITE_BUFF_SIZE, "MSC Write Buffer");
+	}
+#endif /* (false == MSC_CONCURRENT_RECORD_ENABLED) */
+
+	g_msc.attach 		= 0U;
+	g_msc.deviceHandle 	= &g_xSimDevice;
+#if (true == MSC_CONCURRENT_RECORD_ENABLED)
+	g_msc.readOnly 		= 1U;
+#else
+	g_msc.readOnly 		= 0U;
+#endif /* (true == MSC_CONCURRENT_RECORD_ENABLED) */
+
+	(void)EnableIRQ(USB1_HS_IRQn);
+}
+
+void USB_DeviceEhciIsrFunction(void *deviceHandle)
+{
+	/* No Host On The Other Side, There Are No Transfers To Serve */
+	(void)deviceHandle;
+}
+
+TickType_t USB_DeviceMscWriteTask(void)
+{
+	return portMAX_DELAY;
+}
+
+bool USB_DeviceMscWriteQueueEmpty(void)
+{
+	return true;
+}
+
+void SIM_UsbSetAttached(bool bAttached)
+{
+	if (bAttached)
+	{
+		/* Host Enumerates Right Away And Selects The Only Configuration */
+		g_xSimUsbhs.OTGSC &= ~USBHS_OTGSC_BSE_MASK;
+		g_msc.attach 				= 1U;
+		g_msc.currentConfiguration 	= 1U;
+	}
+	else
+	{
+		g_xSimUsbhs.OTGSC |= USBHS_OTGSC_BSE_MASK;
+		g_msc.attach 				= 0U;
+		g_msc.currentConfiguration 	= 0U;
+	}
+	SIM_IrqSetPending(USB1_HS_IRQn);
+	SIM_IrqDispatch();
+}
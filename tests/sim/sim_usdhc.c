@@ -0,0 +1,241 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      sim_usdhc.c
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Simulator Model of The SD Card On USDHC0: Image File With The Latency Model And Power Cut.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           sim_usdhc.c
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Simulator Model of The SD Card On USDHC0: Image File With The Latency Model And Power Cut.
+ * ****************************/
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "fsl_sd_disk.h"
+#include "fsl_debug_console.h"
+#include "usb_disk_adapter.h"
+
+#include "sim.h"
+
+/*******************************************************************************
+ * Global Variables
+ ******************************************************************************/
+/**
+ * @brief 	Card Handle, Only The ADMA Error Status Is Read By The Recorder.
+ */
+static USDHC_Type g_xSimUsdhc;
+static sdmmchost_t g_xSimSdmmc = { .hostController = { .base = &g_xSimUsdhc } };
+sd_card_t g_sd = { .host = &g_xSimSdmmc };
+
+/**
+ * @brief 	Image File And Its Size In Sectors.
+ */
+static int g_iSimCardFd 			= -1;
+static uint32_t g_u32SimCardSectors = 0UL;
+
+/**
+ * @brief 	Latency Model.
+ */
+static uint32_t g_u32SimCmdUs 		= SIM_CARD_DEFAULT_CMD_US;
+static uint32_t g_u32SimSectorUs 	= SIM_CARD_DEFAULT_SECTOR_US;
+
+/**
+ * @brief 	Card Lost Its Supply.
+ */
+static volatile bool g_bSimCardCut 	= false;
+
+/**
+ * @brief 	Statistics.
+ */
+static sim_card_stats_t g_xSimCardStats;
+
+/*******************************************************************************
+ * Static Functions
+ ******************************************************************************/
+/**
+ * @brief 	Keeps The Calling Task Busy For The Time The Card Would Take.
+ * @details Spun Instead of Blocked, The Tick (5 ms) Is Coarser Than a Command. The Interrupt Task Still
+ * 			Preempts At Each Tick, So Reception Goes On While The Card Is Busy.
+ */
+static void SIM_CardBusy(UINT count)
+{
+	uint64_t u64Us = (uint64_t)g_u32SimCmdUs + ((uint64_t)g_u32SimSectorUs * count);
+	uint64_t u64End = SIM_NowUs() + u64Us;
+
+	g_xSimCardStats.u64BusyUs += u64Us;
+	while (SIM_NowUs() < u64End)
+	{
+	}
+}
+
+/**
+ * @brief 	Transfers Sectors Between The Image And a Buffer, Retried On Interruption By The Tick.
+ */
+static bool SIM_CardTransfer(uint8_t *pu8Buff, LBA_t sector, UINT count, bool bWrite)
+{
+	size_t szLeft = (size_t)count * SIM_CARD_SECTOR_SIZE;
+	off_t xOffset = (off_t)sector * SIM_CARD_SECTOR_SIZE;
+	ssize_t sDone;
+
+	while (0U != szLeft)
+	{
+		sDone = bWrite ? pwrite(g_iSimCardFd, pu8Buff, szLeft, xOffset) : pread(g_iSimCardFd, pu8Buff, szLeft, xOffset);
+		if ((sDone < 0) && (EINTR == errno))
+		{
+			continue;
+		}
+		if (sDone <= 0)
+		{
+			return false;
+		}
+		pu8Buff = &pu8Buff[sDone];
+		xOffset += sDone;
+		szLeft -= (size_t)sDone;
+	}
+	return true;
+}
+
+/*******************************************************************************
+ * Functions
+ ******************************************************************************/
+error_t SIM_CardOpen(const char *pcPath, uint32_t u32SizeMB)
+{
+	struct stat xStat;
+
+	g_iSimCardFd = open(pcPath, O_RDWR | O_CREAT, 0644);
+	if ((g_iSimCardFd < 0) || (0 != fstat(g_iSimCardFd, &xStat)))
+	{
+		PRINTF("ERR: Failed To Open Image %s.\r\n", pcPath);
+		return ERROR_OPEN;
+	}
+
+	/* New Image Reads As Zeros, The Firmware Formats It On The First Mount */
+	if (0 == xStat.st_size)
+	{
+		xStat.st_size = (off_t)u32SizeMB * 1024 * 1024;
+		if (0 != ftruncate(g_iSimCardFd, xStat.st_size))
+		{
+			PRINTF("ERR: Failed To Create Image %s.\r\n", pcPath);
+			return ERROR_OPEN;
+		}
+	}
+	g_u32SimCardSectors = (uint32_t)(xStat.st_size / SIM_CARD_SECTOR_SIZE);
+	return ERROR_NONE;
+}
+
+void SIM_CardSetLatency(uint32_t u32CmdUs, uint32_t u32SectorUs)
+{
+	g_u32SimCmdUs 		= u32CmdUs;
+	g_u32SimSectorUs 	= u32SectorUs;
+}
+
+void SIM_CardPowerCut(void)
+{
+	g_bSimCardCut = true;
+}
+
+void SIM_CardStats(sim_card_stats_t *pxStats)
+{
+	*pxStats = g_xSimCardStats;
+}
+
+void SIM_CardClose(void)
+{
+	if (g_iSimCardFd >= 0)
+	{
+		(void)fsync(g_iSimCardFd);
+		(void)close(g_iSimCardFd);
+		g_iSimCardFd = -1;
+	}
+}
+
+/*******************************************************************************
+ * SD Disk Driver
+ ******************************************************************************/
+DSTATUS sd_disk_status(BYTE pdrv)
+{
+	(void)pdrv;
+	return ((g_iSimCardFd >= 0) && !g_bSimCardCut) ? 0U : STA_NOINIT;
+}
+
+DSTATUS sd_disk_initialize(BYTE pdrv)
+{
+	return sd_disk_status(pdrv);
+}
+
+DRESULT sd_disk_read(BYTE pdrv, BYTE *buff, LBA_t sector, UINT count)
+{
+	(void)pdrv;
+	if ((g_iSimCardFd < 0) || ((sector + count) > g_u32SimCardSectors))
+	{
+		return RES_PARERR;
+	}
+	if (g_bSimCardCut)
+	{
+		g_xSimCardStats.u64Rejected++;
+		return RES_NOTRDY;
+	}
+	SIM_CardBusy(count);
+	g_xSimCardStats.u64Reads++;
+	g_xSimCardStats.u64SectorsRead += count;
+	return SIM_CardTransfer(buff, sector, count, false) ? RES_OK : RES_ERROR;
+}
+
+DRESULT sd_disk_write(BYTE pdrv, const BYTE *buff, LBA_t sector, UINT count)
+{
+	(void)pdrv;
+	if ((g_iSimCardFd < 0) || ((sector + count) > g_u32SimCardSectors))
+	{
+		return RES_PARERR;
+	}
+	SIM_CardBusy(count);
+
+	/* Checked After The Transfer Time, a Write In Flight At The Cut Does Not Reach The Card */
+	if (g_bSimCardCut)
+	{
+		g_xSimCardStats.u64Rejected++;
+		return RES_NOTRDY;
+	}
+	g_xSimCardStats.u64Writes++;
+	g_xSimCardStats.u64SectorsWritten += count;
+	return SIM_CardTransfer((uint8_t *)buff, sector, count, true) ? RES_OK : RES_ERROR;
+}
+
+DRESULT sd_disk_ioctl(BYTE pdrv, BYTE cmd, void *buff)
+{
+	(void)pdrv;
+	switch (cmd)
+	{
+		case CTRL_SYNC:
+			return RES_OK;
+		case GET_SECTOR_COUNT:
+			*(LBA_t *)buff = (LBA_t)g_u32SimCardSectors;
+			return RES_OK;
+		case GET_SECTOR_SIZE:
+			*(WORD *)buff = (WORD)SIM_CARD_SECTOR_SIZE;
+			return RES_OK;
+		case GET_BLOCK_SIZE:
+			*(DWORD *)buff = 1UL;
+			return RES_OK;
+		default:
+			return RES_PARERR;
+	}
+}
+
+void USB_Disk_EnterStandby(void)
+{
+}
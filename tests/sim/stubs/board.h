@@ -0,0 +1,33 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      board.h
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Simulator Stub of The Board Support.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           board.h
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Simulator Stub of The Board Support.
+ * ****************************/
+
+#ifndef BOARD_H_
+#define BOARD_H_
+
+#include "fsl_common.h"
+/* The SDK Pulls FreeRTOS.h In Through The OS Abstraction, main.c Includes semphr.h Relying On It */
+#include "FreeRTOS.h"
+#include "fsl_clock.h"
+
+#define BOARD_DEBUG_UART_CLK_ATTACH		kFRO12M_to_FLEXCOMM4
+#define BOARD_XTAL0_CLK_HZ				24000000U
+
+void BOARD_InitDebugConsole(void);
+void BOARD_PowerMode_OD(void);
+void BOARD_USB_Disk_Config(uint32_t intPriority);
+
+#endif /* BOARD_H_ */
@@ -0,0 +1,25 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      clock_config.h
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Simulator Stub of The Clock Configuration.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           clock_config.h
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Simulator Stub of The Clock Configuration.
+ * ****************************/
+
+#ifndef CLOCK_CONFIG_H_
+#define CLOCK_CONFIG_H_
+
+#include "fsl_common.h"
+
+void BOARD_InitBootClocks(void);
+
+#endif /* CLOCK_CONFIG_H_ */
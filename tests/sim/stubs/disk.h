@@ -0,0 +1,64 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      disk.h
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Simulator Stub of The USB Mass Storage Glue, The Host Side of The Bus Is Not Simulated.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           disk.h
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Simulator Stub of The USB Mass Storage Glue, The Host Side of The Bus Is Not Simulated.
+ * ****************************/
+
+#ifndef DISK_H_
+#define DISK_H_
+
+#include <stdbool.h>
+#include "FreeRTOS.h"
+#include "semphr.h"
+#include "usb_device_dci.h"
+#include "fsl_common.h"
+#include "sdmmc_config.h"
+#include "defs.h"
+/* Pulled In By The USB And Board Headers of The Real One, app_tasks.c Relies On Them */
+#include "board.h"
+#include "fsl_edma.h"
+#include "usb_disk_adapter.h"
+
+/* Same Buffer Layout As msc/include/disk.h, So mem.c Budgets The Same Regions */
+#define USB_DEVICE_MSC_USE_WRITE_TASK 		(1U)
+#define USB_DEVICE_MSC_BUFFER_NUMBER  		(3U)
+#define USB_DEVICE_MSC_SECTOR_CACHE 		(1U)
+#define USB_DEVICE_MSC_CACHE_SECTORS 		(32U)
+#define USB_DEVICE_MSC_WRITE_BUFF_SIZE 		(512 * 64U)
+#define USB_DEVICE_MSC_READ_BUFF_SIZE  		(512 * 64U)
+#define USB_DEVICE_MSC_READ_BUFFERS  		(2U)
+#define USB_DEVICE_MSC_WRITE_BUFFERS 		((true == MSC_CONCURRENT_RECORD_ENABLED) ? 0U : USB_DEVICE_MSC_BUFFER_NUMBER)
+#define USB_DATA_ALIGN_SIZE 				(32U)
+
+typedef struct
+{
+	usb_device_handle deviceHandle;
+	uint8_t read_write_error;
+	uint8_t currentConfiguration;
+	uint8_t attach;
+	uint8_t readOnly;
+} usb_msc_struct_t;
+
+/**
+ * @brief 	Draws The MSC Buffers From The DMA Region And Opens The Device Handle (sim_usb.c).
+ */
+void USB_DeviceModeInit(void);
+
+/**
+ * @brief 	Write Queue of The Host, Always Empty.
+ */
+TickType_t USB_DeviceMscWriteTask(void);
+bool USB_DeviceMscWriteQueueEmpty(void);
+
+#endif /* DISK_H_ */
@@ -0,0 +1,73 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      fsl_clock.h
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Simulator Stub of The Clock Driver, Clock Setup Is Accepted And Ignored.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           fsl_clock.h
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Simulator Stub of The Clock Driver, Clock Setup Is Accepted And Ignored.
+ * ****************************/
+
+#ifndef FSL_CLOCK_H_
+#define FSL_CLOCK_H_
+
+#include "fsl_common.h"
+
+typedef enum
+{
+	kCLOCK_DivFlexcom2Clk = 0,
+	kCLOCK_DivFlexcom3Clk,
+	kCLOCK_DivFlexcom4Clk,
+	kCLOCK_DivFlexcom5Clk,
+	kCLOCK_DivUSdhcClk,
+	kCLOCK_DivCtimer0Clk,
+	kCLOCK_DivCtimer1Clk,
+	kCLOCK_DivCtimer4Clk,
+	kCLOCK_DivCmp1FClk
+} clock_div_name_t;
+
+typedef enum
+{
+	kFRO12M_to_FLEXCOMM2 = 0,
+	kFRO_HF_DIV_to_FLEXCOMM3,
+	kFRO12M_to_FLEXCOMM4,
+	kFRO12M_to_FLEXCOMM5,
+	kFRO_HF_to_USDHC,
+	kFRO_HF_to_CTIMER0,
+	kFRO12M_to_CTIMER1,
+	kFRO_HF_to_CTIMER4,
+	kFRO12M_to_CMP1F
+} clock_attach_id_t;
+
+typedef enum
+{
+	kCLOCK_Dma0 = 0,
+	kCLOCK_Dma1,
+	kCLOCK_Gpio0,
+	kCLOCK_Gpio2,
+	kCLOCK_Gpio4
+} clock_ip_name_t;
+
+enum
+{
+	kCLOCK_Clk16KToVbat 	= (1UL << 0U),
+	kCLOCK_Clk16KToMain 	= (1UL << 1U)
+};
+
+void CLOCK_SetClkDiv(clock_div_name_t div_name, uint32_t value);
+void CLOCK_AttachClk(clock_attach_id_t connection);
+void CLOCK_EnableClock(clock_ip_name_t clk);
+status_t CLOCK_SetupExtClocking(uint32_t iFreq);
+status_t CLOCK_SetupClk16KClocking(uint32_t clk_16k_enable_mask);
+uint32_t CLOCK_GetLPFlexCommClkFreq(uint32_t id);
+uint32_t CLOCK_GetCTimerClkFreq(uint32_t id);
+uint32_t CLOCK_GetCoreSysClkFreq(void);
+
+#endif /* FSL_CLOCK_H_ */
@@ -0,0 +1,85 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      fsl_common.h
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Simulator Stub of The SDK Common Driver (NVIC, DWT, Delays).
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           fsl_common.h
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Simulator Stub of The SDK Common Driver (NVIC, DWT, Delays).
+ * ****************************/
+
+#ifndef FSL_COMMON_H_
+#define FSL_COMMON_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+typedef int32_t status_t;
+
+#define kStatus_Success					((status_t)0)
+#define kStatus_Fail					((status_t)1)
+
+#define SDK_ALIGN(var, alignbytes)		var __attribute__((aligned(alignbytes)))
+#define SDK_ISR_EXIT_BARRIER
+
+#ifndef MIN
+#define MIN(a, b)						(((a) < (b)) ? (a) : (b))
+#endif
+#ifndef MAX
+#define MAX(a, b)						(((a) > (b)) ? (a) : (b))
+#endif
+
+/* Interrupts Run In The Interrupt Task of The Simulator (sim_irq.c) */
+typedef enum
+{
+	LP_FLEXCOMM3_IRQn 	= 0,
+	USB1_HS_IRQn,
+	HSCMP1_IRQn,
+	CTIMER4_IRQn,
+	SIM_IRQ_COUNT
+} IRQn_Type;
+
+status_t EnableIRQ(IRQn_Type interrupt);
+status_t EnableIRQWithPriority(IRQn_Type irq, uint8_t priNum);
+status_t DisableIRQ(IRQn_Type interrupt);
+status_t IRQ_ClearPendingIRQ(IRQn_Type interrupt);
+
+/* Masks The Interrupt Task, Mapped To a Critical Section of The Kernel */
+uint32_t DisableGlobalIRQ(void);
+void EnableGlobalIRQ(uint32_t primask);
+
+typedef struct
+{
+	volatile uint32_t CTRL;
+	volatile uint32_t CYCCNT;
+} DWT_Type;
+
+typedef struct
+{
+	volatile uint32_t DEMCR;
+} DCB_Type;
+
+#define DWT_CTRL_CYCCNTENA_Msk			(1UL << 0U)
+#define DCB_DEMCR_TRCENA_Msk			(1UL << 24U)
+
+/* Cycle Counter Derived From The Monotonic Clock At SystemCoreClock */
+DWT_Type *SIM_Dwt(void);
+extern DCB_Type g_xSimDcb;
+
+#define DWT 							(SIM_Dwt())
+#define DCB 							(&g_xSimDcb)
+
+extern uint32_t SystemCoreClock;
+
+void SDK_DelayAtLeastUs(uint32_t delayTime_us, uint32_t coreClock_Hz);
+
+#endif /* FSL_COMMON_H_ */
@@ -0,0 +1,78 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      fsl_ctimer.h
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Simulator Model of The CTIMERs: CTIMER1 Counts For The Run-Time Statistics, CTIMER4 Arms The Comparator.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           fsl_ctimer.h
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Simulator Model of The CTIMERs: CTIMER1 Counts For The Run-Time Statistics, CTIMER4 Arms The Comparator.
+ * ****************************/
+
+#ifndef FSL_CTIMER_H_
+#define FSL_CTIMER_H_
+
+#include "fsl_common.h"
+
+typedef enum
+{
+	kCTIMER_Match_0 = 0U
+} ctimer_match_t;
+
+typedef enum
+{
+	kCTIMER_Output_NoAction = 0U
+} ctimer_match_output_control_t;
+
+enum
+{
+	kCTIMER_Match0Flag = (1UL << 0U)
+};
+
+typedef struct
+{
+	uint32_t 	mode;
+	uint32_t 	input;
+	uint32_t 	prescale;
+} ctimer_config_t;
+
+typedef struct
+{
+	uint32_t 						matchValue;
+	bool 							enableCounterReset;
+	bool 							enableCounterStop;
+	ctimer_match_output_control_t 	outControl;
+	bool 							outPinInitState;
+	bool 							enableInterrupt;
+} ctimer_match_config_t;
+
+typedef struct
+{
+	volatile uint32_t 	TC;				/* Counter, Refreshed On Each Access					*/
+	uint32_t 			u32Prescale;
+	uint32_t 			u32Match;		/* Match 0 Value, 0 If Not Set Up						*/
+	bool 				bMatchIrq;
+	bool 				bRunning;
+	uint64_t 			u64StartUs;		/* Monotonic Time of CTIMER_StartTimer					*/
+	uint32_t 			u32Stat;		/* Match Flags											*/
+} CTIMER_Type;
+
+CTIMER_Type *SIM_Ctimer(uint32_t u32Index);
+
+#define CTIMER1 						(SIM_Ctimer(1U))
+#define CTIMER4 						(SIM_Ctimer(4U))
+
+void CTIMER_GetDefaultConfig(ctimer_config_t *config);
+void CTIMER_Init(CTIMER_Type *base, const ctimer_config_t *config);
+void CTIMER_SetupMatch(CTIMER_Type *base, ctimer_match_t matchChannel, const ctimer_match_config_t *config);
+void CTIMER_StartTimer(CTIMER_Type *base);
+void CTIMER_StopTimer(CTIMER_Type *base);
+void CTIMER_ClearStatusFlags(CTIMER_Type *base, uint32_t mask);
+
+#endif /* FSL_CTIMER_H_ */
@@ -0,0 +1,23 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      fsl_device_registers.h
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Simulator Stub, The Peripherals Are Modelled By The Drivers of The Simulator.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           fsl_device_registers.h
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Simulator Stub, The Peripherals Are Modelled By The Drivers of The Simulator.
+ * ****************************/
+
+#ifndef FSL_DEVICE_REGISTERS_H_
+#define FSL_DEVICE_REGISTERS_H_
+
+#include "fsl_common.h"
+
+#endif /* FSL_DEVICE_REGISTERS_H_ */
@@ -0,0 +1,44 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      fsl_edma.h
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Simulator Stub of The eDMA Driver (DMA of The DS3231 I2C), Setup Is Accepted And Ignored.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           fsl_edma.h
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Simulator Stub of The eDMA Driver (DMA of The DS3231 I2C), Setup Is Accepted And Ignored.
+ * ****************************/
+
+#ifndef FSL_EDMA_H_
+#define FSL_EDMA_H_
+
+#include "fsl_common.h"
+
+typedef struct
+{
+	uint32_t u32Reserved;
+} DMA_Type;
+
+extern DMA_Type g_axSimDma[2];
+
+#define DMA0 							(&g_axSimDma[0])
+#define DMA1 							(&g_axSimDma[1])
+
+typedef struct
+{
+	bool enableMasterIdReplication;
+	bool enableGlobalChannelLink;
+	bool enableHaltOnError;
+	bool enableDebugMode;
+	bool enableRoundRobinArbitration;
+} edma_config_t;
+
+void EDMA_Init(DMA_Type *base, const edma_config_t *config);
+
+#endif /* FSL_EDMA_H_ */
@@ -0,0 +1,40 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      fsl_gpio.h
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Simulator Stub of The GPIO Driver, The Output Latch Is Kept For The LED States.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           fsl_gpio.h
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Simulator Stub of The GPIO Driver, The Output Latch Is Kept For The LED States.
+ * ****************************/
+
+#ifndef FSL_GPIO_H_
+#define FSL_GPIO_H_
+
+#include <stdint.h>
+
+typedef struct
+{
+	volatile uint32_t PDOR;
+	volatile uint32_t PSOR;
+	volatile uint32_t PCOR;
+} GPIO_Type;
+
+extern GPIO_Type g_axSimGpio[5];
+
+#define GPIO0 							(&g_axSimGpio[0])
+#define GPIO1 							(&g_axSimGpio[1])
+#define GPIO2 							(&g_axSimGpio[2])
+#define GPIO3 							(&g_axSimGpio[3])
+#define GPIO4 							(&g_axSimGpio[4])
+
+void GPIO_PortToggle(GPIO_Type *base, uint32_t mask);
+
+#endif /* FSL_GPIO_H_ */
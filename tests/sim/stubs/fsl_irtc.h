@@ -0,0 +1,65 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      fsl_irtc.h
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Simulator Model of The IRTC, The Calendar Runs From The Time Set At Boot.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           fsl_irtc.h
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Simulator Model of The IRTC, The Calendar Runs From The Time Set At Boot.
+ * ****************************/
+
+#ifndef FSL_IRTC_H_
+#define FSL_IRTC_H_
+
+#include "fsl_common.h"
+
+typedef struct
+{
+	uint16_t year;
+	uint8_t month;
+	uint8_t day;
+	uint8_t weekDay;
+	uint8_t hour;
+	uint8_t minute;
+	uint8_t second;
+} irtc_datetime_t;
+
+typedef enum
+{
+	kRTC_MatchSecMinHr = 0
+} irtc_alarm_match_t;
+
+typedef enum
+{
+	kIRTC_Clk16K = 0
+} irtc_clock_select_t;
+
+typedef struct
+{
+	bool 					disableClockOutput;
+	irtc_alarm_match_t 		alrmMatch;
+	irtc_clock_select_t 	clockSelect;
+} irtc_config_t;
+
+typedef struct
+{
+	bool 		bRunning;		/* Set By IRTC_SetDatetime								*/
+	int64_t 	i64OffsetUs;	/* Calendar Time Minus The Monotonic Time (Microseconds) */
+} RTC_Type;
+
+extern RTC_Type g_xSimRtc;
+
+#define RTC 							(&g_xSimRtc)
+
+status_t IRTC_Init(RTC_Type *base, const irtc_config_t *config);
+status_t IRTC_SetDatetime(RTC_Type *base, const irtc_datetime_t *datetime);
+void IRTC_GetDatetime(RTC_Type *base, irtc_datetime_t *datetime);
+
+#endif /* FSL_IRTC_H_ */
@@ -0,0 +1,96 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      fsl_lpcmp.h
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Simulator Model of The Comparator CMP1 Watching The Supply, Its Falling Edge Is The Power Loss Trip.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           fsl_lpcmp.h
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Simulator Model of The Comparator CMP1 Watching The Supply, Its Falling Edge Is The Power Loss Trip.
+ * ****************************/
+
+#ifndef FSL_LPCMP_H_
+#define FSL_LPCMP_H_
+
+#include "fsl_common.h"
+
+typedef enum
+{
+	kLPCMP_HysteresisLevel0 = 0U,
+	kLPCMP_HysteresisLevel1,
+	kLPCMP_HysteresisLevel2,
+	kLPCMP_HysteresisLevel3
+} lpcmp_hysteresis_mode_t;
+
+typedef enum
+{
+	kLPCMP_LowSpeedPowerMode = 0U,
+	kLPCMP_HighSpeedPowerMode
+} lpcmp_power_mode_t;
+
+typedef enum
+{
+	kLPCMP_FunctionalClockSource0 = 0U
+} lpcmp_functional_source_clock_t;
+
+typedef enum
+{
+	kLPCMP_VrefSourceVin1 = 0U,
+	kLPCMP_VrefSourceVin2
+} lpcmp_dac_reference_voltage_source_t;
+
+/* Bits of The CSR And IER Registers */
+enum
+{
+	kLPCMP_OutputRisingEventFlag 		= (1UL << 0U),
+	kLPCMP_OutputFallingEventFlag 		= (1UL << 1U)
+};
+
+enum
+{
+	kLPCMP_OutputRisingInterruptEnable 	= (1UL << 0U),
+	kLPCMP_OutputFallingInterruptEnable = (1UL << 1U)
+};
+
+typedef struct
+{
+	bool 							enableStopMode;
+	bool 							enableOutputPin;
+	bool 							useUnfilteredOutput;
+	bool 							enableInvertOutput;
+	lpcmp_hysteresis_mode_t 		hysteresisMode;
+	lpcmp_power_mode_t 				powerMode;
+	lpcmp_functional_source_clock_t functionalSourceClock;
+} lpcmp_config_t;
+
+typedef struct
+{
+	bool 									enableLowPowerMode;
+	lpcmp_dac_reference_voltage_source_t 	referenceVoltageSource;
+	uint32_t 								DACValue;
+} lpcmp_dac_config_t;
+
+typedef struct
+{
+	bool 				bInitialized;
+	uint32_t 			u32Interrupts;	/* Enabled Interrupts (IER)			*/
+	volatile uint32_t 	u32Stat;		/* Event Flags (CSR)				*/
+} LPCMP_Type;
+
+extern LPCMP_Type g_xSimCmp1;
+
+#define CMP1 							(&g_xSimCmp1)
+
+void LPCMP_Init(LPCMP_Type *base, const lpcmp_config_t *config);
+void LPCMP_SetDACConfig(LPCMP_Type *base, const lpcmp_dac_config_t *config);
+void LPCMP_SetInputChannels(LPCMP_Type *base, uint32_t positiveChannel, uint32_t negativeChannel);
+void LPCMP_EnableInterrupts(LPCMP_Type *base, uint32_t mask);
+void LPCMP_ClearStatusFlags(LPCMP_Type *base, uint32_t mask);
+
+#endif /* FSL_LPCMP_H_ */
@@ -0,0 +1,24 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      fsl_lpi2c_edma.h
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Simulator Stub of The LPI2C EDMA Driver, Only Included By temperature.h (TEMPERATURE_MEAS_ENABLED Is Off).
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           fsl_lpi2c_edma.h
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Simulator Stub of The LPI2C EDMA Driver, Only Included By temperature.h (TEMPERATURE_MEAS_ENABLED Is Off).
+ * ****************************/
+
+#ifndef FSL_LPI2C_EDMA_H_
+#define FSL_LPI2C_EDMA_H_
+
+#include "fsl_lpi2c.h"
+#include "fsl_edma.h"
+
+#endif /* FSL_LPI2C_EDMA_H_ */
@@ -0,0 +1,93 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      fsl_lpuart.h
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Simulator Model of LPUART3: Receive Data Register, Status Flags And The RX Interrupt.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           fsl_lpuart.h
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Simulator Model of LPUART3: Receive Data Register, Status Flags And The RX Interrupt.
+ * ****************************/
+
+#ifndef FSL_LPUART_H_
+#define FSL_LPUART_H_
+
+#include "fsl_common.h"
+
+/* Values Match The MCUXpresso SDK Driver */
+typedef enum
+{
+	kLPUART_ParityDisabled 	= 0x0U,
+	kLPUART_ParityEven 		= 0x2U,
+	kLPUART_ParityOdd 		= 0x3U
+} lpuart_parity_mode_t;
+
+typedef enum
+{
+	kLPUART_EightDataBits 	= 0x0U,
+	kLPUART_SevenDataBits 	= 0x1U
+} lpuart_data_bits_t;
+
+typedef enum
+{
+	kLPUART_OneStopBit 		= 0U,
+	kLPUART_TwoStopBit 		= 1U
+} lpuart_stop_bit_count_t;
+
+/* Bits of The STAT Register */
+enum
+{
+	kLPUART_ParityErrorFlag 		= (1UL << 16U),
+	kLPUART_FramingErrorFlag 		= (1UL << 17U),
+	kLPUART_NoiseErrorFlag 			= (1UL << 18U),
+	kLPUART_RxOverrunFlag 			= (1UL << 19U),
+	kLPUART_RxDataRegFullFlag 		= (1UL << 21U)
+};
+
+enum
+{
+	kLPUART_RxDataRegFullInterruptEnable 	= (1UL << 21U)
+};
+
+typedef struct
+{
+	uint32_t 				baudRate_Bps;
+	lpuart_parity_mode_t 	parityMode;
+	lpuart_data_bits_t 		dataBitsCount;
+	bool 					isMsb;
+	lpuart_stop_bit_count_t stopBitCount;
+	uint8_t 				txFifoWatermark;
+	uint8_t 				rxFifoWatermark;
+	bool 					enableTx;
+	bool 					enableRx;
+} lpuart_config_t;
+
+typedef struct
+{
+	lpuart_config_t 		xConfig;		/* Applied By LPUART_Init					*/
+	bool 					bInitialized;
+	uint32_t 				u32Interrupts;	/* Enabled Interrupts						*/
+	volatile uint32_t 		u32Stat;		/* STAT: RDRF And Error Flags				*/
+	volatile uint8_t 		u8Data;			/* DATA: Received Byte						*/
+} LPUART_Type;
+
+extern LPUART_Type g_xSimLpuart3;
+
+#define LPUART3 						(&g_xSimLpuart3)
+
+void LPUART_GetDefaultConfig(lpuart_config_t *config);
+status_t LPUART_Init(LPUART_Type *base, const lpuart_config_t *config, uint32_t srcClock_Hz);
+void LPUART_Deinit(LPUART_Type *base);
+void LPUART_EnableInterrupts(LPUART_Type *base, uint32_t mask);
+void LPUART_DisableInterrupts(LPUART_Type *base, uint32_t mask);
+uint32_t LPUART_GetStatusFlags(LPUART_Type *base);
+status_t LPUART_ClearStatusFlags(LPUART_Type *base, uint32_t mask);
+uint8_t LPUART_ReadByte(LPUART_Type *base);
+
+#endif /* FSL_LPUART_H_ */
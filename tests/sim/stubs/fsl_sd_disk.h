@@ -0,0 +1,33 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      fsl_sd_disk.h
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Simulator Model of The SD Card Behind USDHC, Backed By an Image File (sim_usdhc.c).
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           fsl_sd_disk.h
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Simulator Model of The SD Card Behind USDHC, Backed By an Image File (sim_usdhc.c).
+ * ****************************/
+
+#ifndef FSL_SD_DISK_H_
+#define FSL_SD_DISK_H_
+
+#include "fsl_sd.h"
+#include "ff.h"
+#include "diskio.h"
+
+extern sd_card_t g_sd;
+
+DSTATUS sd_disk_status(BYTE pdrv);
+DSTATUS sd_disk_initialize(BYTE pdrv);
+DRESULT sd_disk_read(BYTE pdrv, BYTE *buff, LBA_t sector, UINT count);
+DRESULT sd_disk_write(BYTE pdrv, const BYTE *buff, LBA_t sector, UINT count);
+DRESULT sd_disk_ioctl(BYTE pdrv, BYTE cmd, void *buff);
+
+#endif /* FSL_SD_DISK_H_ */
@@ -0,0 +1,40 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      fsl_spc.h
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Simulator Stub of The System Power Controller, Analog Modules Are Always On.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           fsl_spc.h
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Simulator Stub of The System Power Controller, Analog Modules Are Always On.
+ * ****************************/
+
+#ifndef FSL_SPC_H_
+#define FSL_SPC_H_
+
+#include "fsl_common.h"
+
+typedef struct
+{
+	uint32_t u32Analog;		/* Enabled Analog Modules	*/
+} SPC_Type;
+
+extern SPC_Type g_xSimSpc;
+
+#define SPC0 							(&g_xSimSpc)
+
+enum
+{
+	kSPC_controlCmp1 		= (1UL << 1U),
+	kSPC_controlCmp1Dac 	= (1UL << 5U)
+};
+
+status_t SPC_EnableActiveModeAnalogModules(SPC_Type *base, uint32_t maskValue);
+
+#endif /* FSL_SPC_H_ */
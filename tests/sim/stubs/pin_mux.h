@@ -0,0 +1,26 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      pin_mux.h
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Simulator Stub of The Pin Configuration.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           pin_mux.h
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Simulator Stub of The Pin Configuration.
+ * ****************************/
+
+#ifndef PIN_MUX_H_
+#define PIN_MUX_H_
+
+#include "fsl_common.h"
+
+void BOARD_InitPins(void);
+void LPI2C2_DeinitPins(void);
+
+#endif /* PIN_MUX_H_ */
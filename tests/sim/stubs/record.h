@@ -0,0 +1,24 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      record.h
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Forwards <record.h> To The Application Header.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           record.h
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Forwards <record.h> To The Application Header.
+ * ****************************/
+
+#ifndef SIM_RECORD_H_
+#define SIM_RECORD_H_
+
+/* Included With Angle Brackets By record.c, See led.h */
+#include "../../../application/include/record.h"
+
+#endif /* SIM_RECORD_H_ */
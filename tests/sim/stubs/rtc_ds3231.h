@@ -0,0 +1,59 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      rtc_ds3231.h
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Simulator Model of The External DS3231, It Holds The Time Given On The Command Line.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           rtc_ds3231.h
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Simulator Model of The External DS3231, It Holds The Time Given On The Command Line.
+ * ****************************/
+
+#ifndef RTC_DS3231_H_
+#define RTC_DS3231_H_
+
+#include <stdint.h>
+#include "fsl_common.h"
+
+#define OSC_STOPPED					(0x00u)
+
+typedef struct
+{
+	uint8_t format;
+	uint8_t sec;
+	uint8_t min;
+	uint8_t hrs;
+} RTC_time_t;
+
+typedef struct
+{
+	uint8_t date;
+	uint8_t day;
+	uint8_t month;
+	uint8_t year;
+} RTC_date_t;
+
+typedef enum
+{
+	OSC_OK = 0,
+	OSC_INTERRUPTED
+} RTC_osc_state_t;
+
+uint8_t RTC_Init(void);
+void RTC_Deinit(void);
+uint8_t RTC_GetState(void);
+void RTC_SetOscState(RTC_osc_state_t state);
+void RTC_SetTime(RTC_time_t *pTime);
+void RTC_GetTime(RTC_time_t *pTime);
+void RTC_SetDate(RTC_date_t *pDate);
+void RTC_GetDate(RTC_date_t *pDate);
+void RTC_SetTimeDefault(RTC_time_t *pTime);
+void RTC_SetDateDefault(RTC_date_t *pDate);
+
+#endif /* RTC_DS3231_H_ */
@@ -0,0 +1,23 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      usb_device_cdc_acm.h
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Simulator Stub, The USB CDC Live Stream Is Not Simulated.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           usb_device_cdc_acm.h
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Simulator Stub, The USB CDC Live Stream Is Not Simulated.
+ * ****************************/
+
+#ifndef USB_DEVICE_CDC_ACM_H_
+#define USB_DEVICE_CDC_ACM_H_
+
+#define USB_DEVICE_CONFIG_CDC_ACM 		(0U)
+
+#endif /* USB_DEVICE_CDC_ACM_H_ */
@@ -0,0 +1,57 @@
+/******************************
+ *  Project:        NXP MCXN947 Datalogger
+ *  File Name:      usb_device_dci.h
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Simulator Model of The USB Device Controller: VBUS Session (OTGSC) And The Device Handle.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        NXP MCXN947 Datalogger
+ *  @file           usb_device_dci.h
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Simulator Model of The USB Device Controller: VBUS Session (OTGSC) And The Device Handle.
+ * ****************************/
+
+#ifndef USB_DEVICE_DCI_H_
+#define USB_DEVICE_DCI_H_
+
+#include <stdint.h>
+
+typedef void *usb_device_handle;
+
+typedef enum
+{
+	kUSB_DeviceNotifyBusReset = 0x10U,
+	kUSB_DeviceNotifySuspend,
+	kUSB_DeviceNotifyResume,
+	kUSB_DeviceNotifyLPMSleep,
+	kUSB_DeviceNotifyLPMResume,
+	kUSB_DeviceNotifyError,
+	kUSB_DeviceNotifyDetach,
+	kUSB_DeviceNotifyAttach
+} usb_device_notification_t;
+
+typedef struct
+{
+	volatile uint32_t OTGSC;
+} USBHS_Type;
+
+/* B-Session End: Set While VBUS Is Below The Session Threshold (Cable Detached) */
+#define USBHS_OTGSC_BSE_MASK			(1UL << 12U)
+
+typedef struct
+{
+	USBHS_Type *registerBase;
+} usb_device_ehci_state_struct_t;
+
+typedef struct
+{
+	void *controllerHandle;
+} usb_device_struct_t;
+
+void USB_DeviceEhciIsrFunction(void *deviceHandle);
+
+#endif /* USB_DEVICE_DCI_H_ */
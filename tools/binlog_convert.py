@@ -0,0 +1,276 @@
+#   Project:        NXP MCXN947 Datalogger
+#   Author:         Tomas Dolak
+#   File:           binlog_convert.py
+#   Description:    Converts Logs of The Binary Capture Mode (mode = binary) Into Text, Hex Dump, pcap or Raw Bytes.
+#
+#   Usage:          python binlog_convert.py SESSION_DIR|FILE... [--format text|hex|pcap|raw] [-o OUT]
+#                   python binlog_convert.py --image sd.img [--session 20261019_1] [--format ...] [-o OUT]
+#                   Without -o The Text And Hex Dump Go To stdout, pcap Opens In Wireshark (LINKTYPE_USER0).
+#
+
+# Libraries
+import argparse
+import datetime
+import os
+import re
+import struct
+import sys
+
+import sd_image
+
+# Format of record_bin_header_t In application/include/record.h, Keep In Sync
+BLOCK_MAGIC = 0x314B4C42
+HEADER = struct.Struct("<IHHQII")
+FLAG_NAMES = {
+    1 << 0: "OVERRUN",
+    1 << 1: "NOISE",
+    1 << 2: "FRAMING",
+    1 << 3: "PARITY",
+    1 << 4: "DROPPED",
+}
+FLAGS_KNOWN = sum(FLAG_NAMES)
+PADDING = 0x20
+
+LOG_FILE = re.compile(r"^\d{8}_\d{6}_(\d+)\.bin$", re.IGNORECASE)
+SESSION_DIR = re.compile(r"^(\d{8})_(\d+)$")
+
+# pcap Global Header And Record Header, Payload of Each Block Is One Packet
+PCAP_HEADER = struct.Struct("<IHHiIII")
+PCAP_RECORD = struct.Struct("<IIII")
+PCAP_MAGIC = 0xA1B2C3D4
+PCAP_LINKTYPE_USER0 = 147
+
+
+class Block:
+    """ One Block: Header Fields And Payload. Untimed Blocks Are Raw FIFO Bytes Saved Without Header. """
+
+    def __init__(self, name, offset, flags, tick_ms, rtc_seconds, payload, timed=True):
+        self.name = name
+        self.offset = offset
+        self.flags = flags
+        self.tick_ms = tick_ms
+        self.rtc_seconds = rtc_seconds
+        self.payload = payload
+        self.timed = timed
+        self.time_ms = None
+
+
+def header_at(content, pos):
+    """ Header At The Position, None If There Is None. """
+    if pos + HEADER.size > len(content):
+        return None
+    magic, length, flags, offset, tick_ms, rtc_seconds = HEADER.unpack_from(content, pos)
+    if magic != BLOCK_MAGIC or flags & ~FLAGS_KNOWN or pos + HEADER.size + length > len(content):
+        return None
+    return length, flags, offset, tick_ms, rtc_seconds
+
+
+def parse_file(name, content):
+    """
+    Blocks of One Log File. A Block Is Followed By Its Flush Padding And The Next Block, Or (Saved On Power Loss
+    or Over Reset) Directly By The Next Block or By Raw FIFO Bytes Till The End of The File.
+    """
+    blocks = []
+    pos = 0
+    while pos < len(content):
+        header = header_at(content, pos)
+        if header is None:
+            blocks.append(Block(name, None, 0, None, None, content[pos:], timed=False))
+            break
+        length, flags, offset, tick_ms, rtc_seconds = header
+        end = pos + HEADER.size + length
+        blocks.append(Block(name, offset, flags, tick_ms, rtc_seconds, content[pos + HEADER.size:end]))
+
+        pos = end
+        if header_at(content, pos) is None:
+            padding_end = pos
+            while padding_end < len(content) and content[padding_end] == PADDING:
+                padding_end += 1
+            if padding_end == len(content) or header_at(content, padding_end) is not None:
+                pos = padding_end
+    return blocks
+
+
+def read_inputs(args):
+    """ Log Files In The Order They Were Written: (Name, Content). """
+    if args.image:
+        image = sd_image.FatImage(args.image)
+        session = args.session
+        if not session:
+            dirs = [name for name, is_dir, _, _ in image.listdir("/") if is_dir and SESSION_DIR.match(name)]
+            if not dirs:
+                raise ValueError(f"ERR: {args.image} Has No Session Directory")
+            session = max(dirs, key=lambda name: tuple(int(x) for x in SESSION_DIR.match(name).groups()))
+        names = sorted((name for name, is_dir, _, _ in image.listdir(session) if not is_dir and LOG_FILE.match(name)),
+                       key=lambda name: int(LOG_FILE.match(name).group(1)))
+        return [(f"{session}/{name}", image.read(f"{session}/{name}")) for name in names]
+
+    files = []
+    for path in args.inputs:
+        if os.path.isdir(path):
+            names = sorted((name for name in os.listdir(path) if LOG_FILE.match(name)),
+                           key=lambda name: int(LOG_FILE.match(name).group(1)))
+            files += [os.path.join(path, name) for name in names]
+        else:
+            files.append(path)
+    result = []
+    for path in files:
+        with open(path, "rb") as f:
+            result.append((path, f.read()))
+    return result
+
+
+def place(blocks):
+    """
+    Gives Untimed Bytes The Offset After The Previous Block And Every Timed Block Its Calendar Time. The IRTC Is
+    Read When a Block Opens, After Its First Byte Arrived, So The Largest Difference of IRTC And Tick Over All Blocks
+    Maps The Ticks (Unwrapped, Gaps Shorter Than 49 Days) To The Calendar, Late By At Most The Delay of record_task.
+    Returns The Offset Gaps: (Offset, Missing Bytes).
+    """
+    gaps = []
+    expected = None
+    last_tick = None
+    tick_ms = 0
+    anchor_ms = None
+    for block in blocks:
+        if block.timed:
+            if expected is not None and block.offset != expected:
+                gaps.append((expected, block.offset - expected))
+            if last_tick is not None:
+                tick_ms += (block.tick_ms - last_tick) & 0xFFFFFFFF
+            else:
+                tick_ms = block.tick_ms
+            last_tick = block.tick_ms
+            block.time_ms = tick_ms
+            anchor = block.rtc_seconds * 1000 - tick_ms
+            anchor_ms = anchor if anchor_ms is None else max(anchor_ms, anchor)
+        else:
+            block.offset = expected if expected is not None else 0
+        expected = block.offset + len(block.payload)
+
+    for block in blocks:
+        if block.time_ms is not None:
+            block.time_ms += anchor_ms
+    return gaps
+
+
+def format_time(time_ms, date=True):
+    if time_ms is None:
+        return "----------- --:--:--.---" if date else "--:--:--.---"
+    stamp = datetime.datetime.fromtimestamp(time_ms // 1000, datetime.timezone.utc)
+    return stamp.strftime("%Y-%m-%d %H:%M:%S." if date else "%H:%M:%S.") + f"{time_ms % 1000:03d}"
+
+
+def format_flags(flags):
+    return ",".join(name for bit, name in FLAG_NAMES.items() if flags & bit) or "-"
+
+
+def write_hex(blocks, out):
+    for block in blocks:
+        kind = "Block" if block.timed else "Raw Bytes Without Header (Saved On Power Loss or Over Reset)"
+        out.write(f"# {kind}: {format_time(block.time_ms)} Offset {block.offset} Length {len(block.payload)} "
+                  f"Flags {format_flags(block.flags)} ({block.name})\n")
+        for i in range(0, len(block.payload), 16):
+            row = block.payload[i:i + 16]
+            ascii_row = "".join(chr(b) if 0x20 <= b < 0x7F else "." for b in row)
+            out.write(f"{block.offset + i:010d}  {row.hex(' '):<47}  |{ascii_row}|\n")
+
+
+def write_text(blocks, out):
+    """ Lines of The Stream, Each Prefixed By The Arrival Time of The Block Its First Byte Came In. """
+    line_start = True
+    last_time = None
+    for block in blocks:
+        if block.flags:
+            if not line_start:
+                out.write("\n")
+            out.write(f"[{format_flags(block.flags)} In Block At Offset {block.offset}]\n")
+            line_start = True
+        if block.time_ms is not None:
+            last_time = block.time_ms
+        for b in block.payload:
+            if line_start:
+                out.write(f"({format_time(last_time, date=False)}) ")
+                line_start = False
+            if b == 0x0A:
+                out.write("\n")
+                line_start = True
+            elif b == 0x0D or b == 0x09 or 0x20 <= b < 0x7F:
+                out.write(chr(b))
+            else:
+                out.write(f"\\x{b:02X}")
+    if not line_start:
+        out.write("\n")
+
+
+def write_pcap(blocks, out):
+    out.write(PCAP_HEADER.pack(PCAP_MAGIC, 2, 4, 0, 0, 65535, PCAP_LINKTYPE_USER0))
+    last_time = 0
+    for block in blocks:
+        if block.time_ms is not None:
+            last_time = block.time_ms
+        seconds, millis = divmod(last_time, 1000)
+        out.write(PCAP_RECORD.pack(seconds & 0xFFFFFFFF, millis * 1000, len(block.payload), len(block.payload)))
+        out.write(block.payload)
+
+
+def write_raw(blocks, out):
+    for block in blocks:
+        out.write(block.payload)
+
+
+FORMATS = {
+    "text": (write_text, False),
+    "hex": (write_hex, False),
+    "pcap": (write_pcap, True),
+    "raw": (write_raw, True),
+}
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Converts Logs of The Binary Capture Mode.")
+    parser.add_argument("inputs", nargs="*", help="Session Directories or Log Files (*.bin)")
+    parser.add_argument("--image", help="Card Image Instead of The Mounted Card (sd_image.py)")
+    parser.add_argument("--session", help="Session Directory In The Image, Default The Latest")
+    parser.add_argument("--format", choices=FORMATS, default="text")
+    parser.add_argument("-o", "--output", help="Output File, Default stdout (text, hex)")
+    args = parser.parse_args()
+
+    writer, binary = FORMATS[args.format]
+    if not args.inputs and not args.image:
+        parser.print_usage()
+        sys.exit(1)
+    if binary and not args.output:
+        print(f"ERR: Format {args.format} Needs -o", file=sys.stderr)
+        sys.exit(1)
+
+    try:
+        blocks = [block for name, content in read_inputs(args) for block in parse_file(name, content)]
+    except (OSError, ValueError) as e:
+        print(f"ERR: {e}", file=sys.stderr)
+        sys.exit(1)
+    if not any(block.timed for block in blocks):
+        print("ERR: No Block Header Found, Not a Log of The Binary Mode", file=sys.stderr)
+        sys.exit(1)
+
+    gaps = place(blocks)
+    if args.output:
+        with open(args.output, "wb" if binary else "w") as out:
+            writer(blocks, out)
+    else:
+        writer(blocks, sys.stdout)
+
+    timed = [block for block in blocks if block.timed]
+    flags = {name: sum(1 for block in timed if block.flags & bit) for bit, name in FLAG_NAMES.items()}
+    print(f"INFO: {len(timed)} Blocks, {sum(len(block.payload) for block in blocks)} Bytes "
+          f"({sum(len(block.payload) for block in blocks if not block.timed)} Without Header), "
+          f"{format_time(timed[0].time_ms)} .. {format_time(timed[-1].time_ms)}", file=sys.stderr)
+    for offset, lost in gaps:
+        print(f"ERR: Offset Gap At {offset}, {lost} Bytes Missing", file=sys.stderr)
+    for name, count in flags.items():
+        if count:
+            print(f"ERR: {name} In {count} Block(s)", file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
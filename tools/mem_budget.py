@@ -0,0 +1,175 @@
+#   Project:        NXP MCXN947 Datalogger
+#   Author:         Tomas Dolak
+#   File:           mem_budget.py
+#   Description:    Prints The RAM Budget Table From The Linker Map (Use of Each Memory, Largest Sections).
+#
+#   Usage:          python mem_budget.py datalogger.map [mem_budget.txt]
+#                   Run By The Post-Build Step of application/.cproject, The Arenas of mem.c Are Marked.
+#                   Fails If The Budget of SRAM (Arenas, FreeRTOS Heap, Other Static Data, Heap And Stack
+#                   Reserved By The Linker Script) Exceeds Its Size.
+#
+
+# Libraries
+import re
+import sys
+
+# Number of Largest Sections Listed Per Memory
+TOP_SECTIONS = 12
+
+# Objects Holding The Region Arenas (application/src/mem.c, The MSC Sector Cache Is In The SRAM Region)
+ARENA_OBJECT = "mem.o"
+
+# Object Holding The FreeRTOS Heap (configTOTAL_HEAP_SIZE)
+HEAP_OBJECT = "heap_4.o"
+
+# Memory Checked By The Budget, Named By The Managed Linker Script (MEM_SRAM_TOTAL In mem.h)
+BUDGET_MEMORY = "SRAM"
+
+# Reservations of The Managed Linker Script Without Input Sections: Heap of newlib And The Main Stack
+RESERVE_SYMBOLS = {"_HeapSize": "Heap Reserve (newlib)", "_StackSize": "Main Stack Reserve"}
+
+MEMORY_LINE = re.compile(r"^(\S+)\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)")
+SECTION_LINE = re.compile(r"^ (\.\S+|COMMON)\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S.*)$")
+SECTION_NAME = re.compile(r"^ (\.\S+|COMMON)$")
+SECTION_WRAPPED = re.compile(r"^\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S.*)$")
+SYMBOL_LINE = re.compile(r"^\s+0x([0-9a-fA-F]+)\s+(\w+)\s*=")
+
+
+def read_map(path):
+    with open(path, "r", errors="replace") as f:
+        lines = f.read().splitlines()
+
+    memories = []
+    sections = []
+    reserves = {}
+    state = None
+    pending = None
+
+    for line in lines:
+        if line.startswith("Memory Configuration"):
+            state = "memory"
+            continue
+        if line.startswith("Linker script and memory map"):
+            state = "map"
+            continue
+
+        if state == "memory":
+            match = MEMORY_LINE.match(line)
+            if match and match.group(1) not in ("Name", "*default*"):
+                memories.append({"name": match.group(1), "origin": int(match.group(2), 16),
+                                 "length": int(match.group(3), 16), "used": 0, "sections": []})
+        elif state == "map":
+            match = SYMBOL_LINE.match(line)
+            if match and match.group(2) in RESERVE_SYMBOLS:
+                reserves[match.group(2)] = int(match.group(1), 16)
+                continue
+            # Long Section Names Are Wrapped, Address And Size Follow On The Next Line
+            match = SECTION_LINE.match(line)
+            if match:
+                name, addr, size, obj = match.group(1), int(match.group(2), 16), int(match.group(3), 16), match.group(4)
+            elif pending and SECTION_WRAPPED.match(line):
+                match = SECTION_WRAPPED.match(line)
+                name, addr, size, obj = pending, int(match.group(1), 16), int(match.group(2), 16), match.group(3)
+            else:
+                match = SECTION_NAME.match(line)
+                pending = match.group(1) if match else None
+                continue
+            pending = None
+            if size != 0 and not obj.startswith("load address"):
+                sections.append((name, addr, size, obj.strip()))
+
+    if not memories:
+        raise ValueError(f"ERR: {path} Is Not a GNU ld Map (No Memory Configuration)")
+    return memories, sections, reserves
+
+
+def assign(memories, sections):
+    for name, addr, size, obj in sections:
+        for memory in memories:
+            if memory["origin"] <= addr < memory["origin"] + memory["length"]:
+                memory["used"] += size
+                memory["sections"].append((size, name, obj))
+                break
+
+
+def report(memories):
+    lines = []
+    lines.append(f"{'Memory':<16}{'Origin':>12}{'Used':>10}{'Total':>10}{'Free':>10}{'Use':>8}")
+    for memory in memories:
+        if memory["length"] == 0:
+            continue
+        free = memory["length"] - memory["used"]
+        lines.append(f"{memory['name']:<16}0x{memory['origin']:08X}{memory['used']:>10}{memory['length']:>10}"
+                     f"{free:>10}{100.0 * memory['used'] / memory['length']:>7.1f}%")
+
+    for memory in memories:
+        if not memory["sections"]:
+            continue
+        lines.append("")
+        lines.append(f"{memory['name']}: Largest Sections")
+        for size, name, obj in sorted(memory["sections"], reverse=True)[:TOP_SECTIONS]:
+            mark = " <- Arena" if obj.endswith(ARENA_OBJECT) else ""
+            lines.append(f"  {size:>8}  {name:<40} {obj}{mark}")
+    return lines
+
+
+def budget(memories, reserves):
+    """ Budget of SRAM: (Lines, True If It Fits). """
+    memory = next((memory for memory in memories if memory["name"] == BUDGET_MEMORY), None)
+    if memory is None:
+        return [f"ERR: No Memory {BUDGET_MEMORY} In The Map, Budget Not Checked"], False
+
+    items = {"Region Arenas (mem.o)": 0, "FreeRTOS Heap (heap_4.o)": 0, "Other Static Data": 0}
+    for size, name, obj in memory["sections"]:
+        if obj.endswith(ARENA_OBJECT):
+            items["Region Arenas (mem.o)"] += size
+        elif obj.endswith(HEAP_OBJECT):
+            items["FreeRTOS Heap (heap_4.o)"] += size
+        else:
+            items["Other Static Data"] += size
+    for symbol, name in RESERVE_SYMBOLS.items():
+        items[name] = reserves.get(symbol, 0)
+
+    total = sum(items.values())
+    lines = ["", f"{BUDGET_MEMORY}: Budget"]
+    lines += [f"  {size:>8}  {name}" for name, size in items.items()]
+    lines.append(f"  {total:>8}  Total of {memory['length']} B ({memory['length'] - total} B Free)")
+    return lines, total <= memory["length"]
+
+
+def main():
+    if len(sys.argv) < 2:
+        print("Usage: python mem_budget.py datalogger.map [mem_budget.txt]")
+        sys.exit(1)
+
+    src = sys.argv[1]
+    dst = sys.argv[2] if len(sys.argv) > 2 else None
+
+    try:
+        memories, sections, reserves = read_map(src)
+    except (OSError, ValueError) as e:
+        print(f"ERR: {e}")
+        sys.exit(1)
+
+    assign(memories, sections)
+    lines = report(memories)
+    budget_lines, fits = budget(memories, reserves)
+    lines += budget_lines
+    print("\n".join(lines))
+
+    if dst:
+        with open(dst, "w") as f:
+            f.write("\n".join(lines) + "\n")
+        print(f"INFO: RAM Budget Written Into {dst}")
+
+    # Overflow Is Reported By The Linker, This Only Flags a Map Which Does Not Add Up
+    if any(memory["used"] > memory["length"] for memory in memories if memory["length"]):
+        print("ERR: Memory Overflow")
+        sys.exit(1)
+    if not fits:
+        print(f"ERR: RAM Budget Exceeds {BUDGET_MEMORY}")
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,176 @@
+#   Project:        NXP MCXN947 Datalogger
+#   Author:         Tomas Dolak
+#   File:           sd_image.py
+#   Description:    Reads Directories And Files From an Image of The SD Card (FAT12/16/32, Long Names), No Mount Needed.
+#
+#   Usage:          python sd_image.py sd.img [DIR]                 Lists DIR (Default The Root)
+#                   python sd_image.py sd.img DIR --extract OUT     Copies DIR With Its Subdirectories Into OUT
+#                   Used By uart_trace.py On The Images of tests/sim And tests/host.
+#
+
+# Libraries
+import os
+import struct
+import sys
+
+SECTOR_SIZE = 512
+DIR_ENTRY_SIZE = 32
+
+ATTR_LFN = 0x0F
+ATTR_VOLUME = 0x08
+ATTR_DIRECTORY = 0x10
+
+# Offsets of The File System Type In The Boot Sector of FAT12/16 And FAT32
+FS_TYPE_OFFSETS = (0x36, 0x52)
+
+# Characters of One Long Name Entry (UTF-16LE, Three Fields)
+LFN_FIELDS = ((1, 10), (14, 12), (28, 4))
+
+
+class FatImage:
+    def __init__(self, path):
+        with open(path, "rb") as f:
+            self.data = f.read()
+
+        # f_mkfs Creates a Partition Table Unless FM_SFD Is Given
+        base = 0
+        if not any(self.data[o:o + 3] == b"FAT" for o in FS_TYPE_OFFSETS):
+            if self.data[0x1FE:0x200] != b"\x55\xAA":
+                raise ValueError(f"ERR: {path} Has No Boot Sector")
+            base = struct.unpack_from("<I", self.data, 0x1C6)[0] * SECTOR_SIZE
+
+        bps, spc, reserved, fats, root_entries, total16, _, fat16 = struct.unpack_from("<HBHBHHBH", self.data, base + 0x0B)
+        total32, fat32 = struct.unpack_from("<II", self.data, base + 0x20)
+        if bps == 0 or spc == 0:
+            raise ValueError(f"ERR: {path} Has No FAT File System")
+
+        self.cluster_size = bps * spc
+        fat_size = fat16 if fat16 else fat32
+        total = total16 if total16 else total32
+        root_sectors = (root_entries * DIR_ENTRY_SIZE + bps - 1) // bps
+
+        self.fat = base + reserved * bps
+        self.root = self.fat + fats * fat_size * bps
+        self.root_size = root_sectors * bps
+        self.heap = self.root + self.root_size
+        clusters = (total - reserved - fats * fat_size - root_sectors) // spc
+
+        if clusters < 4085:
+            self.bits = 12
+        elif clusters < 65525:
+            self.bits = 16
+        else:
+            self.bits = 32
+            self.root_cluster = struct.unpack_from("<I", self.data, base + 0x2C)[0]
+
+    def next_cluster(self, cluster):
+        if self.bits == 12:
+            value = struct.unpack_from("<H", self.data, self.fat + cluster + cluster // 2)[0]
+            value = (value >> 4) if (cluster & 1) else (value & 0xFFF)
+            return value if value < 0xFF8 else None
+        if self.bits == 16:
+            value = struct.unpack_from("<H", self.data, self.fat + cluster * 2)[0]
+            return value if value < 0xFFF8 else None
+        value = struct.unpack_from("<I", self.data, self.fat + cluster * 4)[0] & 0x0FFFFFFF
+        return value if value < 0x0FFFFFF8 else None
+
+    def read_chain(self, cluster, size=None):
+        chunks = []
+        seen = set()
+        while cluster is not None and cluster >= 2 and cluster not in seen:
+            seen.add(cluster)
+            offset = self.heap + (cluster - 2) * self.cluster_size
+            chunks.append(self.data[offset:offset + self.cluster_size])
+            if size is not None and len(chunks) * self.cluster_size >= size:
+                break
+            cluster = self.next_cluster(cluster)
+        data = b"".join(chunks)
+        return data[:size] if size is not None else data
+
+    def entries(self, raw):
+        lfn = {}
+        for offset in range(0, len(raw) - DIR_ENTRY_SIZE + 1, DIR_ENTRY_SIZE):
+            entry = raw[offset:offset + DIR_ENTRY_SIZE]
+            if entry[0] == 0x00:
+                break
+            if entry[0] == 0xE5:
+                lfn = {}
+                continue
+            attr = entry[11]
+            if attr == ATTR_LFN:
+                text = b"".join(entry[o:o + n] for o, n in LFN_FIELDS)
+                lfn[entry[0] & 0x1F] = text.decode("utf-16-le", "replace")
+                continue
+            if attr & ATTR_VOLUME:
+                lfn = {}
+                continue
+
+            if lfn:
+                name = "".join(lfn[i] for i in sorted(lfn)).split("\x00")[0]
+            else:
+                stem = entry[0:8].decode("ascii", "replace").rstrip()
+                ext = entry[8:11].decode("ascii", "replace").rstrip()
+                name = f"{stem}.{ext}" if ext else stem
+            lfn = {}
+            if name in (".", ".."):
+                continue
+
+            hi, lo, size = struct.unpack_from("<H", entry, 20)[0], struct.unpack_from("<H", entry, 26)[0], \
+                struct.unpack_from("<I", entry, 28)[0]
+            yield name, bool(attr & ATTR_DIRECTORY), size, (hi << 16) | lo
+
+    def listdir(self, path="/"):
+        if path.strip("/") == "":
+            if self.bits == 32:
+                raw = self.read_chain(self.root_cluster)
+            else:
+                raw = self.data[self.root:self.root + self.root_size]
+            return list(self.entries(raw))
+
+        parent, _, name = path.strip("/").rpartition("/")
+        for entry_name, is_dir, _, cluster in self.listdir(parent):
+            if entry_name.lower() == name.lower() and is_dir:
+                return list(self.entries(self.read_chain(cluster)))
+        raise FileNotFoundError(f"ERR: No Directory {path}")
+
+    def read(self, path):
+        parent, _, name = path.strip("/").rpartition("/")
+        for entry_name, is_dir, size, cluster in self.listdir(parent):
+            if entry_name.lower() == name.lower() and not is_dir:
+                return self.read_chain(cluster, size) if size else b""
+        raise FileNotFoundError(f"ERR: No File {path}")
+
+
+def extract(image, path, out):
+    os.makedirs(out, exist_ok=True)
+    for name, is_dir, _, _ in image.listdir(path):
+        src = f"{path.rstrip('/')}/{name}"
+        if is_dir:
+            extract(image, src, os.path.join(out, name))
+        else:
+            with open(os.path.join(out, name), "wb") as f:
+                f.write(image.read(src))
+
+
+def main():
+    if len(sys.argv) < 2:
+        print("Usage: python sd_image.py sd.img [DIR] [--extract OUT]")
+        sys.exit(1)
+
+    path = sys.argv[2] if len(sys.argv) > 2 and not sys.argv[2].startswith("--") else "/"
+    try:
+        image = FatImage(sys.argv[1])
+        if "--extract" in sys.argv:
+            out = sys.argv[sys.argv.index("--extract") + 1]
+            extract(image, path, out)
+            print(f"INFO: {path} Extracted Into {out}")
+            return
+        for name, is_dir, size, _ in image.listdir(path):
+            print(f"{'<DIR>' if is_dir else size:>10}  {name}")
+    except (OSError, ValueError, IndexError) as e:
+        print(e if str(e).startswith("ERR") else f"ERR: {e}")
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,122 @@
+#   Project:        NXP MCXN947 Datalogger
+#   Author:         Tomas Dolak
+#   File:           trace_convert.py
+#   Description:    Converts The Tracer Dump (trace.bin) Into Chrome/Perfetto JSON Trace.
+#
+#   Usage:          python trace_convert.py trace.bin [trace.json]
+#                   Open The Output In https://ui.perfetto.dev or chrome://tracing.
+#
+
+# Libraries
+import json
+import struct
+import sys
+
+# Format of application/include/trace.h
+FILE_MAGIC = 0x54545744
+FILE_VERSION = 1
+HEADER = struct.Struct("<IHHIIII")
+EVENT = struct.Struct("<IBBH")
+TYPE_BEGIN = 0
+
+# trace_id_t, Each Path Is Shown On Its Own Track
+TRACE_IDS = {
+    0: "UART ISR",
+    1: "CONSOLELOG_Recording",
+    2: "Timestamp",
+    3: "f_write",
+    4: "SD_WriteBlocks",
+    5: "MSC Command",
+    6: "Power Loss",
+}
+
+
+def read_dump(path):
+    with open(path, "rb") as f:
+        data = f.read()
+
+    magic, version, event_size, clock_hz, count, trigger_id, trigger_cycles = HEADER.unpack_from(data, 0)
+    if magic != FILE_MAGIC or version != FILE_VERSION or event_size != EVENT.size:
+        raise ValueError(f"ERR: {path} Is Not a Tracer Dump (Magic 0x{magic:08X}, Version {version})")
+
+    events = []
+    for i in range(count):
+        offset = HEADER.size + i * EVENT.size
+        if offset + EVENT.size > len(data):
+            print(f"ERR: Dump Truncated After {i} of {count} Events")
+            break
+        events.append(EVENT.unpack_from(data, offset))
+    return clock_hz, trigger_id, trigger_cycles, events
+
+
+def convert(clock_hz, trigger_id, trigger_cycles, events):
+    trace = []
+    open_begin = {}
+    time_cycles = 0
+    last_cycles = None
+    spike_cycles = time_cycles
+
+    for track, name in TRACE_IDS.items():
+        trace.append({"name": "thread_name", "ph": "M", "pid": 1, "tid": track, "args": {"name": name}})
+
+    for cycles, event_id, event_type, arg in events:
+        # DWT->CYCCNT Is 32-bit, Events Are Unwrapped Assuming Gaps Shorter Than One Overflow
+        if last_cycles is not None:
+            time_cycles += (cycles - last_cycles) & 0xFFFFFFFF
+        last_cycles = cycles
+        ts_us = time_cycles * 1e6 / clock_hz
+
+        if event_type == TYPE_BEGIN:
+            open_begin[event_id] = (time_cycles, arg)
+        elif event_id in open_begin:
+            begin_cycles, begin_arg = open_begin.pop(event_id)
+            begin_us = begin_cycles * 1e6 / clock_hz
+            # The Spike Is The Instance of The Path With The Duration Stored In The Header
+            if event_id == trigger_id and time_cycles - begin_cycles == trigger_cycles:
+                spike_cycles = time_cycles
+            trace.append({
+                "name": TRACE_IDS.get(event_id, f"Path {event_id}"),
+                "ph": "X",
+                "pid": 1,
+                "tid": event_id,
+                "ts": begin_us,
+                "dur": ts_us - begin_us,
+                "args": {"arg": begin_arg},
+            })
+        # End Without Begin Lies Before The Oldest Event In The Ring And Is Skipped
+
+    trace.append({
+        "name": "Spike",
+        "ph": "i",
+        "s": "g",
+        "pid": 1,
+        "tid": trigger_id,
+        "ts": spike_cycles * 1e6 / clock_hz,
+        "args": {"path": TRACE_IDS.get(trigger_id, trigger_id), "duration_us": trigger_cycles * 1e6 / clock_hz},
+    })
+    return {"traceEvents": trace, "displayTimeUnit": "ns"}
+
+
+def main():
+    if len(sys.argv) < 2:
+        print("Usage: python trace_convert.py trace.bin [trace.json]")
+        sys.exit(1)
+
+    src = sys.argv[1]
+    dst = sys.argv[2] if len(sys.argv) > 2 else "trace.json"
+
+    try:
+        clock_hz, trigger_id, trigger_cycles, events = read_dump(src)
+    except (OSError, ValueError, struct.error) as e:
+        print(f"ERR: {e}")
+        sys.exit(1)
+
+    with open(dst, "w") as f:
+        json.dump(convert(clock_hz, trigger_id, trigger_cycles, events), f)
+
+    print(f"INFO: {len(events)} Events, Spike In {TRACE_IDS.get(trigger_id, trigger_id)} "
+          f"({trigger_cycles * 1e6 / clock_hz:.1f} us), Written Into {dst}")
+
+
+if __name__ == "__main__":
+    main()